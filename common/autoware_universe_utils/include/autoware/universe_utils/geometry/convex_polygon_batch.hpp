@@ -0,0 +1,111 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__UNIVERSE_UTILS__GEOMETRY__CONVEX_POLYGON_BATCH_HPP_
+#define AUTOWARE__UNIVERSE_UTILS__GEOMETRY__CONVEX_POLYGON_BATCH_HPP_
+
+#include "autoware/universe_utils/geometry/alt_geometry.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+namespace alt
+{
+/**
+ * @brief Set of convex polygons stored as structure of arrays for batched Separating Axis Theorem
+ * (SAT) tests
+ * @details for each polygon, the vertices, the edge normals (separating axes candidates), and the
+ * projection of the polygon onto its own normals are precomputed and stored contiguously. The
+ * arrays of each polygon are padded to a multiple of `lane_width` such that the projections onto
+ * `lane_width` axes are calculated at once with SIMD instructions (AVX, SSE2, or NEON depending on
+ * the target, with a scalar fallback).
+ */
+class ConvexPolygon2dBatch
+{
+public:
+  /// @brief number of axes processed at once by the SAT kernels
+  static constexpr size_t lane_width = 4;
+
+  ConvexPolygon2dBatch() = default;
+
+  explicit ConvexPolygon2dBatch(const std::vector<ConvexPolygon2d> & polygons);
+
+  void push_back(const ConvexPolygon2d & polygon);
+
+  void reserve(const size_t polygons_nb, const size_t vertices_per_polygon = 8);
+
+  void clear() noexcept;
+
+  size_t size() const noexcept { return min_xs_.size(); }
+
+  bool empty() const noexcept { return min_xs_.empty(); }
+
+  /// @brief begin of the arrays of polygon i, padded to a multiple of lane_width
+  size_t offset(const size_t i) const noexcept { return offsets_[i]; }
+
+  /// @brief number of vertices of polygon i, excluding the padding
+  size_t vertices_nb(const size_t i) const noexcept { return vertices_nb_[i]; }
+
+  const std::vector<double> & xs() const noexcept { return xs_; }
+  const std::vector<double> & ys() const noexcept { return ys_; }
+  const std::vector<double> & normal_xs() const noexcept { return normal_xs_; }
+  const std::vector<double> & normal_ys() const noexcept { return normal_ys_; }
+  const std::vector<double> & normal_mins() const noexcept { return normal_mins_; }
+  const std::vector<double> & normal_maxs() const noexcept { return normal_maxs_; }
+  const std::vector<double> & min_xs() const noexcept { return min_xs_; }
+  const std::vector<double> & min_ys() const noexcept { return min_ys_; }
+  const std::vector<double> & max_xs() const noexcept { return max_xs_; }
+  const std::vector<double> & max_ys() const noexcept { return max_ys_; }
+
+private:
+  std::vector<size_t> offsets_{0};
+  std::vector<size_t> vertices_nb_;
+  // vertices (the closing vertex is not repeated)
+  std::vector<double> xs_;
+  std::vector<double> ys_;
+  // edge normals and the interval of the projection of the polygon onto them
+  std::vector<double> normal_xs_;
+  std::vector<double> normal_ys_;
+  std::vector<double> normal_mins_;
+  std::vector<double> normal_maxs_;
+  // axis aligned bounding boxes
+  std::vector<double> min_xs_;
+  std::vector<double> min_ys_;
+  std::vector<double> max_xs_;
+  std::vector<double> max_ys_;
+};
+}  // namespace alt
+
+/**
+ * @brief Check if a convex polygon intersects each polygon of a batch using the SAT
+ * @details equivalent to calling intersects(poly, batch[i]) for each polygon of the batch, except
+ * for touching polygons which may be reported either way due to floating point precision
+ * @return vector with the result for each polygon of the batch
+ */
+std::vector<bool> intersects(
+  const alt::ConvexPolygon2d & poly, const alt::ConvexPolygon2dBatch & batch);
+
+/**
+ * @brief Check if a convex polygon is within each polygon of a batch
+ * @details equivalent to calling within(poly, batch[i]) for each polygon of the batch, except for
+ * different polygons sharing boundary points which are not considered within
+ * @return vector with the result for each polygon of the batch
+ */
+std::vector<bool> within(
+  const alt::ConvexPolygon2d & poly_contained, const alt::ConvexPolygon2dBatch & batch);
+}  // namespace autoware::universe_utils
+
+#endif  // AUTOWARE__UNIVERSE_UTILS__GEOMETRY__CONVEX_POLYGON_BATCH_HPP_
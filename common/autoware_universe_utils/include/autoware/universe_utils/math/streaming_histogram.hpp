@@ -0,0 +1,113 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__UNIVERSE_UTILS__MATH__STREAMING_HISTOGRAM_HPP_
+#define AUTOWARE__UNIVERSE_UTILS__MATH__STREAMING_HISTOGRAM_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+/**
+ * @brief statistics of the values added to a StreamingHistogram
+ * @details the quantiles are bucket midpoints clamped to [min, max], all the values are 0 if
+ * count is 0
+ */
+struct StreamingSummary
+{
+  uint64_t count{0};
+  double mean{0.0};
+  double min{0.0};
+  double max{0.0};
+  double p50{0.0};
+  double p95{0.0};
+  double p99{0.0};
+};
+
+/**
+ * @brief fixed-memory histogram of non-negative values, such as latencies, with a bounded relative
+ * quantile error (HDR histogram)
+ * @details each power of 2 of the range [lowest_value, highest_value] is split into
+ * sub_bucket_count linear buckets, so a quantile is within 1 / sub_bucket_count of the exact value
+ * relatively. Values below lowest_value are counted in a single bucket and values above
+ * highest_value in the last bucket, the min and max are exact.
+ *
+ * add() is lock-free and does not allocate, so it can be called from any thread, e.g. from
+ * subscription callbacks. The other functions may be called concurrently with add() but only from
+ * a single reader thread, and a summary may miss the values added while it is computed.
+ */
+class StreamingHistogram
+{
+public:
+  /**
+   * @param lowest_value lower bound of the range with a bounded relative error, must be positive
+   * @param highest_value upper bound of the range with a bounded relative error
+   * @param sub_bucket_count number of buckets per power of 2
+   */
+  explicit StreamingHistogram(
+    const double lowest_value = 1e-3, const double highest_value = 1e6,
+    const size_t sub_bucket_count = 32);
+
+  StreamingHistogram(const StreamingHistogram &) = delete;
+  StreamingHistogram & operator=(const StreamingHistogram &) = delete;
+
+  /**
+   * @brief add a value, negative values are counted as 0
+   */
+  void add(const double value) noexcept;
+
+  /**
+   * @brief statistics of all the values added so far
+   */
+  StreamingSummary summary() const;
+
+  /**
+   * @brief statistics of the values added since the previous call, e.g. to report a time window
+   */
+  StreamingSummary take_window_summary();
+
+  /**
+   * @brief number of buckets, i.e. the memory footprint in units of 8 bytes
+   */
+  size_t bucket_count() const { return counts_.size(); }
+
+private:
+  size_t to_bucket_index(const double value) const noexcept;
+  double to_bucket_value(const size_t index) const;
+  StreamingSummary summarize(
+    const std::vector<uint64_t> & counts, const double sum, const double min,
+    const double max) const;
+
+  double lowest_value_;
+  size_t sub_bucket_count_;
+  std::vector<std::atomic<uint64_t>> counts_;
+  std::atomic<double> sum_{0.0};
+  std::atomic<double> min_;
+  std::atomic<double> max_;
+  std::atomic<double> window_min_;
+  std::atomic<double> window_max_;
+
+  // state of the reader at the previous take_window_summary()
+  std::vector<uint64_t> window_begin_counts_;
+  double window_begin_sum_{0.0};
+  // buffer for the snapshot of the counts
+  std::vector<uint64_t> counts_snapshot_;
+};
+
+}  // namespace autoware::universe_utils
+
+#endif  // AUTOWARE__UNIVERSE_UTILS__MATH__STREAMING_HISTOGRAM_HPP_
@@ -0,0 +1,237 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef AUTOWARE__UNIVERSE_UTILS__SYSTEM__LOCK_FREE_TIME_KEEPER_HPP_
+#define AUTOWARE__UNIVERSE_UTILS__SYSTEM__LOCK_FREE_TIME_KEEPER_HPP_
+
+#include "autoware/universe_utils/system/time_keeper.hpp"
+
+#include <rclcpp/publisher.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+/**
+ * @brief Identifier of a tracked scope
+ */
+using ScopeId = uint32_t;
+
+/**
+ * @brief Intern a scope name and get its identifier
+ * @details thread-safe but takes a lock, so it should be called once per call site and its result
+ * stored in a static variable
+ *
+ * @param name Name of the scope
+ * @return ScopeId Identifier of the scope, identical for identical names
+ */
+ScopeId register_scope(const std::string & name);
+
+/**
+ * @brief Get the name of a scope registered with register_scope()
+ *
+ * @param scope_id Identifier of the scope
+ * @return std::string Name of the scope
+ */
+std::string get_scope_name(const ScopeId scope_id);
+
+/**
+ * @brief Class for tracking the processing time of scopes with a low and constant overhead
+ * @details contrary to TimeKeeper, scopes are identified by interned ids and each thread records
+ * its measurements in a preallocated ring buffer without any lock or allocation. A background
+ * thread periodically drains the buffers and reports, for each scope of the call tree, the
+ * percentiles of its processing times over the period. Measurements recorded while the buffer of a
+ * thread is full are dropped and counted. A thread only takes a lock the first time it uses a
+ * given time keeper, several time keepers can be used alternately without contention.
+ */
+class LockFreeTimeKeeper
+{
+public:
+  static constexpr size_t max_depth = 32;  //!< Maximum depth of tracked nested scopes
+
+  /**
+   * @brief Construct a new LockFreeTimeKeeper object and start its aggregator thread
+   *
+   * @param report_period Period at which the processing times are aggregated and reported
+   * @param buffer_capacity Number of measurements that each thread can buffer between two reports,
+   * rounded up to a power of 2
+   * @param reporters Reporters, see add_reporter()
+   */
+  template <typename... Reporters>
+  LockFreeTimeKeeper(
+    const std::chrono::milliseconds report_period, const size_t buffer_capacity,
+    Reporters... reporters)
+  : LockFreeTimeKeeper(report_period, buffer_capacity)
+  {
+    (add_reporter(reporters), ...);
+  }
+
+  LockFreeTimeKeeper(const std::chrono::milliseconds report_period, const size_t buffer_capacity);
+
+  LockFreeTimeKeeper(const LockFreeTimeKeeper &) = delete;
+  LockFreeTimeKeeper & operator=(const LockFreeTimeKeeper &) = delete;
+  LockFreeTimeKeeper(LockFreeTimeKeeper &&) = delete;
+  LockFreeTimeKeeper & operator=(LockFreeTimeKeeper &&) = delete;
+
+  /**
+   * @brief Stop the aggregator thread and report the remaining measurements
+   */
+  ~LockFreeTimeKeeper();
+
+  /**
+   * @brief Add a reporter to output the processing time percentiles to an ostream
+   *
+   * @param os Pointer to the ostream object
+   */
+  void add_reporter(std::ostream * os);
+
+  /**
+   * @brief Add a reporter to publish the processing time percentiles to an rclcpp publisher
+   *
+   * @param publisher Shared pointer to the rclcpp publisher
+   */
+  void add_reporter(rclcpp::Publisher<ProcessingTimeDetail>::SharedPtr publisher);
+
+  /**
+   * @brief Start tracking the processing time of a scope in the calling thread
+   *
+   * @param scope_id Identifier of the scope
+   */
+  void start_track(const ScopeId scope_id);
+
+  /**
+   * @brief End tracking the processing time of a scope in the calling thread
+   *
+   * @param scope_id Identifier of the scope, must be the last started scope of the thread
+   */
+  void end_track(const ScopeId scope_id);
+
+  /**
+   * @brief Drain the buffers of all threads and report the aggregated processing times
+   * @details called periodically by the aggregator thread
+   */
+  void report();
+
+  /**
+   * @brief Get the number of measurements dropped because a thread buffer was full
+   */
+  size_t dropped_count() const;
+
+private:
+  struct Measurement
+  {
+    ScopeId scope_id;
+    uint64_t path;         //!< Hash of the scopes from the root to this scope
+    uint64_t parent_path;  //!< Hash of the scopes from the root to the parent scope
+    int64_t duration_ns;
+  };
+
+  struct ScopeStackEntry
+  {
+    ScopeId scope_id;
+    uint64_t path;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  /**
+   * @brief Single producer single consumer ring buffer of the measurements of one thread
+   */
+  struct ThreadBuffer
+  {
+    explicit ThreadBuffer(const size_t capacity) : measurements(capacity) {}
+
+    std::vector<Measurement> measurements;
+    std::atomic<size_t> head{0};  //!< Written by the producer thread
+    std::atomic<size_t> tail{0};  //!< Written by the aggregator
+    std::atomic<size_t> dropped{0};
+    // only accessed by the producer thread
+    std::array<ScopeStackEntry, max_depth> stack{};
+    size_t depth{0};
+  };
+
+  struct ScopeStatistics
+  {
+    ScopeId scope_id;
+    uint64_t parent_path;
+    size_t first_seen;  //!< Used to keep a stable order between the reports
+    std::vector<double> processing_times_ms;
+  };
+
+  ThreadBuffer & get_thread_buffer();
+
+  const uint64_t id_;  //!< Unique among all instances, used to identify the thread-local buffers
+  const size_t buffer_capacity_;
+
+  mutable std::mutex buffers_mutex_;
+  std::unordered_map<std::thread::id, std::unique_ptr<ThreadBuffer>> buffers_;
+
+  std::mutex report_mutex_;
+  std::unordered_map<uint64_t, ScopeStatistics> statistics_;
+  size_t reported_dropped_count_{0};
+  std::vector<std::function<void(const std::shared_ptr<ProcessingTimeNode> &)>>
+    reporters_;  //!< Vector of functions for reporting the processing times
+
+  std::mutex aggregator_mutex_;
+  std::condition_variable aggregator_cv_;
+  bool stop_aggregator_{false};
+  std::thread aggregator_thread_;
+};
+
+/**
+ * @brief Class for automatically tracking the processing time of a scope with a LockFreeTimeKeeper
+ * @details usage:
+ * @code
+ * static const auto scope_id = autoware::universe_utils::register_scope("func_a");
+ * autoware::universe_utils::LockFreeScopedTimeTrack st(scope_id, time_keeper);
+ * @endcode
+ */
+class LockFreeScopedTimeTrack
+{
+public:
+  /**
+   * @brief Construct a new LockFreeScopedTimeTrack object
+   *
+   * @param scope_id Identifier of the scope to be tracked
+   * @param time_keeper Reference to the LockFreeTimeKeeper object
+   */
+  LockFreeScopedTimeTrack(const ScopeId scope_id, LockFreeTimeKeeper & time_keeper);
+
+  LockFreeScopedTimeTrack(const LockFreeScopedTimeTrack &) = delete;
+  LockFreeScopedTimeTrack & operator=(const LockFreeScopedTimeTrack &) = delete;
+  LockFreeScopedTimeTrack(LockFreeScopedTimeTrack &&) = delete;
+  LockFreeScopedTimeTrack & operator=(LockFreeScopedTimeTrack &&) = delete;
+
+  /**
+   * @brief Destroy the LockFreeScopedTimeTrack object, ending the tracking of the scope
+   */
+  ~LockFreeScopedTimeTrack();
+
+private:
+  const ScopeId scope_id_;            //!< Identifier of the scope being tracked
+  LockFreeTimeKeeper & time_keeper_;  //!< Reference to the LockFreeTimeKeeper object
+};
+}  // namespace autoware::universe_utils
+
+#endif  // AUTOWARE__UNIVERSE_UTILS__SYSTEM__LOCK_FREE_TIME_KEEPER_HPP_
@@ -0,0 +1,414 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/geometry/convex_polygon_batch.hpp"
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+namespace
+{
+// 4 double lanes ---------------------------------------------------------------------------------
+#if defined(__AVX__)
+struct Lanes
+{
+  __m256d v;
+};
+
+inline Lanes load(const double * p)
+{
+  return {_mm256_loadu_pd(p)};
+}
+inline Lanes broadcast(const double d)
+{
+  return {_mm256_set1_pd(d)};
+}
+inline Lanes dot(const Lanes & nx, const Lanes & ny, const Lanes & x, const Lanes & y)
+{
+  return {_mm256_add_pd(_mm256_mul_pd(nx.v, x.v), _mm256_mul_pd(ny.v, y.v))};
+}
+inline Lanes min(const Lanes & a, const Lanes & b)
+{
+  return {_mm256_min_pd(a.v, b.v)};
+}
+inline Lanes max(const Lanes & a, const Lanes & b)
+{
+  return {_mm256_max_pd(a.v, b.v)};
+}
+inline bool any_less(const Lanes & a, const Lanes & b)
+{
+  return _mm256_movemask_pd(_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)) != 0;
+}
+inline bool any_less_equal(const Lanes & a, const Lanes & b)
+{
+  return _mm256_movemask_pd(_mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ)) != 0;
+}
+#elif defined(__SSE2__)
+struct Lanes
+{
+  __m128d lo;
+  __m128d hi;
+};
+
+inline Lanes load(const double * p)
+{
+  return {_mm_loadu_pd(p), _mm_loadu_pd(p + 2)};
+}
+inline Lanes broadcast(const double d)
+{
+  return {_mm_set1_pd(d), _mm_set1_pd(d)};
+}
+inline Lanes dot(const Lanes & nx, const Lanes & ny, const Lanes & x, const Lanes & y)
+{
+  return {
+    _mm_add_pd(_mm_mul_pd(nx.lo, x.lo), _mm_mul_pd(ny.lo, y.lo)),
+    _mm_add_pd(_mm_mul_pd(nx.hi, x.hi), _mm_mul_pd(ny.hi, y.hi))};
+}
+inline Lanes min(const Lanes & a, const Lanes & b)
+{
+  return {_mm_min_pd(a.lo, b.lo), _mm_min_pd(a.hi, b.hi)};
+}
+inline Lanes max(const Lanes & a, const Lanes & b)
+{
+  return {_mm_max_pd(a.lo, b.lo), _mm_max_pd(a.hi, b.hi)};
+}
+inline bool any_less(const Lanes & a, const Lanes & b)
+{
+  return _mm_movemask_pd(_mm_or_pd(_mm_cmplt_pd(a.lo, b.lo), _mm_cmplt_pd(a.hi, b.hi))) != 0;
+}
+inline bool any_less_equal(const Lanes & a, const Lanes & b)
+{
+  return _mm_movemask_pd(_mm_or_pd(_mm_cmple_pd(a.lo, b.lo), _mm_cmple_pd(a.hi, b.hi))) != 0;
+}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+struct Lanes
+{
+  float64x2_t lo;
+  float64x2_t hi;
+};
+
+inline Lanes load(const double * p)
+{
+  return {vld1q_f64(p), vld1q_f64(p + 2)};
+}
+inline Lanes broadcast(const double d)
+{
+  return {vdupq_n_f64(d), vdupq_n_f64(d)};
+}
+inline Lanes dot(const Lanes & nx, const Lanes & ny, const Lanes & x, const Lanes & y)
+{
+  return {
+    vaddq_f64(vmulq_f64(nx.lo, x.lo), vmulq_f64(ny.lo, y.lo)),
+    vaddq_f64(vmulq_f64(nx.hi, x.hi), vmulq_f64(ny.hi, y.hi))};
+}
+inline Lanes min(const Lanes & a, const Lanes & b)
+{
+  return {vminq_f64(a.lo, b.lo), vminq_f64(a.hi, b.hi)};
+}
+inline Lanes max(const Lanes & a, const Lanes & b)
+{
+  return {vmaxq_f64(a.lo, b.lo), vmaxq_f64(a.hi, b.hi)};
+}
+inline bool any_true(const uint64x2_t & lo, const uint64x2_t & hi)
+{
+  const auto mask = vorrq_u64(lo, hi);
+  return (vgetq_lane_u64(mask, 0) | vgetq_lane_u64(mask, 1)) != 0;
+}
+inline bool any_less(const Lanes & a, const Lanes & b)
+{
+  return any_true(vcltq_f64(a.lo, b.lo), vcltq_f64(a.hi, b.hi));
+}
+inline bool any_less_equal(const Lanes & a, const Lanes & b)
+{
+  return any_true(vcleq_f64(a.lo, b.lo), vcleq_f64(a.hi, b.hi));
+}
+#else
+struct Lanes
+{
+  double v[alt::ConvexPolygon2dBatch::lane_width];
+};
+
+inline Lanes load(const double * p)
+{
+  return {{p[0], p[1], p[2], p[3]}};
+}
+inline Lanes broadcast(const double d)
+{
+  return {{d, d, d, d}};
+}
+inline Lanes dot(const Lanes & nx, const Lanes & ny, const Lanes & x, const Lanes & y)
+{
+  Lanes result;
+  for (auto i = 0; i < 4; ++i) result.v[i] = nx.v[i] * x.v[i] + ny.v[i] * y.v[i];
+  return result;
+}
+inline Lanes min(const Lanes & a, const Lanes & b)
+{
+  Lanes result;
+  for (auto i = 0; i < 4; ++i) result.v[i] = std::min(a.v[i], b.v[i]);
+  return result;
+}
+inline Lanes max(const Lanes & a, const Lanes & b)
+{
+  Lanes result;
+  for (auto i = 0; i < 4; ++i) result.v[i] = std::max(a.v[i], b.v[i]);
+  return result;
+}
+inline bool any_less(const Lanes & a, const Lanes & b)
+{
+  for (auto i = 0; i < 4; ++i) {
+    if (a.v[i] < b.v[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+inline bool any_less_equal(const Lanes & a, const Lanes & b)
+{
+  for (auto i = 0; i < 4; ++i) {
+    if (a.v[i] <= b.v[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+#endif
+
+/// @brief pointers to the arrays of one polygon of a batch
+struct PolygonView
+{
+  const double * xs;
+  const double * ys;
+  size_t vertices_nb;
+  const double * normal_xs;
+  const double * normal_ys;
+  const double * normal_mins;
+  const double * normal_maxs;
+  size_t axes_nb;  // multiple of lane_width
+};
+
+PolygonView view(const alt::ConvexPolygon2dBatch & batch, const size_t i)
+{
+  const auto offset = batch.offset(i);
+  return {
+    batch.xs().data() + offset,
+    batch.ys().data() + offset,
+    batch.vertices_nb(i),
+    batch.normal_xs().data() + offset,
+    batch.normal_ys().data() + offset,
+    batch.normal_mins().data() + offset,
+    batch.normal_maxs().data() + offset,
+    batch.offset(i + 1) - offset};
+}
+
+/// @brief project the vertices of a polygon onto the normals of another polygon, lane_width normals
+/// at a time, and return true as soon as the predicate is true for one group of normals
+/// @param is_failing predicate called with the projection interval of the vertices and the
+/// projection interval of the normals' polygon
+template <class Predicate>
+bool any_axis(const PolygonView & axes, const PolygonView & points, Predicate && is_failing)
+{
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  for (auto a = 0UL; a < axes.axes_nb; a += alt::ConvexPolygon2dBatch::lane_width) {
+    const auto nx = load(axes.normal_xs + a);
+    const auto ny = load(axes.normal_ys + a);
+    auto proj_min = broadcast(inf);
+    auto proj_max = broadcast(-inf);
+    for (auto p = 0UL; p < points.vertices_nb; ++p) {
+      const auto projection = dot(nx, ny, broadcast(points.xs[p]), broadcast(points.ys[p]));
+      proj_min = min(proj_min, projection);
+      proj_max = max(proj_max, projection);
+    }
+    if (is_failing(proj_min, proj_max, load(axes.normal_mins + a), load(axes.normal_maxs + a))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool is_same_polygon(const PolygonView & poly1, const PolygonView & poly2)
+{
+  return poly1.vertices_nb == poly2.vertices_nb &&
+         std::equal(poly1.xs, poly1.xs + poly1.vertices_nb, poly2.xs) &&
+         std::equal(poly1.ys, poly1.ys + poly1.vertices_nb, poly2.ys);
+}
+
+bool is_separated(
+  const Lanes & proj_min, const Lanes & proj_max, const Lanes & axis_min, const Lanes & axis_max)
+{
+  return any_less(proj_max, axis_min) || any_less(axis_max, proj_min);
+}
+
+bool is_not_contained(
+  const Lanes & proj_min, const Lanes & proj_max, const Lanes & axis_min, const Lanes & axis_max)
+{
+  return any_less_equal(proj_min, axis_min) || any_less_equal(axis_max, proj_max);
+}
+}  // namespace
+
+namespace alt
+{
+ConvexPolygon2dBatch::ConvexPolygon2dBatch(const std::vector<ConvexPolygon2d> & polygons)
+{
+  reserve(polygons.size());
+  for (const auto & polygon : polygons) {
+    push_back(polygon);
+  }
+}
+
+void ConvexPolygon2dBatch::push_back(const ConvexPolygon2d & polygon)
+{
+  const auto & vertices = polygon.vertices();
+  auto end = vertices.end();
+  if (vertices.size() > 1 && equals(vertices.front(), vertices.back())) {
+    end = std::prev(end);
+  }
+
+  const auto begin_size = xs_.size();
+  auto min_x = std::numeric_limits<double>::max();
+  auto min_y = std::numeric_limits<double>::max();
+  auto max_x = std::numeric_limits<double>::lowest();
+  auto max_y = std::numeric_limits<double>::lowest();
+  for (auto it = vertices.begin(); it != end; ++it) {
+    xs_.push_back(it->x());
+    ys_.push_back(it->y());
+    min_x = std::min(min_x, it->x());
+    min_y = std::min(min_y, it->y());
+    max_x = std::max(max_x, it->x());
+    max_y = std::max(max_y, it->y());
+  }
+  const auto nb = xs_.size() - begin_size;
+  vertices_nb_.push_back(nb);
+  min_xs_.push_back(min_x);
+  min_ys_.push_back(min_y);
+  max_xs_.push_back(max_x);
+  max_ys_.push_back(max_y);
+
+  for (auto i = 0UL; i < nb; ++i) {
+    const auto & x1 = xs_[begin_size + i];
+    const auto & y1 = ys_[begin_size + i];
+    const auto & x2 = xs_[begin_size + (i + 1) % nb];
+    const auto & y2 = ys_[begin_size + (i + 1) % nb];
+    if (x1 == x2 && y1 == y2) {
+      continue;  // no normal for a degenerated edge
+    }
+    const auto nx = y2 - y1;
+    const auto ny = x1 - x2;
+    auto proj_min = std::numeric_limits<double>::max();
+    auto proj_max = std::numeric_limits<double>::lowest();
+    for (auto j = 0UL; j < nb; ++j) {
+      const auto projection = nx * xs_[begin_size + j] + ny * ys_[begin_size + j];
+      proj_min = std::min(proj_min, projection);
+      proj_max = std::max(proj_max, projection);
+    }
+    normal_xs_.push_back(nx);
+    normal_ys_.push_back(ny);
+    normal_mins_.push_back(proj_min);
+    normal_maxs_.push_back(proj_max);
+  }
+
+  // pad the arrays by repeating their last value, repeated vertices and axes do not change results
+  const auto padded_size = begin_size + (nb + lane_width - 1) / lane_width * lane_width;
+  const auto pad = [&](std::vector<double> & values, const double default_value) {
+    values.resize(padded_size, values.size() > begin_size ? values.back() : default_value);
+  };
+  pad(xs_, 0.0);
+  pad(ys_, 0.0);
+  pad(normal_xs_, 0.0);
+  pad(normal_ys_, 0.0);
+  pad(normal_mins_, 0.0);
+  pad(normal_maxs_, 0.0);
+  offsets_.push_back(padded_size);
+}
+
+void ConvexPolygon2dBatch::reserve(const size_t polygons_nb, const size_t vertices_per_polygon)
+{
+  const auto values_nb =
+    polygons_nb * (vertices_per_polygon + lane_width - 1) / lane_width * lane_width;
+  for (auto * values :
+       {&xs_, &ys_, &normal_xs_, &normal_ys_, &normal_mins_, &normal_maxs_}) {
+    values->reserve(values_nb);
+  }
+  for (auto * values : {&min_xs_, &min_ys_, &max_xs_, &max_ys_}) {
+    values->reserve(polygons_nb);
+  }
+  offsets_.reserve(polygons_nb + 1);
+  vertices_nb_.reserve(polygons_nb);
+}
+
+void ConvexPolygon2dBatch::clear() noexcept
+{
+  for (auto * values : {&xs_, &ys_, &normal_xs_, &normal_ys_, &normal_mins_, &normal_maxs_,
+                        &min_xs_, &min_ys_, &max_xs_, &max_ys_}) {
+    values->clear();
+  }
+  offsets_.resize(1);
+  vertices_nb_.clear();
+}
+}  // namespace alt
+
+std::vector<bool> intersects(
+  const alt::ConvexPolygon2d & poly, const alt::ConvexPolygon2dBatch & batch)
+{
+  std::vector<bool> result(batch.size(), false);
+  alt::ConvexPolygon2dBatch query;
+  query.push_back(poly);
+  const auto query_view = view(query, 0);
+  for (auto i = 0UL; i < batch.size(); ++i) {
+    if (
+      batch.max_xs()[i] < query.min_xs()[0] || batch.min_xs()[i] > query.max_xs()[0] ||
+      batch.max_ys()[i] < query.min_ys()[0] || batch.min_ys()[i] > query.max_ys()[0]) {
+      continue;
+    }
+    const auto polygon_view = view(batch, i);
+    result[i] = !any_axis(query_view, polygon_view, is_separated) &&
+                !any_axis(polygon_view, query_view, is_separated);
+  }
+  return result;
+}
+
+std::vector<bool> within(
+  const alt::ConvexPolygon2d & poly_contained, const alt::ConvexPolygon2dBatch & batch)
+{
+  std::vector<bool> result(batch.size(), false);
+  alt::ConvexPolygon2dBatch query;
+  query.push_back(poly_contained);
+  const auto query_view = view(query, 0);
+  for (auto i = 0UL; i < batch.size(); ++i) {
+    if (is_same_polygon(view(batch, i), query_view)) {
+      result[i] = true;
+      continue;
+    }
+    if (
+      batch.min_xs()[i] >= query.min_xs()[0] || batch.max_xs()[i] <= query.max_xs()[0] ||
+      batch.min_ys()[i] >= query.min_ys()[0] || batch.max_ys()[i] <= query.max_ys()[0]) {
+      continue;
+    }
+    // for a convex polygon, the projection onto an edge normal is bounded by the edge itself, so
+    // the contained polygon is inside all edge half-planes iff its projections are inside
+    result[i] = !any_axis(view(batch, i), query_view, is_not_contained);
+  }
+  return result;
+}
+}  // namespace autoware::universe_utils
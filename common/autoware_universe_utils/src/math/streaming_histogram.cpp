@@ -0,0 +1,171 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/math/streaming_histogram.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace autoware::universe_utils
+{
+namespace
+{
+void update_min(std::atomic<double> & min, const double value) noexcept
+{
+  double current = min.load(std::memory_order_relaxed);
+  while (value < current && !min.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+void update_max(std::atomic<double> & max, const double value) noexcept
+{
+  double current = max.load(std::memory_order_relaxed);
+  while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+/// @brief rank of the quantile q among count values (nearest rank)
+uint64_t to_rank(const double q, const uint64_t count)
+{
+  return std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(count))));
+}
+}  // namespace
+
+StreamingHistogram::StreamingHistogram(
+  const double lowest_value, const double highest_value, const size_t sub_bucket_count)
+: lowest_value_(lowest_value),
+  sub_bucket_count_(sub_bucket_count),
+  min_(std::numeric_limits<double>::max()),
+  max_(std::numeric_limits<double>::lowest()),
+  window_min_(std::numeric_limits<double>::max()),
+  window_max_(std::numeric_limits<double>::lowest())
+{
+  if (lowest_value <= 0.0 || highest_value <= lowest_value || sub_bucket_count == 0) {
+    throw std::invalid_argument("StreamingHistogram: invalid range or number of sub buckets");
+  }
+  // the first bucket is for the values below lowest_value
+  const auto power_count = static_cast<size_t>(std::ceil(std::log2(highest_value / lowest_value)));
+  counts_ = std::vector<std::atomic<uint64_t>>(1 + power_count * sub_bucket_count_);
+  for (auto & count : counts_) {
+    count.store(0, std::memory_order_relaxed);
+  }
+  window_begin_counts_.assign(counts_.size(), 0);
+  counts_snapshot_.assign(counts_.size(), 0);
+}
+
+size_t StreamingHistogram::to_bucket_index(const double value) const noexcept
+{
+  const double ratio = value / lowest_value_;
+  if (!(ratio >= 1.0)) {
+    return 0;
+  }
+  // ratio = mantissa * 2^exponent with mantissa in [0.5, 1)
+  int exponent = 0;
+  const double mantissa = std::frexp(ratio, &exponent);
+  const auto sub_bucket =
+    static_cast<size_t>((2.0 * mantissa - 1.0) * static_cast<double>(sub_bucket_count_));
+  const auto index =
+    1 + static_cast<size_t>(exponent - 1) * sub_bucket_count_ +
+    std::min(sub_bucket, sub_bucket_count_ - 1);
+  return std::min(index, counts_.size() - 1);
+}
+
+double StreamingHistogram::to_bucket_value(const size_t index) const
+{
+  if (index == 0) {
+    return 0.5 * lowest_value_;
+  }
+  const auto power = (index - 1) / sub_bucket_count_;
+  const auto sub_bucket = (index - 1) % sub_bucket_count_;
+  const double sub_bucket_center =
+    1.0 + (static_cast<double>(sub_bucket) + 0.5) / static_cast<double>(sub_bucket_count_);
+  return std::ldexp(lowest_value_ * sub_bucket_center, static_cast<int>(power));
+}
+
+void StreamingHistogram::add(double value) noexcept
+{
+  value = std::max(value, 0.0);
+  counts_[to_bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+  double sum = sum_.load(std::memory_order_relaxed);
+  while (!sum_.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {
+  }
+  update_min(min_, value);
+  update_max(max_, value);
+  update_min(window_min_, value);
+  update_max(window_max_, value);
+}
+
+StreamingSummary StreamingHistogram::summarize(
+  const std::vector<uint64_t> & counts, const double sum, const double min, const double max) const
+{
+  StreamingSummary summary;
+  for (const auto count : counts) {
+    summary.count += count;
+  }
+  if (summary.count == 0) {
+    return summary;
+  }
+  summary.mean = sum / static_cast<double>(summary.count);
+  summary.min = min;
+  summary.max = std::max(min, max);
+
+  // the quantiles are found in a single pass over the buckets in increasing order
+  const std::array<uint64_t, 3> ranks{
+    to_rank(0.50, summary.count), to_rank(0.95, summary.count), to_rank(0.99, summary.count)};
+  std::array<double *, 3> quantiles{&summary.p50, &summary.p95, &summary.p99};
+  size_t quantile_index = 0;
+  uint64_t cumulative_count = 0;
+  for (size_t i = 0; i < counts.size() && quantile_index < ranks.size(); ++i) {
+    cumulative_count += counts[i];
+    while (quantile_index < ranks.size() && cumulative_count >= ranks[quantile_index]) {
+      *quantiles[quantile_index++] = std::clamp(to_bucket_value(i), summary.min, summary.max);
+    }
+  }
+  return summary;
+}
+
+StreamingSummary StreamingHistogram::summary() const
+{
+  std::vector<uint64_t> counts(counts_.size());
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    counts[i] = counts_[i].load(std::memory_order_relaxed);
+  }
+  return summarize(
+    counts, sum_.load(std::memory_order_relaxed), min_.load(std::memory_order_relaxed),
+    max_.load(std::memory_order_relaxed));
+}
+
+StreamingSummary StreamingHistogram::take_window_summary()
+{
+  // the counts are not reset so that add() only needs relaxed increments, the window is the
+  // difference with the counts at the previous call
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    const auto count = counts_[i].load(std::memory_order_relaxed);
+    counts_snapshot_[i] = count - window_begin_counts_[i];
+    window_begin_counts_[i] = count;
+  }
+  const double sum = sum_.load(std::memory_order_relaxed);
+  const double window_sum = sum - window_begin_sum_;
+  window_begin_sum_ = sum;
+  const double min =
+    window_min_.exchange(std::numeric_limits<double>::max(), std::memory_order_relaxed);
+  const double max =
+    window_max_.exchange(std::numeric_limits<double>::lowest(), std::memory_order_relaxed);
+  return summarize(counts_snapshot_, window_sum, min, max);
+}
+
+}  // namespace autoware::universe_utils
@@ -0,0 +1,307 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/system/lock_free_time_keeper.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+namespace
+{
+struct ScopeRegistry
+{
+  std::mutex mutex;
+  std::vector<std::string> names;
+  std::unordered_map<std::string, ScopeId> ids;
+};
+
+ScopeRegistry & get_scope_registry()
+{
+  static ScopeRegistry registry;
+  return registry;
+}
+
+uint64_t combine_path(const uint64_t parent_path, const ScopeId scope_id)
+{
+  // boost::hash_combine with a 64 bits constant
+  return parent_path ^ (static_cast<uint64_t>(scope_id) + 0x9e3779b97f4a7c15ULL +
+                        (parent_path << 6U) + (parent_path >> 2U));
+}
+
+constexpr uint64_t root_path = 0;
+
+size_t next_power_of_2(const size_t n)
+{
+  size_t power = 1;
+  while (power < n) {
+    power <<= 1U;
+  }
+  return power;
+}
+
+/// @brief value at the given quantile of sorted values (nearest rank)
+double quantile(const std::vector<double> & sorted_values, const double q)
+{
+  const auto rank = static_cast<size_t>(q * static_cast<double>(sorted_values.size() - 1) + 0.5);
+  return sorted_values[std::min(rank, sorted_values.size() - 1)];
+}
+}  // namespace
+
+ScopeId register_scope(const std::string & name)
+{
+  auto & registry = get_scope_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  const auto [it, inserted] =
+    registry.ids.emplace(name, static_cast<ScopeId>(registry.names.size()));
+  if (inserted) {
+    registry.names.push_back(name);
+  }
+  return it->second;
+}
+
+std::string get_scope_name(const ScopeId scope_id)
+{
+  auto & registry = get_scope_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  return scope_id < registry.names.size() ? registry.names[scope_id] : "unknown";
+}
+
+LockFreeTimeKeeper::LockFreeTimeKeeper(
+  const std::chrono::milliseconds report_period, const size_t buffer_capacity)
+: id_([]() {
+    static std::atomic<uint64_t> next_id{1};
+    return next_id++;
+  }()),
+  buffer_capacity_(next_power_of_2(std::max<size_t>(buffer_capacity, 1)))
+{
+  aggregator_thread_ = std::thread([this, report_period]() {
+    std::unique_lock<std::mutex> lock(aggregator_mutex_);
+    while (!stop_aggregator_) {
+      aggregator_cv_.wait_for(lock, report_period, [this]() { return stop_aggregator_; });
+      lock.unlock();
+      report();
+      lock.lock();
+    }
+  });
+}
+
+LockFreeTimeKeeper::~LockFreeTimeKeeper()
+{
+  {
+    std::lock_guard<std::mutex> lock(aggregator_mutex_);
+    stop_aggregator_ = true;
+  }
+  aggregator_cv_.notify_one();
+  aggregator_thread_.join();
+}
+
+void LockFreeTimeKeeper::add_reporter(std::ostream * os)
+{
+  std::lock_guard<std::mutex> lock(report_mutex_);
+  reporters_.emplace_back([os](const std::shared_ptr<ProcessingTimeNode> & node) {
+    *os << "==========================" << std::endl;
+    *os << node->to_string() << std::endl;
+  });
+}
+
+void LockFreeTimeKeeper::add_reporter(rclcpp::Publisher<ProcessingTimeDetail>::SharedPtr publisher)
+{
+  std::lock_guard<std::mutex> lock(report_mutex_);
+  reporters_.emplace_back([publisher](const std::shared_ptr<ProcessingTimeNode> & node) {
+    publisher->publish(node->to_msg());
+  });
+}
+
+LockFreeTimeKeeper::ThreadBuffer & LockFreeTimeKeeper::get_thread_buffer()
+{
+  // cache of the buffers of the time keepers used by the thread, so that the lock is only taken at
+  // the first call of each thread with each time keeper. The keeper ids are never reused, so the
+  // entries of destroyed keepers are never looked up again.
+  thread_local uint64_t last_keeper_id = 0;
+  thread_local ThreadBuffer * last_buffer = nullptr;
+  thread_local std::unordered_map<uint64_t, ThreadBuffer *> cached_buffers;
+  if (last_keeper_id != id_) {
+    auto & cached_buffer = cached_buffers[id_];
+    if (!cached_buffer) {
+      std::lock_guard<std::mutex> lock(buffers_mutex_);
+      auto & buffer = buffers_[std::this_thread::get_id()];
+      if (!buffer) {
+        buffer = std::make_unique<ThreadBuffer>(buffer_capacity_);
+      }
+      cached_buffer = buffer.get();
+    }
+    last_keeper_id = id_;
+    last_buffer = cached_buffer;
+  }
+  return *last_buffer;
+}
+
+void LockFreeTimeKeeper::start_track(const ScopeId scope_id)
+{
+  auto & buffer = get_thread_buffer();
+  if (buffer.depth < max_depth) {
+    const auto parent_path = buffer.depth == 0 ? root_path : buffer.stack[buffer.depth - 1].path;
+    buffer.stack[buffer.depth] = {
+      scope_id, combine_path(parent_path, scope_id), std::chrono::steady_clock::now()};
+  }
+  ++buffer.depth;
+}
+
+void LockFreeTimeKeeper::end_track(const ScopeId scope_id)
+{
+  const auto end = std::chrono::steady_clock::now();
+  auto & buffer = get_thread_buffer();
+  if (buffer.depth == 0) {
+    throw std::runtime_error(
+      fmt::format("end_track({}) is called without start_track()", get_scope_name(scope_id)));
+  }
+  // the depth is only changed once the scope is known to be the innermost one, so that a wrong
+  // call does not corrupt the stack
+  if (buffer.depth > max_depth) {
+    --buffer.depth;
+    return;
+  }
+  const auto & entry = buffer.stack[buffer.depth - 1];
+  if (entry.scope_id != scope_id) {
+    throw std::runtime_error(fmt::format(
+      "You must call end_track({}) first, but end_track({}) is called",
+      get_scope_name(entry.scope_id), get_scope_name(scope_id)));
+  }
+  --buffer.depth;
+  const auto head = buffer.head.load(std::memory_order_relaxed);
+  if (head - buffer.tail.load(std::memory_order_acquire) >= buffer.measurements.size()) {
+    buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  buffer.measurements[head & (buffer.measurements.size() - 1)] = {
+    scope_id, entry.path, buffer.depth == 0 ? root_path : buffer.stack[buffer.depth - 1].path,
+    std::chrono::duration_cast<std::chrono::nanoseconds>(end - entry.start).count()};
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void LockFreeTimeKeeper::report()
+{
+  std::lock_guard<std::mutex> lock(report_mutex_);
+  {
+    std::lock_guard<std::mutex> buffers_lock(buffers_mutex_);
+    for (auto & [thread_id, buffer] : buffers_) {
+      const auto tail = buffer->tail.load(std::memory_order_relaxed);
+      const auto head = buffer->head.load(std::memory_order_acquire);
+      for (auto i = tail; i < head; ++i) {
+        const auto & measurement =
+          buffer->measurements[i & (buffer->measurements.size() - 1)];
+        auto [it, inserted] = statistics_.try_emplace(
+          measurement.path,
+          ScopeStatistics{
+            measurement.scope_id, measurement.parent_path, statistics_.size(), {}});
+        it->second.processing_times_ms.push_back(
+          static_cast<double>(measurement.duration_ns) * 1e-6);
+      }
+      buffer->tail.store(head, std::memory_order_release);
+    }
+  }
+  const auto total_dropped = dropped_count();
+  const auto dropped = total_dropped - reported_dropped_count_;
+  reported_dropped_count_ = total_dropped;
+
+  // scopes measured during the period, in a stable order
+  std::vector<std::pair<uint64_t, ScopeStatistics *>> measured_scopes;
+  for (auto & [path, statistics] : statistics_) {
+    if (!statistics.processing_times_ms.empty()) {
+      measured_scopes.emplace_back(path, &statistics);
+    }
+  }
+  std::sort(measured_scopes.begin(), measured_scopes.end(), [](const auto & s1, const auto & s2) {
+    return s1.second->first_seen < s2.second->first_seen;
+  });
+
+  // build the call trees, a scope whose parent was not measured during the period becomes a root
+  std::unordered_map<uint64_t, std::shared_ptr<ProcessingTimeNode>> nodes;
+  std::vector<std::shared_ptr<ProcessingTimeNode>> roots;
+  const std::function<std::shared_ptr<ProcessingTimeNode>(uint64_t)> get_node =
+    [&](const uint64_t path) {
+      if (const auto it = nodes.find(path); it != nodes.end()) {
+        return it->second;
+      }
+      auto & statistics = statistics_.at(path);
+      const auto name = get_scope_name(statistics.scope_id);
+      const auto parent_it = statistics_.find(statistics.parent_path);
+      const auto has_parent = parent_it != statistics_.end() &&
+                              !parent_it->second.processing_times_ms.empty();
+      std::shared_ptr<ProcessingTimeNode> node;
+      if (has_parent) {
+        node = get_node(statistics.parent_path)->add_child(name);
+      } else {
+        node = std::make_shared<ProcessingTimeNode>(name);
+        roots.push_back(node);
+      }
+      auto & times = statistics.processing_times_ms;
+      std::sort(times.begin(), times.end());
+      node->set_time(quantile(times, 0.5));
+      auto comment = fmt::format(
+        "count={} p50={:.3f} p90={:.3f} p99={:.3f} max={:.3f} [ms]", times.size(),
+        quantile(times, 0.5), quantile(times, 0.9), quantile(times, 0.99), times.back());
+      if (!has_parent && dropped > 0) {
+        comment += fmt::format(" ({} measurements dropped)", dropped);
+      }
+      node->set_comment(comment);
+      nodes[path] = node;
+      return node;
+    };
+  for (const auto & [path, statistics] : measured_scopes) {
+    get_node(path);
+  }
+
+  for (const auto & root : roots) {
+    for (const auto & reporter : reporters_) {
+      reporter(root);
+    }
+  }
+  for (auto & [path, statistics] : statistics_) {
+    statistics.processing_times_ms.clear();
+  }
+}
+
+size_t LockFreeTimeKeeper::dropped_count() const
+{
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  size_t dropped = 0;
+  for (const auto & [thread_id, buffer] : buffers_) {
+    dropped += buffer->dropped.load(std::memory_order_relaxed);
+  }
+  return dropped;
+}
+
+LockFreeScopedTimeTrack::LockFreeScopedTimeTrack(
+  const ScopeId scope_id, LockFreeTimeKeeper & time_keeper)
+: scope_id_(scope_id), time_keeper_(time_keeper)
+{
+  time_keeper_.start_track(scope_id_);
+}
+
+LockFreeScopedTimeTrack::~LockFreeScopedTimeTrack()  // NOLINT
+{
+  time_keeper_.end_track(scope_id_);
+}
+}  // namespace autoware::universe_utils
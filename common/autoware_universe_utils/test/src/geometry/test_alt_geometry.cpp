@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "autoware/universe_utils/geometry/alt_geometry.hpp"
+#include "autoware/universe_utils/geometry/convex_polygon_batch.hpp"
 #include "autoware/universe_utils/geometry/random_convex_polygon.hpp"
 #include "autoware/universe_utils/system/stop_watch.hpp"
 
@@ -1176,3 +1177,106 @@ TEST(alt_geometry, withinPolygonRand)
       (alt_not_within_ns + alt_within_ns) / 1e6);
   }
 }
+
+TEST(alt_geometry, intersectsBatchRand)
+{
+  std::vector<autoware::universe_utils::Polygon2d> polygons;
+  std::vector<autoware::universe_utils::alt::ConvexPolygon2d> alt_polygons;
+  constexpr auto polygons_nb = 100;
+  constexpr auto max_vertices = 10;
+  constexpr auto max_values = 1000;
+
+  autoware::universe_utils::StopWatch<std::chrono::nanoseconds, std::chrono::nanoseconds> sw;
+  for (auto vertices = 3UL; vertices < max_vertices; ++vertices) {
+    double alt_ns = 0.0;
+    double batch_ns = 0.0;
+    int intersect_count = 0;
+
+    polygons.clear();
+    alt_polygons.clear();
+    for (auto i = 0; i < polygons_nb; ++i) {
+      polygons.push_back(autoware::universe_utils::random_convex_polygon(vertices, max_values));
+      alt_polygons.push_back(
+        autoware::universe_utils::alt::ConvexPolygon2d::create(polygons.back()).value());
+    }
+    const autoware::universe_utils::alt::ConvexPolygon2dBatch batch(alt_polygons);
+    ASSERT_EQ(batch.size(), alt_polygons.size());
+    for (auto i = 0UL; i < alt_polygons.size(); ++i) {
+      sw.tic();
+      const auto batch_results = autoware::universe_utils::intersects(alt_polygons[i], batch);
+      batch_ns += sw.toc();
+      ASSERT_EQ(batch_results.size(), alt_polygons.size());
+      for (auto j = 0UL; j < alt_polygons.size(); ++j) {
+        sw.tic();
+        const auto alt = autoware::universe_utils::intersects(alt_polygons[i], alt_polygons[j]);
+        alt_ns += sw.toc();
+        intersect_count += alt ? 1 : 0;
+
+        if (alt != batch_results[j]) {
+          std::cout << "Batch failed for the 2 polygons: ";
+          std::cout << boost::geometry::wkt(polygons[i]) << boost::geometry::wkt(polygons[j])
+                    << std::endl;
+        }
+        EXPECT_EQ(alt, batch_results[j]);
+      }
+    }
+    std::printf(
+      "polygons_nb = %d, vertices = %ld, %d / %d pairs with intersects\n", polygons_nb, vertices,
+      intersect_count, polygons_nb * polygons_nb);
+    std::printf(
+      "\tTotal:\n\t\tAlt = %2.2f ms\n\t\tBatch = %2.2f ms\n", alt_ns / 1e6, batch_ns / 1e6);
+  }
+}
+
+TEST(alt_geometry, withinBatchRand)
+{
+  std::vector<autoware::universe_utils::Polygon2d> polygons;
+  std::vector<autoware::universe_utils::alt::ConvexPolygon2d> alt_polygons;
+  constexpr auto polygons_nb = 100;
+  constexpr auto max_vertices = 10;
+  constexpr auto max_values = 1000;
+
+  autoware::universe_utils::StopWatch<std::chrono::nanoseconds, std::chrono::nanoseconds> sw;
+  for (auto vertices = 3UL; vertices < max_vertices; ++vertices) {
+    double alt_ns = 0.0;
+    double batch_ns = 0.0;
+    int within_count = 0;
+
+    polygons.clear();
+    alt_polygons.clear();
+    for (auto i = 0; i < polygons_nb; ++i) {
+      polygons.push_back(autoware::universe_utils::random_convex_polygon(vertices, max_values));
+      alt_polygons.push_back(
+        autoware::universe_utils::alt::ConvexPolygon2d::create(polygons.back()).value());
+    }
+    autoware::universe_utils::alt::ConvexPolygon2dBatch batch;
+    batch.reserve(alt_polygons.size(), vertices);
+    for (const auto & alt_polygon : alt_polygons) {
+      batch.push_back(alt_polygon);
+    }
+    for (auto i = 0UL; i < alt_polygons.size(); ++i) {
+      sw.tic();
+      const auto batch_results = autoware::universe_utils::within(alt_polygons[i], batch);
+      batch_ns += sw.toc();
+      ASSERT_EQ(batch_results.size(), alt_polygons.size());
+      for (auto j = 0UL; j < alt_polygons.size(); ++j) {
+        sw.tic();
+        const auto alt = autoware::universe_utils::within(alt_polygons[i], alt_polygons[j]);
+        alt_ns += sw.toc();
+        within_count += alt ? 1 : 0;
+
+        if (alt != batch_results[j]) {
+          std::cout << "Batch failed for the 2 polygons: ";
+          std::cout << boost::geometry::wkt(polygons[i]) << boost::geometry::wkt(polygons[j])
+                    << std::endl;
+        }
+        EXPECT_EQ(alt, batch_results[j]);
+      }
+    }
+    std::printf(
+      "polygons_nb = %d, vertices = %ld, %d / %d pairs with within\n", polygons_nb, vertices,
+      within_count, polygons_nb * polygons_nb);
+    std::printf(
+      "\tTotal:\n\t\tAlt = %2.2f ms\n\t\tBatch = %2.2f ms\n", alt_ns / 1e6, batch_ns / 1e6);
+  }
+}
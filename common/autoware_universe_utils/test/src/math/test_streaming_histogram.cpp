@@ -0,0 +1,140 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/math/streaming_histogram.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using autoware::universe_utils::StreamingHistogram;
+
+namespace
+{
+double exact_quantile(std::vector<double> values, const double q)
+{
+  std::sort(values.begin(), values.end());
+  const auto rank = static_cast<size_t>(std::ceil(q * static_cast<double>(values.size())));
+  return values[std::max<size_t>(rank, 1) - 1];
+}
+}  // namespace
+
+TEST(streaming_histogram, empty)
+{
+  StreamingHistogram histogram;
+  const auto summary = histogram.summary();
+  EXPECT_EQ(summary.count, 0U);
+  EXPECT_DOUBLE_EQ(summary.max, 0.0);
+  EXPECT_DOUBLE_EQ(summary.p99, 0.0);
+  EXPECT_EQ(histogram.take_window_summary().count, 0U);
+
+  EXPECT_THROW(StreamingHistogram(0.0, 1.0), std::invalid_argument);
+  EXPECT_THROW(StreamingHistogram(1.0, 1.0), std::invalid_argument);
+  EXPECT_THROW(StreamingHistogram(1.0, 2.0, 0), std::invalid_argument);
+}
+
+TEST(streaming_histogram, quantiles)
+{
+  constexpr size_t sub_bucket_count = 32;
+  StreamingHistogram histogram(1e-3, 1e6, sub_bucket_count);
+
+  std::mt19937 engine(0);
+  std::lognormal_distribution<double> distribution(3.0, 1.0);
+  std::vector<double> values;
+  for (size_t i = 0; i < 10000; ++i) {
+    values.push_back(distribution(engine));
+    histogram.add(values.back());
+  }
+
+  const auto summary = histogram.summary();
+  const double tolerance = 1.0 / sub_bucket_count;
+  EXPECT_EQ(summary.count, values.size());
+  EXPECT_DOUBLE_EQ(summary.min, *std::min_element(values.begin(), values.end()));
+  EXPECT_DOUBLE_EQ(summary.max, *std::max_element(values.begin(), values.end()));
+  EXPECT_NEAR(summary.p50, exact_quantile(values, 0.50), exact_quantile(values, 0.50) * tolerance);
+  EXPECT_NEAR(summary.p95, exact_quantile(values, 0.95), exact_quantile(values, 0.95) * tolerance);
+  EXPECT_NEAR(summary.p99, exact_quantile(values, 0.99), exact_quantile(values, 0.99) * tolerance);
+}
+
+TEST(streaming_histogram, outOfRangeValues)
+{
+  StreamingHistogram histogram(1.0, 100.0);
+  histogram.add(-1.0);
+  histogram.add(0.5);
+  histogram.add(1000.0);
+
+  const auto summary = histogram.summary();
+  EXPECT_EQ(summary.count, 3U);
+  EXPECT_DOUBLE_EQ(summary.min, 0.0);
+  EXPECT_DOUBLE_EQ(summary.max, 1000.0);
+  EXPECT_LE(summary.p50, 1.0);
+  EXPECT_GE(summary.p99, 100.0);
+  EXPECT_LE(summary.p99, 1000.0);
+}
+
+TEST(streaming_histogram, window)
+{
+  StreamingHistogram histogram;
+  histogram.add(10.0);
+  histogram.add(20.0);
+
+  auto window = histogram.take_window_summary();
+  EXPECT_EQ(window.count, 2U);
+  EXPECT_DOUBLE_EQ(window.mean, 15.0);
+  EXPECT_DOUBLE_EQ(window.max, 20.0);
+
+  histogram.add(1.0);
+  window = histogram.take_window_summary();
+  EXPECT_EQ(window.count, 1U);
+  EXPECT_DOUBLE_EQ(window.min, 1.0);
+  EXPECT_DOUBLE_EQ(window.max, 1.0);
+  EXPECT_DOUBLE_EQ(window.p99, 1.0);
+
+  EXPECT_EQ(histogram.take_window_summary().count, 0U);
+
+  // the window does not affect the statistics of all the values
+  const auto summary = histogram.summary();
+  EXPECT_EQ(summary.count, 3U);
+  EXPECT_DOUBLE_EQ(summary.min, 1.0);
+  EXPECT_DOUBLE_EQ(summary.max, 20.0);
+}
+
+TEST(streaming_histogram, concurrentAdd)
+{
+  StreamingHistogram histogram;
+  constexpr size_t thread_count = 4;
+  constexpr size_t value_count = 10000;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < thread_count; ++t) {
+    threads.emplace_back([&histogram, t]() {
+      for (size_t i = 0; i < value_count; ++i) {
+        histogram.add(static_cast<double>(t + 1));
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  const auto summary = histogram.summary();
+  EXPECT_EQ(summary.count, thread_count * value_count);
+  EXPECT_DOUBLE_EQ(summary.mean, 2.5);
+  EXPECT_DOUBLE_EQ(summary.min, 1.0);
+  EXPECT_DOUBLE_EQ(summary.max, 4.0);
+}
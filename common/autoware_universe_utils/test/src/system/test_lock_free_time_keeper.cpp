@@ -0,0 +1,155 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "autoware/universe_utils/system/lock_free_time_keeper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+class LockFreeTimeKeeperTest : public ::testing::Test
+{
+protected:
+  std::ostringstream oss;
+  std::unique_ptr<autoware::universe_utils::LockFreeTimeKeeper> time_keeper;
+
+  void SetUp() override
+  {
+    // long period such that the reports are only triggered by the tests
+    time_keeper = std::make_unique<autoware::universe_utils::LockFreeTimeKeeper>(
+      std::chrono::hours(1), 1024, &oss);
+  }
+};
+
+TEST(LockFreeTimeKeeper, RegisterScope)
+{
+  using autoware::universe_utils::get_scope_name;
+  using autoware::universe_utils::register_scope;
+
+  const auto id_a = register_scope("scope_a");
+  const auto id_b = register_scope("scope_b");
+  EXPECT_NE(id_a, id_b);
+  EXPECT_EQ(register_scope("scope_a"), id_a);
+  EXPECT_EQ(get_scope_name(id_a), "scope_a");
+  EXPECT_EQ(get_scope_name(id_b), "scope_b");
+}
+
+TEST_F(LockFreeTimeKeeperTest, BasicFunctionality)
+{
+  using autoware::universe_utils::LockFreeScopedTimeTrack;
+  using autoware::universe_utils::register_scope;
+
+  static const auto main_id = register_scope("main_func");
+  static const auto a_id = register_scope("funcA");
+  static const auto b_id = register_scope("funcB");
+  for (auto i = 0; i < 10; ++i) {
+    LockFreeScopedTimeTrack st{main_id, *time_keeper};
+    {
+      LockFreeScopedTimeTrack st{a_id, *time_keeper};
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    {
+      LockFreeScopedTimeTrack st{b_id, *time_keeper};
+    }
+  }
+  time_keeper->report();
+
+  const auto output = oss.str();
+  EXPECT_NE(output.find("main_func"), std::string::npos);
+  EXPECT_NE(output.find("funcA"), std::string::npos);
+  EXPECT_NE(output.find("funcB"), std::string::npos);
+  EXPECT_NE(output.find("count=10"), std::string::npos);
+  // main_func is the root, funcA and funcB are its children
+  EXPECT_NE(output.find("=\nmain_func"), std::string::npos);
+  EXPECT_NE(output.find("── funcA"), std::string::npos);
+  EXPECT_NE(output.find("── funcB"), std::string::npos);
+  EXPECT_EQ(time_keeper->dropped_count(), 0UL);
+}
+
+TEST_F(LockFreeTimeKeeperTest, MultiThread)
+{
+  using autoware::universe_utils::LockFreeScopedTimeTrack;
+  using autoware::universe_utils::register_scope;
+
+  static const auto id = register_scope("thread_func");
+  std::vector<std::thread> threads;
+  for (auto t = 0; t < 4; ++t) {
+    threads.emplace_back([this]() {
+      for (auto i = 0; i < 100; ++i) {
+        LockFreeScopedTimeTrack st{id, *time_keeper};
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  time_keeper->report();
+
+  EXPECT_NE(oss.str().find("thread_func"), std::string::npos);
+  EXPECT_NE(oss.str().find("count=400"), std::string::npos);
+  EXPECT_EQ(time_keeper->dropped_count(), 0UL);
+}
+
+TEST_F(LockFreeTimeKeeperTest, DroppedMeasurements)
+{
+  using autoware::universe_utils::LockFreeScopedTimeTrack;
+  using autoware::universe_utils::register_scope;
+
+  static const auto id = register_scope("overflow");
+  for (auto i = 0; i < 2000; ++i) {
+    LockFreeScopedTimeTrack st{id, *time_keeper};
+  }
+  EXPECT_EQ(time_keeper->dropped_count(), 2000UL - 1024UL);
+  time_keeper->report();
+  EXPECT_NE(oss.str().find("count=1024"), std::string::npos);
+  EXPECT_NE(oss.str().find("976 measurements dropped"), std::string::npos);
+}
+
+TEST_F(LockFreeTimeKeeperTest, WrongEndTrack)
+{
+  using autoware::universe_utils::register_scope;
+
+  const auto id_a = register_scope("scope_a");
+  const auto id_b = register_scope("scope_b");
+  time_keeper->start_track(id_a);
+  EXPECT_THROW(time_keeper->end_track(id_b), std::runtime_error);
+  // the wrong call does not change the stack, so the scope can still be ended
+  EXPECT_NO_THROW(time_keeper->end_track(id_a));
+  EXPECT_THROW(time_keeper->end_track(id_a), std::runtime_error);
+  time_keeper->report();
+  EXPECT_NE(oss.str().find("scope_a"), std::string::npos);
+}
+
+TEST_F(LockFreeTimeKeeperTest, AlternateTimeKeepers)
+{
+  using autoware::universe_utils::LockFreeScopedTimeTrack;
+  using autoware::universe_utils::register_scope;
+
+  std::ostringstream other_oss;
+  autoware::universe_utils::LockFreeTimeKeeper other_time_keeper(
+    std::chrono::hours(1), 1024, &other_oss);
+  static const auto id = register_scope("alternate");
+  for (auto i = 0; i < 10; ++i) {
+    LockFreeScopedTimeTrack st{id, *time_keeper};
+    LockFreeScopedTimeTrack other_st{id, other_time_keeper};
+  }
+  time_keeper->report();
+  other_time_keeper.report();
+  EXPECT_NE(oss.str().find("count=10"), std::string::npos);
+  EXPECT_NE(other_oss.str().find("count=10"), std::string::npos);
+}
@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__NODE_HPP_
 #define AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__NODE_HPP_
 
+#include "autoware/autonomous_emergency_braking/pointcloud_filtering.hpp"
 #include "autoware_utils/system/time_keeper.hpp"
 
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
@@ -44,11 +45,12 @@
 #include <pcl/common/transforms.h>
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
-#include <pcl/surface/convex_hull.h>
 #include <pcl_conversions/pcl_conversions.h>
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <deque>
 #include <limits>
 #include <memory>
@@ -95,6 +97,23 @@ struct ObjectData
   bool is_target{true};
 };
 
+/**
+ * @brief Processing time of a step of the pointcloud pipeline, reported in the diagnostic
+ */
+struct StepProcessingTime
+{
+  double last_ms{0.0};  // time of the current cycle, 0 if the step did not run
+  double max_ms{0.0};   // maximum time of a cycle since the node started
+
+  void startCycle() { last_ms = 0.0; }
+
+  void add(const double time_ms)
+  {
+    last_ms += time_ms;
+    max_ms = std::max(max_ms, last_ms);
+  }
+};
+
 /**
  * @brief Class to manage collision data
  */
@@ -585,6 +604,13 @@ public:
   double mpc_prediction_time_horizon_;
   double mpc_prediction_time_interval_;
   CollisionDataKeeper collision_data_keeper_;
+  // buffers of the pointcloud pipeline, reused between cycles
+  FootprintPathRaster footprint_path_raster_;
+  GridEuclideanClustering grid_clustering_;
+  std::vector<uint32_t> hull_indices_;
+  StepProcessingTime crop_time_;
+  StepProcessingTime clustering_time_;
+  StepProcessingTime predicted_objects_time_;
   // Parameter callback
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
 };
@@ -0,0 +1,144 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__POINTCLOUD_FILTERING_HPP_
+#define AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__POINTCLOUD_FILTERING_HPP_
+
+#include <autoware_utils/geometry/boost_geometry.hpp>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace autoware::motion::control::autonomous_emergency_braking
+{
+using autoware_utils::Point2d;
+using autoware_utils::Polygon2d;
+
+/**
+ * @brief Raster of the convex hull of the ego footprint path, used to crop the obstacle pointcloud
+ * @details the hull is sliced in rows along the y axis. For each row, the x interval covered by the
+ * hull somewhere in the row (outer) and everywhere in the row (inner) are precomputed, so that only
+ * the points between both intervals need an exact point-in-hull test. Building the raster does not
+ * allocate once the internal buffers reached the size of the largest footprint path.
+ */
+class FootprintPathRaster
+{
+public:
+  explicit FootprintPathRaster(const double row_height = 0.1) : row_height_(row_height) {}
+
+  /// @brief build the raster of the convex hull of the vertices of all the polygons
+  void build(const std::vector<Polygon2d> & polygons);
+
+  bool empty() const { return outer_min_x_.empty(); }
+
+  /// @brief return true if the point is inside or on the boundary of the convex hull
+  bool contains(const double x, const double y) const;
+
+  /// @brief vertices of the convex hull in counter-clockwise order
+  const std::vector<Point2d> & hull() const { return hull_; }
+
+private:
+  static constexpr size_t max_rows_nb = 1UL << 16;
+
+  /// @brief x interval of the hull at the given y, which must be in [min_y_, max_y_]
+  std::pair<double, double> spanAt(const double y) const;
+
+  double row_height_;
+  double current_row_height_{0.1};  // increased when the hull spans more than max_rows_nb rows
+  double min_y_{0.0};
+  double max_y_{0.0};
+  std::vector<Point2d> hull_;
+  std::vector<Point2d> hull_buffer_;
+  std::vector<double> outer_min_x_;
+  std::vector<double> outer_max_x_;
+  std::vector<double> inner_min_x_;
+  std::vector<double> inner_max_x_;
+};
+
+/**
+ * @brief Euclidean clustering of a pointcloud with a flat 2D grid instead of a kd-tree
+ * @details the clusters are the connected components of the graph linking the points closer than
+ * the tolerance, as with pcl::EuclideanClusterExtraction. The points are bucketed by xy cell of the
+ * size of the tolerance so that only the points of neighboring cells are compared, and the
+ * components are merged with a union-find. The indices of all the clusters are stored contiguously
+ * in a single buffer that is reused between calls, so that extracting the clusters does not
+ * allocate once the buffers reached the size of the largest pointcloud.
+ */
+class GridEuclideanClustering
+{
+public:
+  /**
+   * @brief Range of the indices of the points of a cluster
+   */
+  struct IndexRange
+  {
+    const uint32_t * first;
+    const uint32_t * last;
+    const uint32_t * begin() const { return first; }
+    const uint32_t * end() const { return last; }
+    size_t size() const { return static_cast<size_t>(last - first); }
+  };
+
+  /**
+   * @brief extract the clusters of the finite points of the pointcloud
+   * @param points pointcloud
+   * @param tolerance maximum distance between two neighboring points of a cluster
+   * @param min_cluster_size clusters with less points are discarded
+   * @param max_cluster_size clusters with more points are discarded
+   */
+  void extract(
+    const pcl::PointCloud<pcl::PointXYZ> & points, const double tolerance,
+    const size_t min_cluster_size, const size_t max_cluster_size);
+
+  size_t size() const { return cluster_starts_.empty() ? 0 : cluster_starts_.size() - 1; }
+
+  IndexRange cluster(const size_t i) const
+  {
+    const auto * indices = cluster_indices_.data();
+    return {indices + cluster_starts_[i], indices + cluster_starts_[i + 1]};
+  }
+
+  /**
+   * @brief compute the 2D convex hull of the points of a cluster
+   * @param points pointcloud given to extract()
+   * @param i index of the cluster
+   * @param hull_indices output: indices of the points of the hull in counter-clockwise order
+   */
+  void computeConvexHull(
+    const pcl::PointCloud<pcl::PointXYZ> & points, const size_t i,
+    std::vector<uint32_t> & hull_indices);
+
+private:
+  static constexpr size_t max_cells_nb = 1UL << 20;
+
+  uint32_t findRoot(uint32_t i);
+
+  std::vector<uint32_t> cell_starts_;
+  std::vector<uint32_t> point_cells_;   // buffer of the cell of each point
+  std::vector<uint32_t> sorted_points_;  // buffer of the point indices sorted by cell
+  std::vector<uint32_t> parents_;       // union-find forest over the sorted points
+  std::vector<uint32_t> component_sizes_;
+  std::vector<uint32_t> component_clusters_;
+  std::vector<uint32_t> cluster_starts_;
+  std::vector<uint32_t> cluster_indices_;
+  std::vector<uint32_t> hull_buffer_;
+};
+}  // namespace autoware::motion::control::autonomous_emergency_braking
+
+#endif  // AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__POINTCLOUD_FILTERING_HPP_
@@ -22,15 +22,20 @@
 #include <autoware_utils/geometry/geometry.hpp>
 #include <autoware_utils/ros/marker_helper.hpp>
 #include <autoware_utils/ros/update_param.hpp>
+#include <autoware_utils/system/stop_watch.hpp>
 #include <pcl_ros/transforms.hpp>
 #include <rclcpp/node.hpp>
 #include <tf2/utils.hpp>
 
 #include <geometry_msgs/msg/polygon.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
 
 #include <boost/geometry/algorithms/convex_hull.hpp>
 #include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
 #include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
 #include <boost/geometry/algorithms/within.hpp>
 #include <boost/version.hpp>
 
@@ -43,13 +48,11 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 
 #include <pcl/PCLPointCloud2.h>
-#include <pcl/filters/crop_hull.h>
 #include <pcl/filters/extract_indices.h>
 #include <pcl/filters/passthrough.h>
 #include <pcl/filters/voxel_grid.h>
 #include <pcl/point_types.h>
 #include <pcl/registration/gicp.h>
-#include <pcl/segmentation/extract_clusters.h>
 
 #include <algorithm>
 #include <cmath>
@@ -443,6 +446,15 @@ void AEB::onCheckCollision(DiagnosticStatusWrapper & stat)
     stat.summary(diag_level, error_msg);
   }
 
+  // processing time of the pointcloud pipeline steps
+  const auto add_step_time = [&](const std::string & step, const StepProcessingTime & time) {
+    stat.addf(step + " Time [ms]", "%.3f", time.last_ms);
+    stat.addf(step + " Max Time [ms]", "%.3f", time.max_ms);
+  };
+  add_step_time("Crop", crop_time_);
+  add_step_time("Clustering", clustering_time_);
+  add_step_time("Predicted Objects", predicted_objects_time_);
+
   // publish debug markers
   debug_marker_publisher_->publish(debug_markers);
   virtual_wall_publisher_->publish(virtual_wall_marker);
@@ -454,6 +466,9 @@ void AEB::onCheckCollision(DiagnosticStatusWrapper & stat)
 bool AEB::checkCollision(MarkerArray & debug_markers)
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  crop_time_.startCycle();
+  clustering_time_.startCycle();
+  predicted_objects_time_.startCycle();
 
   // step1. check data
   if (!fetchLatestData()) {
@@ -785,6 +800,7 @@ void AEB::createObjectDataUsingPredictedObjects(
   std::vector<ObjectData> & object_data_vector)
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
   if (predicted_objects_ptr_->objects.empty() || ego_polys.empty()) return;
 
   const double current_ego_speed = current_velocity_ptr_->longitudinal_velocity;
@@ -823,17 +839,34 @@ void AEB::createObjectDataUsingPredictedObjects(
   if (!longitudinal_offset_opt.has_value()) return;
   const auto longitudinal_offset = longitudinal_offset_opt.value();
 
+  // Bounding boxes of the ego footprints, the exact intersection is only computed with the
+  // footprints whose box overlaps the box of an object
+  std::vector<autoware_utils::Box2d> ego_boxes;
+  ego_boxes.reserve(ego_polys.size());
+  for (const auto & ego_poly : ego_polys) {
+    ego_boxes.push_back(bg::return_envelope<autoware_utils::Box2d>(ego_poly));
+  }
+  auto path_box = ego_boxes.front();
+  for (const auto & ego_box : ego_boxes) {
+    bg::expand(path_box, ego_box);
+  }
+
   // Check which objects collide with the ego footprints
   std::for_each(objects.begin(), objects.end(), [&](const auto & predicted_object) {
     // get objects in base_link frame
     const auto & transform_stamped = transform_stamped_opt.value();
     const auto t_predicted_object =
       utils::transformObjectFrame(predicted_object, transform_stamped);
-    const auto & obj_pose = t_predicted_object.kinematics.initial_pose_with_covariance.pose;
     const auto obj_poly = convertObjToPolygon(t_predicted_object);
+    const auto obj_box = bg::return_envelope<autoware_utils::Box2d>(obj_poly);
+    if (!bg::intersects(path_box, obj_box)) return;
+
+    const auto & obj_pose = t_predicted_object.kinematics.initial_pose_with_covariance.pose;
     const double obj_tangent_velocity = get_object_tangent_velocity(t_predicted_object, obj_pose);
 
-    for (const auto & ego_poly : ego_polys) {
+    for (size_t i = 0; i < ego_polys.size(); ++i) {
+      if (!bg::intersects(ego_boxes.at(i), obj_box)) continue;
+      const auto & ego_poly = ego_polys.at(i);
       // check collision with 2d polygon
       std::vector<Point2d> collision_points_bg;
       bg::intersection(ego_poly, obj_poly, collision_points_bg);
@@ -866,6 +899,7 @@ void AEB::createObjectDataUsingPredictedObjects(
       if (collision_points_added) break;
     }
   });
+  predicted_objects_time_.add(stop_watch.toc());
 }
 
 void AEB::getPointsBelongingToClusterHulls(
@@ -873,43 +907,27 @@ void AEB::getPointsBelongingToClusterHulls(
   const PointCloud::Ptr points_belonging_to_cluster_hulls, MarkerArray & debug_markers)
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
   // eliminate noisy points by only considering points belonging to clusters of at least a certain
   // size
   if (obstacle_points_ptr->empty()) return;
-  const std::vector<pcl::PointIndices> cluster_indices = std::invoke([&]() {
-    std::vector<pcl::PointIndices> cluster_idx;
-    pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
-    tree->setInputCloud(obstacle_points_ptr);
-    pcl::EuclideanClusterExtraction<pcl::PointXYZ> ec;
-    ec.setClusterTolerance(cluster_tolerance_);
-    ec.setMinClusterSize(minimum_cluster_size_);
-    ec.setMaxClusterSize(maximum_cluster_size_);
-    ec.setSearchMethod(tree);
-    ec.setInputCloud(obstacle_points_ptr);
-    ec.extract(cluster_idx);
-    return cluster_idx;
-  });
+  grid_clustering_.extract(
+    *obstacle_points_ptr, cluster_tolerance_,
+    static_cast<size_t>(std::max(minimum_cluster_size_, 0)),
+    static_cast<size_t>(std::max(maximum_cluster_size_, 0)));
   std::vector<Polygon3d> hull_polygons;
-  for (const auto & indices : cluster_indices) {
-    PointCloud::Ptr cluster(new PointCloud);
-    bool cluster_surpasses_threshold_height{false};
-    for (const auto & index : indices.indices) {
-      const auto & p = (*obstacle_points_ptr)[index];
-      cluster_surpasses_threshold_height = (cluster_surpasses_threshold_height)
-                                             ? cluster_surpasses_threshold_height
-                                             : (p.z > cluster_minimum_height_);
-      cluster->push_back(p);
-    }
+  for (size_t i = 0; i < grid_clustering_.size(); ++i) {
+    const auto cluster = grid_clustering_.cluster(i);
+    const bool cluster_surpasses_threshold_height =
+      std::any_of(cluster.begin(), cluster.end(), [&](const uint32_t index) {
+        return (*obstacle_points_ptr)[index].z > cluster_minimum_height_;
+      });
     if (!cluster_surpasses_threshold_height) continue;
     // Make a 2d convex hull for the objects
-    pcl::ConvexHull<pcl::PointXYZ> hull;
-    hull.setDimension(2);
-    hull.setInputCloud(cluster);
-    std::vector<pcl::Vertices> polygons;
-    PointCloud::Ptr surface_hull(new PointCloud);
-    hull.reconstruct(*surface_hull, polygons);
+    grid_clustering_.computeConvexHull(*obstacle_points_ptr, i, hull_indices_);
     Polygon3d hull_polygon;
-    for (const auto & p : *surface_hull) {
+    for (const auto index : hull_indices_) {
+      const auto & p = (*obstacle_points_ptr)[index];
       points_belonging_to_cluster_hulls->push_back(p);
       if (publish_debug_markers_) {
         const auto geom_point = autoware_utils::create_point(p.x, p.y, p.z);
@@ -918,6 +936,7 @@ void AEB::getPointsBelongingToClusterHulls(
     }
     hull_polygons.push_back(hull_polygon);
   }
+  clustering_time_.add(stop_watch.toc());
   if (publish_debug_markers_ && !hull_polygons.empty()) {
     constexpr colorTuple debug_color = {255.0 / 256.0, 51.0 / 256.0, 255.0 / 256.0, 0.999};
     addClusterHullMarkers(now(), hull_polygons, debug_color, "hulls", debug_markers);
@@ -955,34 +974,29 @@ void AEB::cropPointCloudWithEgoFootprintPath(
   const std::vector<Polygon2d> & ego_polys, PointCloud::Ptr filtered_objects)
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
   if (ego_polys.empty()) {
     return;
   }
-  PointCloud::Ptr full_points_ptr(new PointCloud);
-  pcl::fromROSMsg(*obstacle_ros_pointcloud_ptr_, *full_points_ptr);
-  // Create a Point cloud with the points of the ego footprint
-  PointCloud::Ptr path_polygon_points(new PointCloud);
-  std::for_each(ego_polys.begin(), ego_polys.end(), [&](const auto & poly) {
-    std::for_each(poly.outer().begin(), poly.outer().end(), [&](const auto & p) {
-      pcl::PointXYZ point(p.x(), p.y(), 0.0);
-      path_polygon_points->push_back(point);
-    });
-  });
-  // Make a surface hull with the ego footprint to filter out points
-  pcl::ConvexHull<pcl::PointXYZ> hull;
-  hull.setDimension(2);
-  hull.setInputCloud(path_polygon_points);
-  std::vector<pcl::Vertices> polygons;
-  PointCloud::Ptr surface_hull(new PointCloud);
-  hull.reconstruct(*surface_hull, polygons);
+  // Rasterize the convex hull of the ego footprint path to filter out points
+  footprint_path_raster_.build(ego_polys);
   // Filter out points outside of the path's convex hull
-  pcl::CropHull<pcl::PointXYZ> path_polygon_hull_filter;
-  path_polygon_hull_filter.setDim(2);
-  path_polygon_hull_filter.setInputCloud(full_points_ptr);
-  path_polygon_hull_filter.setHullIndices(polygons);
-  path_polygon_hull_filter.setHullCloud(surface_hull);
-  path_polygon_hull_filter.filter(*filtered_objects);
-  filtered_objects->header = full_points_ptr->header;
+  const auto & pointcloud = *obstacle_ros_pointcloud_ptr_;
+  const size_t points_nb = static_cast<size_t>(pointcloud.width) * pointcloud.height;
+  filtered_objects->clear();
+  filtered_objects->reserve(points_nb);
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(pointcloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(pointcloud, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(pointcloud, "z");
+  for (size_t i = 0; i < points_nb; ++i, ++iter_x, ++iter_y, ++iter_z) {
+    const bool is_finite =
+      std::isfinite(*iter_x) && std::isfinite(*iter_y) && std::isfinite(*iter_z);
+    if (is_finite && footprint_path_raster_.contains(*iter_x, *iter_y)) {
+      filtered_objects->push_back(pcl::PointXYZ(*iter_x, *iter_y, *iter_z));
+    }
+  }
+  pcl_conversions::toPCL(pointcloud.header, filtered_objects->header);
+  crop_time_.add(stop_watch.toc());
 }
 
 void AEB::addClusterHullMarkers(
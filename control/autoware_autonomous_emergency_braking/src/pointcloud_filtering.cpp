@@ -0,0 +1,343 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/autonomous_emergency_braking/pointcloud_filtering.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace autoware::motion::control::autonomous_emergency_braking
+{
+namespace
+{
+/**
+ * @brief replace the items by the vertices of their 2D convex hull in counter-clockwise order
+ * @details Andrew's monotone chain, get_xy(item) must return the {x, y} coordinates of an item
+ */
+template <typename T, typename GetXY>
+void convexHullInPlace(std::vector<T> & items, std::vector<T> & buffer, GetXY && get_xy)
+{
+  std::sort(
+    items.begin(), items.end(), [&](const T & a, const T & b) { return get_xy(a) < get_xy(b); });
+  const size_t n = items.size();
+  if (n < 3) {
+    return;
+  }
+  const auto cross = [&](const T & o, const T & a, const T & b) {
+    const auto [ox, oy] = get_xy(o);
+    const auto [ax, ay] = get_xy(a);
+    const auto [bx, by] = get_xy(b);
+    return (ax - ox) * (by - oy) - (ay - oy) * (bx - ox);
+  };
+  buffer.resize(2 * n);
+  size_t k = 0;
+  // lower hull
+  for (size_t i = 0; i < n; ++i) {
+    while (k >= 2 && cross(buffer[k - 2], buffer[k - 1], items[i]) <= 0.0) {
+      --k;
+    }
+    buffer[k++] = items[i];
+  }
+  // upper hull
+  for (size_t i = n - 1, lower_size = k + 1; i > 0; --i) {
+    while (k >= lower_size && cross(buffer[k - 2], buffer[k - 1], items[i - 1]) <= 0.0) {
+      --k;
+    }
+    buffer[k++] = items[i - 1];
+  }
+  // the last vertex is the first one
+  buffer.resize(k - 1);
+  std::swap(items, buffer);
+}
+}  // namespace
+
+void FootprintPathRaster::build(const std::vector<Polygon2d> & polygons)
+{
+  hull_.clear();
+  outer_min_x_.clear();
+  outer_max_x_.clear();
+  inner_min_x_.clear();
+  inner_max_x_.clear();
+  for (const auto & polygon : polygons) {
+    hull_.insert(hull_.end(), polygon.outer().begin(), polygon.outer().end());
+  }
+  if (hull_.empty()) {
+    return;
+  }
+  convexHullInPlace(
+    hull_, hull_buffer_, [](const Point2d & p) { return std::make_pair(p.x(), p.y()); });
+
+  const auto [min_it, max_it] = std::minmax_element(
+    hull_.begin(), hull_.end(), [](const auto & a, const auto & b) { return a.y() < b.y(); });
+  min_y_ = min_it->y();
+  max_y_ = max_it->y();
+  current_row_height_ = row_height_;
+  const auto rows_nb = [&]() {
+    return static_cast<size_t>((max_y_ - min_y_) / current_row_height_) + 1;
+  };
+  while (rows_nb() > max_rows_nb) {
+    current_row_height_ *= 2.0;
+  }
+
+  const auto rows = rows_nb();
+  outer_min_x_.resize(rows);
+  outer_max_x_.resize(rows);
+  inner_min_x_.resize(rows);
+  inner_max_x_.resize(rows);
+  auto [bottom_min_x, bottom_max_x] = spanAt(min_y_);
+  for (size_t row = 0; row < rows; ++row) {
+    const auto row_min_y = min_y_ + static_cast<double>(row) * current_row_height_;
+    const auto row_max_y = std::min(row_min_y + current_row_height_, max_y_);
+    const auto [top_min_x, top_max_x] = spanAt(row_max_y);
+    // the left boundary of a convex polygon is convex and the right one concave in y, so the
+    // interval covered by the whole row is bounded by the spans at the bottom and top of the row
+    inner_min_x_[row] = std::max(bottom_min_x, top_min_x);
+    inner_max_x_[row] = std::min(bottom_max_x, top_max_x);
+    // and the extrema of the row are reached at these spans or at the vertices in the row
+    outer_min_x_[row] = std::min(bottom_min_x, top_min_x);
+    outer_max_x_[row] = std::max(bottom_max_x, top_max_x);
+    for (const auto & p : hull_) {
+      if (row_min_y < p.y() && p.y() < row_max_y) {
+        outer_min_x_[row] = std::min(outer_min_x_[row], p.x());
+        outer_max_x_[row] = std::max(outer_max_x_[row], p.x());
+      }
+    }
+    bottom_min_x = top_min_x;
+    bottom_max_x = top_max_x;
+  }
+}
+
+std::pair<double, double> FootprintPathRaster::spanAt(const double y) const
+{
+  double min_x = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  for (size_t i = 0; i < hull_.size(); ++i) {
+    const auto & a = hull_[i];
+    const auto & b = hull_[(i + 1) % hull_.size()];
+    if (y < std::min(a.y(), b.y()) || std::max(a.y(), b.y()) < y) {
+      continue;
+    }
+    if (a.y() == b.y()) {
+      min_x = std::min({min_x, a.x(), b.x()});
+      max_x = std::max({max_x, a.x(), b.x()});
+      continue;
+    }
+    const auto x = a.x() + (y - a.y()) * (b.x() - a.x()) / (b.y() - a.y());
+    min_x = std::min(min_x, x);
+    max_x = std::max(max_x, x);
+  }
+  return {min_x, max_x};
+}
+
+bool FootprintPathRaster::contains(const double x, const double y) const
+{
+  if (empty() || y < min_y_ || max_y_ < y) {
+    return false;
+  }
+  const auto row =
+    std::min(static_cast<size_t>((y - min_y_) / current_row_height_), outer_min_x_.size() - 1);
+  if (x < outer_min_x_[row] || outer_max_x_[row] < x) {
+    return false;
+  }
+  if (inner_min_x_[row] <= x && x <= inner_max_x_[row]) {
+    return true;
+  }
+  const auto [min_x, max_x] = spanAt(y);
+  return min_x <= x && x <= max_x;
+}
+
+uint32_t GridEuclideanClustering::findRoot(uint32_t i)
+{
+  while (parents_[i] != i) {
+    // path halving
+    parents_[i] = parents_[parents_[i]];
+    i = parents_[i];
+  }
+  return i;
+}
+
+void GridEuclideanClustering::extract(
+  const pcl::PointCloud<pcl::PointXYZ> & points, const double tolerance,
+  const size_t min_cluster_size, const size_t max_cluster_size)
+{
+  cluster_starts_.clear();
+  cluster_indices_.clear();
+  const auto is_finite = [](const pcl::PointXYZ & p) {
+    return std::isfinite(p.x) && std::isfinite(p.y) && std::isfinite(p.z);
+  };
+
+  // bounds of the finite points
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  size_t finite_points_nb = 0;
+  for (const auto & p : points) {
+    if (!is_finite(p)) {
+      continue;
+    }
+    min_x = std::min(min_x, static_cast<double>(p.x));
+    min_y = std::min(min_y, static_cast<double>(p.y));
+    max_x = std::max(max_x, static_cast<double>(p.x));
+    max_y = std::max(max_y, static_cast<double>(p.y));
+    ++finite_points_nb;
+  }
+  if (finite_points_nb == 0) {
+    return;
+  }
+
+  // points in non-neighboring cells are farther than the tolerance, which stays true when the cells
+  // are enlarged to bound the size of the grid
+  constexpr double min_cell_size = 1e-3;
+  double cell_size = std::max(tolerance, min_cell_size);
+  size_t cols = 0;
+  size_t rows = 0;
+  const auto update_grid_size = [&]() {
+    cols = static_cast<size_t>((max_x - min_x) / cell_size) + 1;
+    rows = static_cast<size_t>((max_y - min_y) / cell_size) + 1;
+  };
+  update_grid_size();
+  while (cols * rows > max_cells_nb) {
+    cell_size *= 2.0;
+    update_grid_size();
+  }
+
+  // counting sort of the points by cell
+  constexpr auto invalid_index = std::numeric_limits<uint32_t>::max();
+  cell_starts_.assign(cols * rows + 1, 0);
+  point_cells_.resize(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto & p = points[i];
+    if (!is_finite(p)) {
+      point_cells_[i] = invalid_index;
+      continue;
+    }
+    const auto col = std::min(static_cast<size_t>((p.x - min_x) / cell_size), cols - 1);
+    const auto row = std::min(static_cast<size_t>((p.y - min_y) / cell_size), rows - 1);
+    point_cells_[i] = static_cast<uint32_t>(row * cols + col);
+    ++cell_starts_[point_cells_[i] + 1];
+  }
+  std::partial_sum(cell_starts_.begin(), cell_starts_.end(), cell_starts_.begin());
+  sorted_points_.resize(finite_points_nb);
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (point_cells_[i] != invalid_index) {
+      // cell_starts_[cell] is used as the write position and ends at the start of the next cell
+      sorted_points_[cell_starts_[point_cells_[i]]++] = static_cast<uint32_t>(i);
+    }
+  }
+  // restore the start of each cell
+  std::copy_backward(cell_starts_.begin(), cell_starts_.end() - 1, cell_starts_.end());
+  cell_starts_[0] = 0;
+
+  // union of the points closer than the tolerance, each pair of neighboring cells is visited once
+  parents_.resize(finite_points_nb);
+  std::iota(parents_.begin(), parents_.end(), 0U);
+  const double squared_tolerance = tolerance * tolerance;
+  const auto link_if_close = [&](const uint32_t i, const uint32_t j) {
+    const auto & p = points[sorted_points_[i]];
+    const auto & q = points[sorted_points_[j]];
+    const double dx = p.x - q.x;
+    const double dy = p.y - q.y;
+    const double dz = p.z - q.z;
+    if (dx * dx + dy * dy + dz * dz > squared_tolerance) {
+      return;
+    }
+    const auto root_i = findRoot(i);
+    const auto root_j = findRoot(j);
+    if (root_i != root_j) {
+      parents_[std::max(root_i, root_j)] = std::min(root_i, root_j);
+    }
+  };
+  for (size_t row = 0; row < rows; ++row) {
+    for (size_t col = 0; col < cols; ++col) {
+      const auto cell = row * cols + col;
+      const auto begin = cell_starts_[cell];
+      const auto end = cell_starts_[cell + 1];
+      for (auto i = begin; i < end; ++i) {
+        for (auto j = i + 1; j < end; ++j) {
+          link_if_close(i, j);
+        }
+      }
+      // neighbors of the same row on the right and of the next row
+      const auto link_cell = [&](const size_t neighbor_row, const size_t neighbor_col) {
+        if (neighbor_row >= rows || neighbor_col >= cols) {
+          return;
+        }
+        const auto neighbor = neighbor_row * cols + neighbor_col;
+        for (auto i = begin; i < end; ++i) {
+          for (auto j = cell_starts_[neighbor]; j < cell_starts_[neighbor + 1]; ++j) {
+            link_if_close(i, j);
+          }
+        }
+      };
+      if (begin == end) {
+        continue;
+      }
+      link_cell(row, col + 1);
+      if (col > 0) {
+        link_cell(row + 1, col - 1);
+      }
+      link_cell(row + 1, col);
+      link_cell(row + 1, col + 1);
+    }
+  }
+
+  // clusters of the components with a valid size
+  component_sizes_.assign(finite_points_nb, 0);
+  for (uint32_t i = 0; i < finite_points_nb; ++i) {
+    ++component_sizes_[findRoot(i)];
+  }
+  component_clusters_.assign(finite_points_nb, invalid_index);
+  uint32_t clusters_nb = 0;
+  for (uint32_t i = 0; i < finite_points_nb; ++i) {
+    const auto size = component_sizes_[i];
+    if (size > 0 && size >= min_cluster_size && size <= max_cluster_size) {
+      component_clusters_[i] = clusters_nb++;
+    }
+  }
+  cluster_starts_.assign(clusters_nb + 1, 0);
+  for (uint32_t i = 0; i < finite_points_nb; ++i) {
+    const auto cluster = component_clusters_[findRoot(i)];
+    if (cluster != invalid_index) {
+      ++cluster_starts_[cluster + 1];
+    }
+  }
+  std::partial_sum(cluster_starts_.begin(), cluster_starts_.end(), cluster_starts_.begin());
+  cluster_indices_.resize(cluster_starts_.back());
+  for (uint32_t i = 0; i < finite_points_nb; ++i) {
+    const auto cluster = component_clusters_[findRoot(i)];
+    if (cluster != invalid_index) {
+      cluster_indices_[cluster_starts_[cluster]++] = sorted_points_[i];
+    }
+  }
+  std::copy_backward(cluster_starts_.begin(), cluster_starts_.end() - 1, cluster_starts_.end());
+  cluster_starts_[0] = 0;
+}
+
+void GridEuclideanClustering::computeConvexHull(
+  const pcl::PointCloud<pcl::PointXYZ> & points, const size_t i,
+  std::vector<uint32_t> & hull_indices)
+{
+  const auto indices = cluster(i);
+  hull_indices.assign(indices.begin(), indices.end());
+  convexHullInPlace(hull_indices, hull_buffer_, [&](const uint32_t index) {
+    const auto & p = points[index];
+    return std::make_pair(static_cast<double>(p.x), static_cast<double>(p.y));
+  });
+}
+}  // namespace autoware::motion::control::autonomous_emergency_braking
@@ -25,11 +25,19 @@
 #include <geometry_msgs/msg/detail/point__struct.hpp>
 #include <geometry_msgs/msg/detail/pose__struct.hpp>
 
+#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+
 #include <gtest/gtest.h>
 #include <pcl/memory.h>
 
+#include <functional>
 #include <limits>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <random>
+#include <set>
 #include <thread>
 #include <vector>
 
@@ -422,4 +430,106 @@ TEST_F(TestAEB, TestCropPointCloud)
   ASSERT_TRUE(filtered_objects->points.size() == 2 * n_points);
 }
 
+TEST_F(TestAEB, GridEuclideanClusteringMatchesBruteForce)
+{
+  constexpr double tolerance{0.3};
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<float> coordinate(-5.0f, 5.0f);
+  pcl::PointCloud<pcl::PointXYZ> points;
+  for (size_t i = 0; i < 500; ++i) {
+    points.push_back(
+      pcl::PointXYZ(coordinate(generator), coordinate(generator), coordinate(generator) * 0.1f));
+  }
+  points.push_back(pcl::PointXYZ(std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f));
+
+  // connected components of the points closer than the tolerance
+  std::vector<size_t> labels(points.size());
+  std::iota(labels.begin(), labels.end(), 0);
+  const std::function<size_t(size_t)> find = [&](const size_t i) {
+    return labels[i] == i ? i : labels[i] = find(labels[i]);
+  };
+  for (size_t i = 0; i + 1 < points.size(); ++i) {
+    for (size_t j = i + 1; j + 1 < points.size(); ++j) {
+      const auto & p = points[i];
+      const auto & q = points[j];
+      const double squared_distance = (p.x - q.x) * (p.x - q.x) + (p.y - q.y) * (p.y - q.y) +
+                                      (p.z - q.z) * (p.z - q.z);
+      if (squared_distance <= tolerance * tolerance) {
+        labels[find(i)] = find(j);
+      }
+    }
+  }
+  std::map<size_t, std::set<uint32_t>> expected_clusters;
+  for (size_t i = 0; i + 1 < points.size(); ++i) {
+    expected_clusters[find(i)].insert(static_cast<uint32_t>(i));
+  }
+
+  constexpr size_t min_cluster_size{2};
+  constexpr size_t max_cluster_size{50};
+  std::set<std::set<uint32_t>> expected;
+  for (const auto & [label, cluster] : expected_clusters) {
+    if (cluster.size() >= min_cluster_size && cluster.size() <= max_cluster_size) {
+      expected.insert(cluster);
+    }
+  }
+
+  GridEuclideanClustering clustering;
+  clustering.extract(points, tolerance, min_cluster_size, max_cluster_size);
+  std::set<std::set<uint32_t>> clusters;
+  for (size_t i = 0; i < clustering.size(); ++i) {
+    const auto cluster = clustering.cluster(i);
+    clusters.emplace(cluster.begin(), cluster.end());
+  }
+  EXPECT_EQ(clusters, expected);
+
+  // the hull of a cluster contains all its points
+  std::vector<uint32_t> hull_indices;
+  for (size_t i = 0; i < clustering.size(); ++i) {
+    clustering.computeConvexHull(points, i, hull_indices);
+    ASSERT_FALSE(hull_indices.empty());
+    if (hull_indices.size() < 3) continue;
+    for (const auto index : clustering.cluster(i)) {
+      for (size_t v = 0; v < hull_indices.size(); ++v) {
+        const auto & a = points[hull_indices[v]];
+        const auto & b = points[hull_indices[(v + 1) % hull_indices.size()]];
+        const auto & p = points[index];
+        EXPECT_GE((b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x), -1e-4);
+      }
+    }
+  }
+}
+
+TEST_F(TestAEB, FootprintPathRasterMatchesConvexHull)
+{
+  namespace bg = boost::geometry;
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> coordinate(-10.0, 10.0);
+  std::vector<Polygon2d> polygons(3);
+  for (auto & polygon : polygons) {
+    for (size_t i = 0; i < 4; ++i) {
+      polygon.outer().emplace_back(coordinate(generator), coordinate(generator));
+    }
+  }
+  FootprintPathRaster raster(0.5);
+  raster.build(polygons);
+  ASSERT_FALSE(raster.empty());
+
+  bg::model::multi_point<autoware_utils::Point2d> vertices;
+  for (const auto & polygon : polygons) {
+    for (const auto & p : polygon.outer()) {
+      bg::append(vertices, p);
+    }
+  }
+  Polygon2d hull;
+  bg::convex_hull(vertices, hull);
+  for (size_t i = 0; i < 10000; ++i) {
+    const autoware_utils::Point2d p(coordinate(generator), coordinate(generator));
+    EXPECT_EQ(raster.contains(p.x(), p.y()), bg::covered_by(p, hull));
+  }
+
+  raster.build({});
+  EXPECT_TRUE(raster.empty());
+  EXPECT_FALSE(raster.contains(0.0, 0.0));
+}
+
 }  // namespace autoware::motion::control::autonomous_emergency_braking::test
@@ -40,6 +40,7 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -89,6 +90,13 @@ ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::ObjectLaneletFilterBase(
     declare_parameter<double>("filter_settings.lanelet_extra_margin");
   filter_settings_.debug = declare_parameter<bool>("filter_settings.debug");
 
+  filter_settings_.lanelet_raster_cache =
+    declare_parameter<bool>("filter_settings.lanelet_raster_cache.enabled");
+  filter_settings_.lanelet_raster_cache_resolution =
+    declare_parameter<double>("filter_settings.lanelet_raster_cache.resolution");
+  filter_settings_.lanelet_raster_cache_max_tiles =
+    declare_parameter<int64_t>("filter_settings.lanelet_raster_cache.max_tiles");
+
   if (filter_settings_.min_elevation_threshold > filter_settings_.max_elevation_threshold) {
     RCLCPP_WARN(
       this->get_logger(),
@@ -132,6 +140,16 @@ bool isInPolygon(
   return boost::geometry::distance(p, polygon) < radius + eps;
 }
 
+// only the road lanelets and road shoulder lanelets are used by the filters
+bool isRoadOrShoulderLanelet(const lanelet::ConstLanelet & lanelet)
+{
+  if (!lanelet.hasAttribute(lanelet::AttributeName::Subtype)) {
+    return false;
+  }
+  const auto & subtype = lanelet.attribute(lanelet::AttributeName::Subtype).value();
+  return subtype == lanelet::AttributeValueString::Road || subtype == "road_shoulder";
+}
+
 LinearRing2d expandPolygon(const LinearRing2d & polygon, double distance)
 {
   autoware_utils::MultiPolygon2d multi_polygon;
@@ -323,6 +341,14 @@ void ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::mapCallback(
   lanelet_frame_id_ = map_msg->header.frame_id;
   lanelet_map_ptr_ = autoware::experimental::lanelet2_utils::remove_const(
     autoware::experimental::lanelet2_utils::from_autoware_map_msgs(*map_msg));
+
+  lanelet_raster_cache_.reset();
+  if (filter_settings_.lanelet_raster_cache) {
+    lanelet_raster_cache_ = std::make_unique<LaneletRasterCache>(
+      filter_settings_.lanelet_raster_cache_resolution,
+      static_cast<size_t>(std::max<int64_t>(filter_settings_.lanelet_raster_cache_max_tiles, 1)),
+      [this](const lanelet::BoundingBox2d & bbox) { return getRoadPolygons(bbox); });
+  }
 }
 
 template <typename ObjsMsgType, typename ObjMsgType>
@@ -414,21 +440,33 @@ bool ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::filterObject(
       object_polygon = getConvexHullFromObjectFootprint(transformed_object);
     }
 
-    // create a bounding box from polygon for searching the local R-tree
-    bg::model::box<bg::model::d2::point_xy<double>> bbox_of_convex_hull;
-    bg::envelope(object_polygon, bbox_of_convex_hull);
-    std::vector<BoxAndLanelet> candidates;
-    // only use the lanelets that intersect with the object's bounding box
+    // the candidate lanelets are only searched when an exact test needs them
+    std::optional<std::vector<BoxAndLanelet>> candidates;
+    const auto get_candidates = [&]() -> const std::vector<BoxAndLanelet> & {
+      if (!candidates) {
+        // create a bounding box from polygon for searching the local R-tree
+        bg::model::box<bg::model::d2::point_xy<double>> bbox_of_convex_hull;
+        bg::envelope(object_polygon, bbox_of_convex_hull);
+        candidates.emplace();
+        // only use the lanelets that intersect with the object's bounding box
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
-    // on NVIDIA DRIVE AGX Thor, boost::geometry triggers a false positive warning
-    local_rtree.query(bgi::intersects(bbox_of_convex_hull), std::back_inserter(candidates));
+        // on NVIDIA DRIVE AGX Thor, boost::geometry triggers a false positive warning
+        local_rtree.query(bgi::intersects(bbox_of_convex_hull), std::back_inserter(*candidates));
 #pragma GCC diagnostic pop
+      }
+      return *candidates;
+    };
 
     bool filter_pass = true;
     // 1. is polygon overlap with road lanelets or shoulder lanelets
     if (filter_settings_.lanelet_xy_overlap_filter) {
-      filter_pass = isObjectOverlapLanelets(transformed_object, object_polygon, candidates);
+      // the raster cache answers unless the object is close to a lanelet boundary
+      const auto cached_result =
+        isObjectOverlapLaneletsFromCache(transformed_object, object_polygon);
+      filter_pass = cached_result ? *cached_result
+                                  : isObjectOverlapLanelets(
+                                      transformed_object, object_polygon, get_candidates());
     }
 
     // 2. check if objects velocity is the same with the lanelet direction
@@ -436,12 +474,12 @@ bool ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::filterObject(
       transformed_object.kinematics.orientation_availability ==
       autoware_perception_msgs::msg::TrackedObjectKinematics::UNAVAILABLE;
     if (filter_settings_.lanelet_direction_filter && !orientation_not_available && filter_pass) {
-      filter_pass = isSameDirectionWithLanelets(transformed_object, candidates);
+      filter_pass = isSameDirectionWithLanelets(transformed_object, get_candidates());
     }
 
     // 3. check if the object is above the lanelets
     if (filter_settings_.lanelet_object_elevation_filter && filter_pass) {
-      filter_pass = isObjectAboveLanelet(transformed_object, candidates);
+      filter_pass = isObjectAboveLanelet(transformed_object, get_candidates());
     }
 
     // push back to output object
@@ -543,11 +581,7 @@ std::vector<BoxAndLanelet> ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::get
   const lanelet::Lanelets candidate_lanelets = lanelet_map_ptr_->laneletLayer.search(bbox2d);
   for (const auto & lanelet : candidate_lanelets) {
     // only check the road lanelets and road shoulder lanelets
-    if (
-      lanelet.hasAttribute(lanelet::AttributeName::Subtype) &&
-      (lanelet.attribute(lanelet::AttributeName::Subtype).value() ==
-         lanelet::AttributeValueString::Road ||
-       lanelet.attribute(lanelet::AttributeName::Subtype).value() == "road_shoulder")) {
+    if (isRoadOrShoulderLanelet(lanelet)) {
       if (bg::intersects(convex_hull, lanelet.polygon2d().basicPolygon())) {
         // create bbox using boost for making the R-tree in later phase
         auto polygon = getPolygon(lanelet);
@@ -563,6 +597,30 @@ std::vector<BoxAndLanelet> ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::get
   return intersected_lanelets_with_bbox;
 }
 
+// fetch the polygons, including the extra margin, of the road lanelets and road shoulder lanelets
+// which may intersect the bounding box, to fill the raster cache
+template <typename ObjsMsgType, typename ObjMsgType>
+std::vector<lanelet::BasicPolygon2d>
+ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::getRoadPolygons(
+  const lanelet::BoundingBox2d & bbox)
+{
+  std::vector<lanelet::BasicPolygon2d> polygons;
+  if (!lanelet_map_ptr_) {
+    return polygons;
+  }
+
+  const double margin = std::max(filter_settings_.lanelet_extra_margin, 0.0);
+  const lanelet::BoundingBox2d search_bbox(
+    lanelet::BasicPoint2d(bbox.min().x() - margin, bbox.min().y() - margin),
+    lanelet::BasicPoint2d(bbox.max().x() + margin, bbox.max().y() + margin));
+  for (const auto & lanelet : lanelet_map_ptr_->laneletLayer.search(search_bbox)) {
+    if (isRoadOrShoulderLanelet(lanelet)) {
+      polygons.push_back(getPolygon(lanelet));
+    }
+  }
+  return polygons;
+}
+
 template <typename ObjsMsgType, typename ObjMsgType>
 lanelet::BasicPolygon2d ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::getPolygon(
   const lanelet::ConstLanelet & lanelet)
@@ -607,6 +665,34 @@ bool ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::isObjectOverlapLanelets(
   }
 }
 
+template <typename ObjsMsgType, typename ObjMsgType>
+std::optional<bool>
+ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::isObjectOverlapLaneletsFromCache(
+  const ObjMsgType & object, const Polygon2d & polygon)
+{
+  if (!lanelet_raster_cache_) {
+    return std::nullopt;
+  }
+
+  // same tests as isObjectOverlapLanelets, with std::nullopt if a boundary cell is involved
+  if (utils::hasBoundingBox(object)) {
+    return lanelet_raster_cache_->isPolygonOverlapPolygons(polygon);
+  }
+  std::optional<bool> result = false;
+  for (const auto & point : object.shape.footprint.points) {
+    const geometry_msgs::msg::Point32 point_transformed =
+      autoware_utils::transform_point(point, object.kinematics.pose_with_covariance.pose);
+    const auto is_in_polygons =
+      lanelet_raster_cache_->isPointInPolygons(point_transformed.x, point_transformed.y);
+    if (!is_in_polygons) {
+      result = std::nullopt;
+    } else if (*is_in_polygons) {
+      return true;
+    }
+  }
+  return result;
+}
+
 template <typename ObjsMsgType, typename ObjMsgType>
 bool ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::isPolygonOverlapLanelets(
   const Polygon2d & polygon, const std::vector<BoxAndLanelet> & lanelet_candidates)
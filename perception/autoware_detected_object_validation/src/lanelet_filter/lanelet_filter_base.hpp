@@ -16,6 +16,7 @@
 #define LANELET_FILTER__LANELET_FILTER_BASE_HPP_
 
 #include "autoware/detected_object_validation/utils/utils.hpp"
+#include "lanelet_raster_cache.hpp"
 #include "autoware_utils/geometry/geometry.hpp"
 #include "autoware_utils/ros/debug_publisher.hpp"
 #include "autoware_utils/ros/published_time_publisher.hpp"
@@ -35,6 +36,7 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -104,8 +106,15 @@ private:
 
     double lanelet_extra_margin;
     bool debug;
+
+    bool lanelet_raster_cache;
+    double lanelet_raster_cache_resolution;
+    int64_t lanelet_raster_cache_max_tiles;
   } filter_settings_;
 
+  // membership of the road and road shoulder lanelets, rebuilt lazily around the objects
+  std::unique_ptr<LaneletRasterCache> lanelet_raster_cache_;
+
   bool filterObject(
     const ObjMsgType & transformed_object, const ObjMsgType & input_object,
     const bg::index::rtree<BoxAndLanelet, RtreeAlgo> & local_rtree,
@@ -113,9 +122,12 @@ private:
   LinearRing2d getConvexHull(const ObjsMsgType &);
   Polygon2d getConvexHullFromObjectFootprint(const ObjMsgType & object);
   std::vector<BoxAndLanelet> getIntersectedLanelets(const LinearRing2d &);
+  std::vector<lanelet::BasicPolygon2d> getRoadPolygons(const lanelet::BoundingBox2d & bbox);
   bool isObjectOverlapLanelets(
     const ObjMsgType & object, const Polygon2d & polygon,
     const std::vector<BoxAndLanelet> & lanelet_candidates);
+  std::optional<bool> isObjectOverlapLaneletsFromCache(
+    const ObjMsgType & object, const Polygon2d & polygon);
   bool isPolygonOverlapLanelets(
     const Polygon2d & polygon, const std::vector<BoxAndLanelet> & lanelet_candidates);
   bool isSameDirectionWithLanelets(
@@ -0,0 +1,258 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet_raster_cache.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace autoware::detected_object_validation
+{
+namespace lanelet_filter
+{
+namespace
+{
+int64_t floorDiv(const int64_t a, const int64_t b)
+{
+  return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+/// @brief mask of the columns in [first, last], which must be in [0, 63]
+uint64_t columnsMask(const int64_t first, const int64_t last)
+{
+  return (~0ULL >> (63 - last)) & (~0ULL << first);
+}
+
+/// @brief crossing number test of a point against the outer ring of a polygon
+bool isPointInRing(const double x, const double y, const autoware_utils::Polygon2d & polygon)
+{
+  const auto & ring = polygon.outer();
+  bool inside = false;
+  for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+    const auto & a = ring[i];
+    const auto & b = ring[j];
+    if ((a.y() > y) != (b.y() > y) && x < a.x() + (y - a.y()) * (b.x() - a.x()) / (b.y() - a.y())) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+}  // namespace
+
+LaneletRasterCache::LaneletRasterCache(
+  const double resolution, const size_t max_tiles_nb, PolygonLoader loader)
+: resolution_(resolution),
+  max_tiles_nb_(std::max<size_t>(max_tiles_nb, 1)),
+  loader_(std::move(loader))
+{
+}
+
+LaneletRasterCache::Membership LaneletRasterCache::getMembership(const double x, const double y)
+{
+  return getCellMembership(
+    static_cast<int64_t>(std::floor(x / resolution_)),
+    static_cast<int64_t>(std::floor(y / resolution_)));
+}
+
+std::optional<bool> LaneletRasterCache::isPointInPolygons(const double x, const double y)
+{
+  switch (getMembership(x, y)) {
+    case Membership::INSIDE:
+      return true;
+    case Membership::OUTSIDE:
+      return false;
+    default:
+      return std::nullopt;
+  }
+}
+
+std::optional<bool> LaneletRasterCache::isPolygonOverlapPolygons(
+  const autoware_utils::Polygon2d & polygon)
+{
+  const auto & ring = polygon.outer();
+  if (ring.empty()) {
+    return std::nullopt;
+  }
+  // a vertex in an inside cell is enough
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & p : ring) {
+    if (getMembership(p.x(), p.y()) == Membership::INSIDE) {
+      return true;
+    }
+    min_x = std::min(min_x, p.x());
+    min_y = std::min(min_y, p.y());
+    max_x = std::max(max_x, p.x());
+    max_y = std::max(max_y, p.y());
+  }
+
+  const auto first_cell_x = static_cast<int64_t>(std::floor(min_x / resolution_));
+  const auto first_cell_y = static_cast<int64_t>(std::floor(min_y / resolution_));
+  const auto last_cell_x = static_cast<int64_t>(std::floor(max_x / resolution_));
+  const auto last_cell_y = static_cast<int64_t>(std::floor(max_y / resolution_));
+  const auto cells_nb = static_cast<size_t>(last_cell_x - first_cell_x + 1) *
+                        static_cast<size_t>(last_cell_y - first_cell_y + 1);
+  if (cells_nb > max_queried_cells_nb) {
+    return std::nullopt;
+  }
+
+  // the polygon does not overlap any polygon if all the cells of its bounding box are outside, and
+  // overlaps one if it contains the center of an inside cell
+  bool all_outside = true;
+  for (auto cell_y = first_cell_y; cell_y <= last_cell_y; ++cell_y) {
+    for (auto cell_x = first_cell_x; cell_x <= last_cell_x; ++cell_x) {
+      const auto membership = getCellMembership(cell_x, cell_y);
+      if (membership == Membership::OUTSIDE) {
+        continue;
+      }
+      all_outside = false;
+      if (
+        membership == Membership::INSIDE &&
+        isPointInRing(
+          (static_cast<double>(cell_x) + 0.5) * resolution_,
+          (static_cast<double>(cell_y) + 0.5) * resolution_, polygon)) {
+        return true;
+      }
+    }
+  }
+  return all_outside ? std::make_optional(false) : std::nullopt;
+}
+
+LaneletRasterCache::Membership LaneletRasterCache::getCellMembership(
+  const int64_t cell_x, const int64_t cell_y)
+{
+  const auto tile_x = floorDiv(cell_x, tile_cells);
+  const auto tile_y = floorDiv(cell_y, tile_cells);
+  const auto & tile = getTile(tile_x, tile_y);
+  const auto row = cell_y - tile_y * tile_cells;
+  const auto bit = 1ULL << static_cast<uint64_t>(cell_x - tile_x * tile_cells);
+  if (tile.inside[row] & bit) {
+    return Membership::INSIDE;
+  }
+  return (tile.boundary[row] & bit) ? Membership::BOUNDARY : Membership::OUTSIDE;
+}
+
+const LaneletRasterCache::Tile & LaneletRasterCache::getTile(
+  const int64_t tile_x, const int64_t tile_y)
+{
+  const auto key = (static_cast<uint64_t>(static_cast<uint32_t>(tile_x)) << 32U) |
+                   static_cast<uint64_t>(static_cast<uint32_t>(tile_y));
+  auto it = tiles_.find(key);
+  if (it == tiles_.end()) {
+    if (tiles_.size() >= max_tiles_nb_) {
+      const auto least_recently_used = std::min_element(
+        tiles_.begin(), tiles_.end(),
+        [](const auto & t1, const auto & t2) { return t1.second.last_used < t2.second.last_used; });
+      tiles_.erase(least_recently_used);
+    }
+    const double extent = static_cast<double>(tile_cells) * resolution_;
+    const double origin_x = static_cast<double>(tile_x) * extent;
+    const double origin_y = static_cast<double>(tile_y) * extent;
+    Tile tile;
+    const lanelet::BoundingBox2d box(
+      lanelet::BasicPoint2d(origin_x, origin_y),
+      lanelet::BasicPoint2d(origin_x + extent, origin_y + extent));
+    for (const auto & polygon : loader_(box)) {
+      rasterize(polygon, origin_x, origin_y, tile);
+    }
+    // a cell inside a polygon is inside the union even if it is crossed by another polygon
+    for (int64_t row = 0; row < tile_cells; ++row) {
+      tile.boundary[row] &= ~tile.inside[row];
+    }
+    it = tiles_.emplace(key, tile).first;
+  }
+  it->second.last_used = ++queries_nb_;
+  return it->second;
+}
+
+void LaneletRasterCache::rasterize(
+  const lanelet::BasicPolygon2d & polygon, const double origin_x, const double origin_y,
+  Tile & tile)
+{
+  const size_t n = polygon.size();
+  if (n == 0) {
+    return;
+  }
+  // cells are slightly enlarged so that points on the border of a cell mark both cells
+  const double pad = resolution_ * 1e-3;
+  const auto to_cell = [&](const double v, const double origin) {
+    return static_cast<int64_t>(std::floor((v - origin) / resolution_));
+  };
+
+  // cells crossed by the edges of the polygon
+  std::array<uint64_t, tile_cells> boundary{};
+  for (size_t i = 0; i < n; ++i) {
+    const auto & a = polygon[i];
+    const auto & b = polygon[(i + 1) % n];
+    const double edge_min_y = std::min(a.y(), b.y());
+    const double edge_max_y = std::max(a.y(), b.y());
+    const auto first_row = std::max<int64_t>(to_cell(edge_min_y - pad, origin_y), 0);
+    const auto last_row = std::min<int64_t>(to_cell(edge_max_y + pad, origin_y), tile_cells - 1);
+    for (auto row = first_row; row <= last_row; ++row) {
+      // x interval of the part of the edge in the row
+      const double row_min_y = origin_y + static_cast<double>(row) * resolution_ - pad;
+      const double row_max_y = row_min_y + resolution_ + 2.0 * pad;
+      double min_x = std::min(a.x(), b.x());
+      double max_x = std::max(a.x(), b.x());
+      if (a.y() != b.y()) {
+        const auto x_at = [&](const double y) {
+          return a.x() + (y - a.y()) * (b.x() - a.x()) / (b.y() - a.y());
+        };
+        const double x1 = x_at(std::max(row_min_y, edge_min_y));
+        const double x2 = x_at(std::min(row_max_y, edge_max_y));
+        min_x = std::min(x1, x2);
+        max_x = std::max(x1, x2);
+      }
+      const auto first_col = std::max<int64_t>(to_cell(min_x - pad, origin_x), 0);
+      const auto last_col = std::min<int64_t>(to_cell(max_x + pad, origin_x), tile_cells - 1);
+      if (first_col <= last_col) {
+        boundary[row] |= columnsMask(first_col, last_col);
+      }
+    }
+  }
+
+  // cells whose center is inside the polygon and which are not crossed by an edge
+  for (int64_t row = 0; row < tile_cells; ++row) {
+    const double y = origin_y + (static_cast<double>(row) + 0.5) * resolution_;
+    crossings_.clear();
+    for (size_t i = 0; i < n; ++i) {
+      const auto & a = polygon[i];
+      const auto & b = polygon[(i + 1) % n];
+      if ((a.y() <= y) != (b.y() <= y)) {
+        crossings_.push_back(a.x() + (y - a.y()) * (b.x() - a.x()) / (b.y() - a.y()));
+      }
+    }
+    std::sort(crossings_.begin(), crossings_.end());
+    uint64_t fill = 0;
+    for (size_t i = 0; i + 1 < crossings_.size(); i += 2) {
+      const auto first_col = std::max<int64_t>(
+        static_cast<int64_t>(std::ceil((crossings_[i] - origin_x) / resolution_ - 0.5)), 0);
+      const auto last_col = std::min<int64_t>(
+        static_cast<int64_t>(std::floor((crossings_[i + 1] - origin_x) / resolution_ - 0.5)),
+        tile_cells - 1);
+      if (first_col <= last_col) {
+        fill |= columnsMask(first_col, last_col);
+      }
+    }
+    tile.inside[row] |= fill & ~boundary[row];
+    tile.boundary[row] |= boundary[row];
+  }
+}
+}  // namespace lanelet_filter
+}  // namespace autoware::detected_object_validation
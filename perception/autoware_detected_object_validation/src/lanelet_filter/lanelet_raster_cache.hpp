@@ -0,0 +1,96 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET_FILTER__LANELET_RASTER_CACHE_HPP_
+#define LANELET_FILTER__LANELET_RASTER_CACHE_HPP_
+
+#include "autoware_utils/geometry/boost_geometry.hpp"
+
+#include <lanelet2_core/geometry/BoundingBox.h>
+#include <lanelet2_core/primitives/Polygon.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::detected_object_validation
+{
+namespace lanelet_filter
+{
+/**
+ * @brief Cache of the rasterized membership of the xy-plane to a set of lanelet polygons
+ * @details the plane is divided in square tiles of tile_cells x tile_cells cells, which are built
+ * lazily when first queried, i.e. around the objects and so around the ego vehicle, and evicted
+ * least recently used first. Each cell is classified as inside a polygon, outside all polygons or
+ * crossed by a polygon boundary, with one bit per cell and per class. Queries that only touch
+ * inside or outside cells are answered from the masks, the others return std::nullopt and must
+ * fall back to an exact polygon test.
+ */
+class LaneletRasterCache
+{
+public:
+  enum class Membership : uint8_t { OUTSIDE, BOUNDARY, INSIDE };
+
+  /// @brief return the polygons which may intersect the given box
+  using PolygonLoader =
+    std::function<std::vector<lanelet::BasicPolygon2d>(const lanelet::BoundingBox2d &)>;
+
+  static constexpr int64_t tile_cells = 64;  // cells per tile side, one 64 bits word per row
+
+  LaneletRasterCache(const double resolution, const size_t max_tiles_nb, PolygonLoader loader);
+
+  /// @brief remove all the tiles, e.g. when the map changed
+  void clear() { tiles_.clear(); }
+
+  size_t tiles_nb() const { return tiles_.size(); }
+
+  Membership getMembership(const double x, const double y);
+
+  /// @brief return whether the point is inside or on the boundary of a polygon, if known
+  std::optional<bool> isPointInPolygons(const double x, const double y);
+
+  /// @brief return whether the polygon intersects a polygon, if known
+  std::optional<bool> isPolygonOverlapPolygons(const autoware_utils::Polygon2d & polygon);
+
+private:
+  struct Tile
+  {
+    std::array<uint64_t, tile_cells> inside{};
+    std::array<uint64_t, tile_cells> boundary{};
+    uint64_t last_used{0};
+  };
+
+  static constexpr size_t max_queried_cells_nb = 4096;
+
+  Membership getCellMembership(const int64_t cell_x, const int64_t cell_y);
+  const Tile & getTile(const int64_t tile_x, const int64_t tile_y);
+  void rasterize(
+    const lanelet::BasicPolygon2d & polygon, const double origin_x, const double origin_y,
+    Tile & tile);
+
+  double resolution_;
+  size_t max_tiles_nb_;
+  PolygonLoader loader_;
+  std::unordered_map<uint64_t, Tile> tiles_;
+  uint64_t queries_nb_{0};
+  std::vector<double> crossings_;  // buffer of the crossings of a scanline with a polygon
+};
+}  // namespace lanelet_filter
+}  // namespace autoware::detected_object_validation
+
+#endif  // LANELET_FILTER__LANELET_RASTER_CACHE_HPP_
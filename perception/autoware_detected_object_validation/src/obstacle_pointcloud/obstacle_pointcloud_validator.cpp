@@ -25,6 +25,7 @@
 
 #include <boost/geometry.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <vector>
@@ -37,6 +38,26 @@ namespace bg = boost::geometry;
 using Shape = autoware_perception_msgs::msg::Shape;
 using Polygon2d = autoware_utils::Polygon2d;
 
+namespace
+{
+/// @brief crossing number test in the xy-plane, same as the 2D test of pcl::CropHull
+bool isPointInPolygon(const Polygon2d & polygon, const double x, const double y)
+{
+  const auto & ring = polygon.outer();
+  bool inside = false;
+  for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+    const auto & p_i = ring[i];
+    const auto & p_j = ring[j];
+    if (
+      (p_i.y() > y) != (p_j.y() > y) &&
+      x < (p_j.x() - p_i.x()) * (y - p_i.y()) / (p_j.y() - p_i.y()) + p_i.x()) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+}  // namespace
+
 Validator::Validator(const PointsNumThresholdParam & points_num_threshold_param)
 {
   points_num_threshold_param_.min_points_num = points_num_threshold_param.min_points_num;
@@ -45,8 +66,14 @@ Validator::Validator(const PointsNumThresholdParam & points_num_threshold_param)
     points_num_threshold_param.min_points_and_distance_ratio;
 }
 
+bool Validator::setInputCloud(const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_cloud)
+{
+  grid_index_.build(*input_cloud);
+  return !grid_index_.empty();
+}
+
 size_t Validator::getThresholdPointCloud(
-  const autoware_perception_msgs::msg::DetectedObject & object)
+  const autoware_perception_msgs::msg::DetectedObject & object) const
 {
   const auto object_label_id = object.classification.front().label;
   const auto object_distance = std::hypot(
@@ -66,90 +93,49 @@ Validator2D::Validator2D(PointsNumThresholdParam & points_num_threshold_param)
 {
 }
 
-bool Validator2D::setKdtreeInputCloud(
-  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_cloud)
-{
-  obstacle_pointcloud_.reset(new pcl::PointCloud<pcl::PointXY>);
-  pcl::fromROSMsg(*input_cloud, *obstacle_pointcloud_);
-  if (obstacle_pointcloud_->empty()) {
-    return false;
-  }
-
-  kdtree_ = pcl::make_shared<pcl::search::KdTree<pcl::PointXY>>(false);
-  kdtree_->setInputCloud(obstacle_pointcloud_);
-
-  return true;
-}
-pcl::PointCloud<pcl::PointXYZ>::Ptr Validator2D::convertToXYZ(
-  const pcl::PointCloud<pcl::PointXY>::Ptr & pointcloud_xy)
-{
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_xyz(new pcl::PointCloud<pcl::PointXYZ>);
-  pointcloud_xyz->reserve(pointcloud_xy->size());
-  for (const auto & point : *pointcloud_xy) {
-    pointcloud_xyz->push_back(pcl::PointXYZ(point.x, point.y, 0.0));
-  }
-  return pointcloud_xyz;
-}
-
-std::optional<size_t> Validator2D::getPointCloudWithinObject(
-  const autoware_perception_msgs::msg::DetectedObject & object,
-  const pcl::PointCloud<pcl::PointXY>::Ptr pointcloud)
-{
-  std::vector<pcl::Vertices> vertices_array;
-  pcl::Vertices vertices;
-  Polygon2d poly2d =
-    autoware_utils::to_polygon2d(object.kinematics.pose_with_covariance.pose, object.shape);
-  if (bg::is_empty(poly2d)) return std::nullopt;
-
-  pcl::PointCloud<pcl::PointXYZ>::Ptr poly3d(new pcl::PointCloud<pcl::PointXYZ>);
-
-  for (size_t i = 0; i < poly2d.outer().size(); ++i) {
-    vertices.vertices.emplace_back(i);
-    vertices_array.emplace_back(vertices);
-    poly3d->emplace_back(poly2d.outer().at(i).x(), poly2d.outer().at(i).y(), 0.0);
-  }
-  cropped_pointcloud_.reset(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::CropHull<pcl::PointXYZ> cropper;  // don't be implemented PointXY by PCL
-  cropper.setInputCloud(convertToXYZ(pointcloud));
-  cropper.setDim(2);
-  cropper.setHullIndices(vertices_array);
-  cropper.setHullCloud(poly3d);
-  cropper.setCropOutside(true);
-  cropper.filter(*cropped_pointcloud_);
-  return cropped_pointcloud_->size();
-}
-
 bool Validator2D::validate_object(
-  const autoware_perception_msgs::msg::DetectedObject & transformed_object)
+  const autoware_perception_msgs::msg::DetectedObject & transformed_object,
+  DebugPointClouds * debug_pointclouds) const
 {
-  // get neighbor_pointcloud of object
-  neighbor_pointcloud_.reset(new pcl::PointCloud<pcl::PointXY>);
-  std::vector<int> indices;
-  std::vector<float> distances;
   const auto search_radius = getMaxRadius(transformed_object);
   if (!search_radius) {
     return false;
   }
-  kdtree_->radiusSearch(
-    pcl::PointXY(
-      transformed_object.kinematics.pose_with_covariance.pose.position.x,
-      transformed_object.kinematics.pose_with_covariance.pose.position.y),
-    search_radius.value(), indices, distances);
-  for (const auto & index : indices) {
-    neighbor_pointcloud_->push_back(obstacle_pointcloud_->at(index));
-  }
-  const auto num = getPointCloudWithinObject(transformed_object, neighbor_pointcloud_);
-  if (!num) return true;
+  const Polygon2d poly2d = autoware_utils::to_polygon2d(
+    transformed_object.kinematics.pose_with_covariance.pose, transformed_object.shape);
+  if (bg::is_empty(poly2d)) return true;
+
+  // count the neighbor points of the object which are within its polygon
+  const auto & position = transformed_object.kinematics.pose_with_covariance.pose.position;
+  const double radius = search_radius.value();
+  size_t num = 0;
+  grid_index_.forEachPointInBox(
+    position.x - radius, position.y - radius, position.x + radius, position.y + radius,
+    [&](const float x, const float y, const float /*z*/) {
+      if (std::hypot(x - position.x, y - position.y) > radius) {
+        return;
+      }
+      if (debug_pointclouds) {
+        debug_pointclouds->neighbor_pointcloud->push_back(pcl::PointXYZ(x, y, 0.0));
+      }
+      if (!isPointInPolygon(poly2d, x, y)) {
+        return;
+      }
+      ++num;
+      if (debug_pointclouds) {
+        debug_pointclouds->pointcloud_within_object->push_back(pcl::PointXYZ(x, y, 0.0));
+      }
+    });
 
   size_t threshold_pointcloud_num = getThresholdPointCloud(transformed_object);
-  if (num.value() > threshold_pointcloud_num) {
+  if (num > threshold_pointcloud_num) {
     return true;
   }
   return false;  // remove object
 }
 
 std::optional<float> Validator2D::getMaxRadius(
-  const autoware_perception_msgs::msg::DetectedObject & object)
+  const autoware_perception_msgs::msg::DetectedObject & object) const
 {
   if (object.shape.type == Shape::BOUNDING_BOX || object.shape.type == Shape::CYLINDER) {
     return std::hypot(object.shape.dimensions.x * 0.5f, object.shape.dimensions.y * 0.5f);
@@ -169,21 +155,9 @@ Validator3D::Validator3D(PointsNumThresholdParam & points_num_threshold_param)
 : Validator(points_num_threshold_param)
 {
 }
-bool Validator3D::setKdtreeInputCloud(
-  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_cloud)
-{
-  obstacle_pointcloud_.reset(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(*input_cloud, *obstacle_pointcloud_);
-  if (obstacle_pointcloud_->empty()) {
-    return false;
-  }
-  // setup kdtree_
-  kdtree_ = pcl::make_shared<pcl::search::KdTree<pcl::PointXYZ>>(false);
-  kdtree_->setInputCloud(obstacle_pointcloud_);
-  return true;
-}
+
 std::optional<float> Validator3D::getMaxRadius(
-  const autoware_perception_msgs::msg::DetectedObject & object)
+  const autoware_perception_msgs::msg::DetectedObject & object) const
 {
   if (object.shape.type == Shape::BOUNDING_BOX || object.shape.type == Shape::CYLINDER) {
     auto square_radius = (object.shape.dimensions.x * 0.5f) * (object.shape.dimensions.x * 0.5f) +
@@ -202,71 +176,45 @@ std::optional<float> Validator3D::getMaxRadius(
   }
 }
 
-std::optional<size_t> Validator3D::getPointCloudWithinObject(
-  const autoware_perception_msgs::msg::DetectedObject & object,
-  const pcl::PointCloud<pcl::PointXYZ>::Ptr neighbor_pointcloud)
-{
-  std::vector<pcl::Vertices> vertices_array;
-  pcl::Vertices vertices;
-  auto const & object_position = object.kinematics.pose_with_covariance.pose.position;
-  auto const object_height = object.shape.dimensions.x;
-  auto z_min = object_position.z - object_height / 2.0f;
-  auto z_max = object_position.z + object_height / 2.0f;
-  Polygon2d poly2d =
-    autoware_utils::to_polygon2d(object.kinematics.pose_with_covariance.pose, object.shape);
-  if (bg::is_empty(poly2d)) return std::nullopt;
-
-  pcl::PointCloud<pcl::PointXYZ>::Ptr poly3d(new pcl::PointCloud<pcl::PointXYZ>);
-  for (size_t i = 0; i < poly2d.outer().size(); ++i) {
-    vertices.vertices.emplace_back(i);
-    vertices_array.emplace_back(vertices);
-    poly3d->emplace_back(poly2d.outer().at(i).x(), poly2d.outer().at(i).y(), 0.0);
-  }
-
-  pcl::PointCloud<pcl::PointXYZ>::Ptr cropped_pointcloud_2d(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::CropHull<pcl::PointXYZ> cropper;
-  cropper.setInputCloud(neighbor_pointcloud);
-  cropper.setDim(2);
-  cropper.setHullIndices(vertices_array);
-  cropper.setHullCloud(poly3d);
-  cropper.setCropOutside(true);
-  cropper.filter(*cropped_pointcloud_2d);
-
-  cropped_pointcloud_.reset(new pcl::PointCloud<pcl::PointXYZ>);
-  cropped_pointcloud_->reserve(cropped_pointcloud_2d->size());
-  for (const auto & point : *cropped_pointcloud_2d) {
-    if (point.z > z_min && point.z < z_max) {
-      cropped_pointcloud_->push_back(point);
-    }
-  }
-  return cropped_pointcloud_->size();
-}
-
 bool Validator3D::validate_object(
-  const autoware_perception_msgs::msg::DetectedObject & transformed_object)
+  const autoware_perception_msgs::msg::DetectedObject & transformed_object,
+  DebugPointClouds * debug_pointclouds) const
 {
-  neighbor_pointcloud_.reset(new pcl::PointCloud<pcl::PointXYZ>);
-  std::vector<int> indices;
-  std::vector<float> distances;
   const auto search_radius = getMaxRadius(transformed_object);
   if (!search_radius) {
     return false;
   }
-  kdtree_->radiusSearch(
-    pcl::PointXYZ(
-      transformed_object.kinematics.pose_with_covariance.pose.position.x,
-      transformed_object.kinematics.pose_with_covariance.pose.position.y,
-      transformed_object.kinematics.pose_with_covariance.pose.position.z),
-    search_radius.value(), indices, distances);
-  for (const auto & index : indices) {
-    neighbor_pointcloud_->push_back(obstacle_pointcloud_->at(index));
-  }
-
-  const auto num = getPointCloudWithinObject(transformed_object, neighbor_pointcloud_);
-  if (!num) return true;
+  const Polygon2d poly2d = autoware_utils::to_polygon2d(
+    transformed_object.kinematics.pose_with_covariance.pose, transformed_object.shape);
+  if (bg::is_empty(poly2d)) return true;
+
+  // count the neighbor points of the object which are within its polygon and height range
+  const auto & position = transformed_object.kinematics.pose_with_covariance.pose.position;
+  const auto object_height = transformed_object.shape.dimensions.x;
+  const auto z_min = position.z - object_height / 2.0f;
+  const auto z_max = position.z + object_height / 2.0f;
+  const double radius = search_radius.value();
+  size_t num = 0;
+  grid_index_.forEachPointInBox(
+    position.x - radius, position.y - radius, position.x + radius, position.y + radius,
+    [&](const float x, const float y, const float z) {
+      if (std::hypot(x - position.x, y - position.y, z - position.z) > radius) {
+        return;
+      }
+      if (debug_pointclouds) {
+        debug_pointclouds->neighbor_pointcloud->push_back(pcl::PointXYZ(x, y, z));
+      }
+      if (!isPointInPolygon(poly2d, x, y) || z <= z_min || z >= z_max) {
+        return;
+      }
+      ++num;
+      if (debug_pointclouds) {
+        debug_pointclouds->pointcloud_within_object->push_back(pcl::PointXYZ(x, y, z));
+      }
+    });
 
   size_t threshold_pointcloud_num = getThresholdPointCloud(transformed_object);
-  if (num.value() > threshold_pointcloud_num) {
+  if (num > threshold_pointcloud_num) {
     return true;
   }
   return false;  // remove object
@@ -293,6 +241,7 @@ ObstaclePointCloudBasedValidator::ObstaclePointCloudBasedValidator(
   validate_max_distance_sq_ = validate_max_distance * validate_max_distance;
 
   using_2d_validator_ = declare_parameter<bool>("using_2d_validator");
+  num_threads_ = std::max(declare_parameter<int>("omp_params.num_threads"), 1);
 
   using std::placeholders::_1;
   using std::placeholders::_2;
@@ -332,16 +281,21 @@ void ObstaclePointCloudBasedValidator::onObjectsAndObstaclePointCloud(
     return;
   }
   bool validation_is_ready = true;
-  if (!validator_->setKdtreeInputCloud(input_obstacle_pointcloud)) {
+  if (!validator_->setInputCloud(input_obstacle_pointcloud)) {
     RCLCPP_WARN_THROTTLE(
       this->get_logger(), *this->get_clock(), 5,
       "obstacle pointcloud is empty! Can not validate objects.");
     validation_is_ready = false;
   }
 
-  for (size_t i = 0; i < transformed_objects.objects.size(); ++i) {
+  // validate the objects in parallel, objects beyond the maximum distance are not validated
+  const auto objects_nb = transformed_objects.objects.size();
+  std::vector<uint8_t> is_validated(objects_nb, false);
+  std::vector<uint8_t> is_valid(objects_nb, true);
+  std::vector<DebugPointClouds> debug_pointclouds(debugger_ ? objects_nb : 0);
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+  for (size_t i = 0; i < objects_nb; ++i) {
     const auto & transformed_object = transformed_objects.objects.at(i);
-    const auto & object = input_objects->objects.at(i);
     // check object distance
     const double distance_sq =
       transformed_object.kinematics.pose_with_covariance.pose.position.x *
@@ -349,18 +303,26 @@ void ObstaclePointCloudBasedValidator::onObjectsAndObstaclePointCloud(
       transformed_object.kinematics.pose_with_covariance.pose.position.y *
         transformed_object.kinematics.pose_with_covariance.pose.position.y;
     if (distance_sq > validate_max_distance_sq_) {
+      continue;
+    }
+    is_validated[i] = true;
+    is_valid[i] = validation_is_ready &&
+                  validator_->validate_object(
+                    transformed_object, debugger_ ? &debug_pointclouds.at(i) : nullptr);
+  }
+
+  for (size_t i = 0; i < objects_nb; ++i) {
+    const auto & object = input_objects->objects.at(i);
+    if (!is_validated[i]) {
       // pass to output
       output.objects.push_back(object);
       continue;
     }
-
-    const auto validated =
-      validation_is_ready ? validator_->validate_object(transformed_object) : false;
     if (debugger_) {
-      debugger_->addNeighborPointcloud(validator_->getDebugNeighborPointCloud());
-      debugger_->addPointcloudWithinPolygon(validator_->getDebugPointCloudWithinObject());
+      debugger_->addNeighborPointcloud(debug_pointclouds.at(i).neighbor_pointcloud);
+      debugger_->addPointcloudWithinPolygon(debug_pointclouds.at(i).pointcloud_within_object);
     }
-    if (validated) {
+    if (is_valid[i]) {
       output.objects.push_back(object);
     } else {
       removed_objects.objects.push_back(object);
@@ -21,6 +21,7 @@
 #include "autoware_utils/ros/published_time_publisher.hpp"
 #include "autoware_utils/system/stop_watch.hpp"
 #include "debugger.hpp"
+#include "point_grid_index.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -30,12 +31,8 @@
 #include <message_filters/subscriber.h>
 #include <message_filters/sync_policies/approximate_time.h>
 #include <message_filters/synchronizer.h>
-#include <pcl/filters/crop_hull.h>
-#include <pcl/kdtree/kdtree_flann.h>
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
-#include <pcl/search/kdtree.h>
-#include <pcl/search/pcl_search.h>
 #include <pcl_conversions/pcl_conversions.h>
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
@@ -56,82 +53,62 @@ struct PointsNumThresholdParam
   std::vector<double> min_points_and_distance_ratio;
 };
 
+/// @brief obstacle points used to validate an object, only filled when debugging
+struct DebugPointClouds
+{
+  pcl::PointCloud<pcl::PointXYZ>::Ptr neighbor_pointcloud{new pcl::PointCloud<pcl::PointXYZ>};
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_within_object{
+    new pcl::PointCloud<pcl::PointXYZ>};
+};
+
 class Validator
 {
 private:
   PointsNumThresholdParam points_num_threshold_param_;
 
 protected:
-  pcl::PointCloud<pcl::PointXYZ>::Ptr cropped_pointcloud_;
+  PointGridIndex grid_index_;
 
 public:
   explicit Validator(const PointsNumThresholdParam & points_num_threshold_param);
-  inline pcl::PointCloud<pcl::PointXYZ>::Ptr getDebugPointCloudWithinObject() const
-  {
-    return cropped_pointcloud_;
-  }
 
-  virtual bool setKdtreeInputCloud(
-    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_pointcloud) = 0;
+  /// @brief index the obstacle pointcloud, must be called before validating the objects
+  /// @return false if the obstacle pointcloud has no valid point
+  bool setInputCloud(const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_cloud);
+  /// @brief validate an object with the indexed obstacle pointcloud
+  /// @details does not modify the validator so several objects can be validated in parallel
+  /// @param debug_pointclouds if not null, filled with the obstacle points used for the validation
   virtual bool validate_object(
-    const autoware_perception_msgs::msg::DetectedObject & transformed_object) = 0;
+    const autoware_perception_msgs::msg::DetectedObject & transformed_object,
+    DebugPointClouds * debug_pointclouds) const = 0;
   virtual std::optional<float> getMaxRadius(
-    const autoware_perception_msgs::msg::DetectedObject & object) = 0;
-  size_t getThresholdPointCloud(const autoware_perception_msgs::msg::DetectedObject & object);
-  virtual pcl::PointCloud<pcl::PointXYZ>::Ptr getDebugNeighborPointCloud() = 0;
+    const autoware_perception_msgs::msg::DetectedObject & object) const = 0;
+  size_t getThresholdPointCloud(const autoware_perception_msgs::msg::DetectedObject & object) const;
 
   virtual ~Validator() = default;
 };
 
 class Validator2D : public Validator
 {
-private:
-  pcl::PointCloud<pcl::PointXY>::Ptr obstacle_pointcloud_;
-  pcl::PointCloud<pcl::PointXY>::Ptr neighbor_pointcloud_;
-  pcl::search::Search<pcl::PointXY>::Ptr kdtree_;
-
 public:
   explicit Validator2D(PointsNumThresholdParam & points_num_threshold_param);
 
-  static pcl::PointCloud<pcl::PointXYZ>::Ptr convertToXYZ(
-    const pcl::PointCloud<pcl::PointXY>::Ptr & pointcloud_xy);
-  inline pcl::PointCloud<pcl::PointXYZ>::Ptr getDebugNeighborPointCloud() override
-  {
-    return convertToXYZ(neighbor_pointcloud_);
-  }
-
-  bool setKdtreeInputCloud(
-    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_cloud) override;
   bool validate_object(
-    const autoware_perception_msgs::msg::DetectedObject & transformed_object) override;
+    const autoware_perception_msgs::msg::DetectedObject & transformed_object,
+    DebugPointClouds * debug_pointclouds) const override;
   std::optional<float> getMaxRadius(
-    const autoware_perception_msgs::msg::DetectedObject & object) override;
-  std::optional<size_t> getPointCloudWithinObject(
-    const autoware_perception_msgs::msg::DetectedObject & object,
-    const pcl::PointCloud<pcl::PointXY>::Ptr pointcloud);
+    const autoware_perception_msgs::msg::DetectedObject & object) const override;
 };
 class Validator3D : public Validator
 {
-private:
-  pcl::PointCloud<pcl::PointXYZ>::Ptr obstacle_pointcloud_;
-  pcl::PointCloud<pcl::PointXYZ>::Ptr neighbor_pointcloud_;
-  pcl::search::Search<pcl::PointXYZ>::Ptr kdtree_;
-
 public:
   explicit Validator3D(PointsNumThresholdParam & points_num_threshold_param);
-  inline pcl::PointCloud<pcl::PointXYZ>::Ptr getDebugNeighborPointCloud() override
-  {
-    return neighbor_pointcloud_;
-  }
-  bool setKdtreeInputCloud(
-    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_cloud) override;
+
   bool validate_object(
-    const autoware_perception_msgs::msg::DetectedObject & transformed_object) override;
+    const autoware_perception_msgs::msg::DetectedObject & transformed_object,
+    DebugPointClouds * debug_pointclouds) const override;
   std::optional<float> getMaxRadius(
-    const autoware_perception_msgs::msg::DetectedObject & object) override;
-  std::optional<size_t> getPointCloudWithinObject(
-    const autoware_perception_msgs::msg::DetectedObject & object,
-    const pcl::PointCloud<pcl::PointXYZ>::Ptr neighbor_pointcloud);
+    const autoware_perception_msgs::msg::DetectedObject & object) const override;
 };
 
 class ObstaclePointCloudBasedValidator : public rclcpp::Node
@@ -157,6 +134,7 @@ private:
 
   std::shared_ptr<Debugger> debugger_;
   bool using_2d_validator_;
+  int num_threads_;
   std::unique_ptr<Validator> validator_;
   std::unique_ptr<autoware_utils::PublishedTimePublisher> published_time_publisher_;
 
@@ -0,0 +1,129 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "point_grid_index.hpp"
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace autoware::detected_object_validation
+{
+namespace obstacle_pointcloud
+{
+namespace
+{
+/// @brief call func(index, x, y, z) for each point of the pointcloud
+template <typename Func>
+void forEachPoint(const sensor_msgs::msg::PointCloud2 & pointcloud, Func && func)
+{
+  const size_t points_nb = static_cast<size_t>(pointcloud.width) * pointcloud.height;
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(pointcloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(pointcloud, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(pointcloud, "z");
+  for (size_t i = 0; i < points_nb; ++i, ++iter_x, ++iter_y, ++iter_z) {
+    func(i, *iter_x, *iter_y, *iter_z);
+  }
+}
+
+bool isFinite(const float x, const float y, const float z)
+{
+  return std::isfinite(x) && std::isfinite(y) && std::isfinite(z);
+}
+}  // namespace
+
+void PointGridIndex::build(const sensor_msgs::msg::PointCloud2 & pointcloud)
+{
+  xs_.clear();
+  ys_.clear();
+  zs_.clear();
+  const size_t points_nb = static_cast<size_t>(pointcloud.width) * pointcloud.height;
+  if (points_nb == 0) {
+    return;
+  }
+
+  // bounds of the finite points
+  float min_x = std::numeric_limits<float>::max();
+  float min_y = std::numeric_limits<float>::max();
+  float max_x = std::numeric_limits<float>::lowest();
+  float max_y = std::numeric_limits<float>::lowest();
+  size_t finite_points_nb = 0;
+  forEachPoint(pointcloud, [&](const size_t, const float x, const float y, const float z) {
+    if (!isFinite(x, y, z)) {
+      return;
+    }
+    min_x = std::min(min_x, x);
+    min_y = std::min(min_y, y);
+    max_x = std::max(max_x, x);
+    max_y = std::max(max_y, y);
+    ++finite_points_nb;
+  });
+  if (finite_points_nb == 0) {
+    return;
+  }
+
+  current_cell_size_ = cell_size_;
+  const auto update_grid_size = [&]() {
+    cols_ = static_cast<size_t>((max_x - min_x) / current_cell_size_) + 1;
+    rows_ = static_cast<size_t>((max_y - min_y) / current_cell_size_) + 1;
+  };
+  update_grid_size();
+  while (cols_ * rows_ > max_cells_nb) {
+    current_cell_size_ *= 2.0f;
+    update_grid_size();
+  }
+  min_x_ = min_x;
+  min_y_ = min_y;
+
+  // counting sort of the points by cell
+  constexpr auto invalid_cell = std::numeric_limits<uint32_t>::max();
+  cell_starts_.assign(cols_ * rows_ + 1, 0);
+  point_cells_.resize(points_nb);
+  forEachPoint(pointcloud, [&](const size_t i, const float x, const float y, const float z) {
+    if (!isFinite(x, y, z)) {
+      point_cells_[i] = invalid_cell;
+      return;
+    }
+    const auto col = std::min(static_cast<size_t>((x - min_x) / current_cell_size_), cols_ - 1);
+    const auto row = std::min(static_cast<size_t>((y - min_y) / current_cell_size_), rows_ - 1);
+    point_cells_[i] = static_cast<uint32_t>(row * cols_ + col);
+    ++cell_starts_[point_cells_[i] + 1];
+  });
+  for (size_t cell = 0; cell + 1 < cell_starts_.size(); ++cell) {
+    cell_starts_[cell + 1] += cell_starts_[cell];
+  }
+
+  xs_.resize(finite_points_nb);
+  ys_.resize(finite_points_nb);
+  zs_.resize(finite_points_nb);
+  forEachPoint(pointcloud, [&](const size_t i, const float x, const float y, const float z) {
+    if (point_cells_[i] == invalid_cell) {
+      return;
+    }
+    // cell_starts_[cell] is used as the write position and ends at the start of the next cell
+    const auto index = cell_starts_[point_cells_[i]]++;
+    xs_[index] = x;
+    ys_[index] = y;
+    zs_[index] = z;
+  });
+  // restore the start of each cell
+  for (size_t cell = cell_starts_.size() - 1; cell > 0; --cell) {
+    cell_starts_[cell] = cell_starts_[cell - 1];
+  }
+  cell_starts_[0] = 0;
+}
+}  // namespace obstacle_pointcloud
+}  // namespace autoware::detected_object_validation
@@ -0,0 +1,96 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBSTACLE_POINTCLOUD__POINT_GRID_INDEX_HPP_
+#define OBSTACLE_POINTCLOUD__POINT_GRID_INDEX_HPP_
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware::detected_object_validation
+{
+namespace obstacle_pointcloud
+{
+/**
+ * @brief Flat 2D uniform grid over the xy-plane of a pointcloud
+ * @details the points are sorted by cell with a counting sort and stored contiguously, such that
+ * the points of a cell are in the range [cell_starts[cell], cell_starts[cell + 1]). Building the
+ * index does not allocate once the internal buffers reached the size of the largest pointcloud.
+ * After build(), the index is read-only and can be queried concurrently.
+ */
+class PointGridIndex
+{
+public:
+  explicit PointGridIndex(const float cell_size = 1.0f) : cell_size_(cell_size) {}
+
+  /// @brief index the finite points of the pointcloud, which must have float x, y and z fields
+  void build(const sensor_msgs::msg::PointCloud2 & pointcloud);
+
+  bool empty() const { return xs_.empty(); }
+  size_t size() const { return xs_.size(); }
+  float cell_size() const { return current_cell_size_; }
+
+  /**
+   * @brief call func(x, y, z) for each point of the cells overlapping the given xy box
+   * @details points of the overlapping cells that are outside of the box are also visited
+   */
+  template <typename Func>
+  void forEachPointInBox(
+    const float min_x, const float min_y, const float max_x, const float max_y, Func && func) const
+  {
+    if (empty() || max_x < min_x_ || max_y < min_y_) {
+      return;
+    }
+    const auto to_cell = [&](const float v, const float origin, const size_t cells_nb) {
+      const auto cell = std::floor((v - origin) / current_cell_size_);
+      return static_cast<size_t>(std::clamp(cell, 0.0f, static_cast<float>(cells_nb - 1)));
+    };
+    const auto first_col = to_cell(min_x, min_x_, cols_);
+    const auto last_col = to_cell(max_x, min_x_, cols_);
+    const auto first_row = to_cell(min_y, min_y_, rows_);
+    const auto last_row = to_cell(max_y, min_y_, rows_);
+    for (size_t row = first_row; row <= last_row; ++row) {
+      // the cells of a row are contiguous so the points of [first_col, last_col] are too
+      const auto begin = cell_starts_[row * cols_ + first_col];
+      const auto end = cell_starts_[row * cols_ + last_col + 1];
+      for (auto i = begin; i < end; ++i) {
+        func(xs_[i], ys_[i], zs_[i]);
+      }
+    }
+  }
+
+private:
+  static constexpr size_t max_cells_nb = 1UL << 22;
+
+  float cell_size_;
+  float current_cell_size_{1.0f};  // increased when the pointcloud spans more than max_cells_nb
+  float min_x_{0.0f};
+  float min_y_{0.0f};
+  size_t cols_{0};
+  size_t rows_{0};
+  std::vector<uint32_t> cell_starts_;
+  std::vector<float> xs_;
+  std::vector<float> ys_;
+  std::vector<float> zs_;
+  std::vector<uint32_t> point_cells_;  // buffer of the cell of each input point
+};
+}  // namespace obstacle_pointcloud
+}  // namespace autoware::detected_object_validation
+
+#endif  // OBSTACLE_POINTCLOUD__POINT_GRID_INDEX_HPP_
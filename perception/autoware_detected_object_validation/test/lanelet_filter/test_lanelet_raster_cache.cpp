@@ -0,0 +1,169 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../src/lanelet_filter/lanelet_raster_cache.hpp"
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using autoware::detected_object_validation::lanelet_filter::LaneletRasterCache;
+using autoware_utils::Polygon2d;
+
+namespace
+{
+// quadrilaterals similar to lanelets, including concave ones
+std::vector<lanelet::BasicPolygon2d> createPolygons()
+{
+  std::vector<lanelet::BasicPolygon2d> polygons;
+  polygons.push_back(
+    {lanelet::BasicPoint2d(0.0, 0.0), lanelet::BasicPoint2d(30.0, 0.0),
+     lanelet::BasicPoint2d(30.0, 3.5), lanelet::BasicPoint2d(0.0, 3.5)});
+  polygons.push_back(
+    {lanelet::BasicPoint2d(30.0, 0.0), lanelet::BasicPoint2d(55.3, 12.1),
+     lanelet::BasicPoint2d(53.7, 15.2), lanelet::BasicPoint2d(30.0, 3.5)});
+  polygons.push_back(
+    {lanelet::BasicPoint2d(-20.2, -40.1), lanelet::BasicPoint2d(-16.7, -40.1),
+     lanelet::BasicPoint2d(-10.0, 0.0), lanelet::BasicPoint2d(-16.7, 40.3),
+     lanelet::BasicPoint2d(-20.2, 40.3), lanelet::BasicPoint2d(-13.5, 0.0)});
+  return polygons;
+}
+
+Polygon2d toPolygon2d(const lanelet::BasicPolygon2d & polygon)
+{
+  Polygon2d result;
+  for (const auto & p : polygon) {
+    result.outer().emplace_back(p.x(), p.y());
+  }
+  result.outer().push_back(result.outer().front());
+  boost::geometry::correct(result);
+  return result;
+}
+
+LaneletRasterCache createCache(
+  const std::vector<lanelet::BasicPolygon2d> & polygons, const double resolution,
+  const size_t max_tiles_nb, size_t * loads_nb = nullptr)
+{
+  return LaneletRasterCache(
+    resolution, max_tiles_nb, [polygons, loads_nb](const lanelet::BoundingBox2d &) {
+      if (loads_nb) {
+        ++(*loads_nb);
+      }
+      return polygons;
+    });
+}
+}  // namespace
+
+TEST(LaneletRasterCache, PointQueryMatchesExactTest)
+{
+  const auto polygons = createPolygons();
+  std::vector<Polygon2d> exact_polygons;
+  for (const auto & polygon : polygons) {
+    exact_polygons.push_back(toPolygon2d(polygon));
+  }
+  auto cache = createCache(polygons, 0.5, 64);
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> coordinate(-60.0, 60.0);
+  size_t known_nb = 0;
+  for (size_t i = 0; i < 20000; ++i) {
+    const double x = coordinate(generator);
+    const double y = coordinate(generator);
+    const auto result = cache.isPointInPolygons(x, y);
+    if (!result) {
+      continue;
+    }
+    ++known_nb;
+    bool expected = false;
+    for (const auto & polygon : exact_polygons) {
+      expected |= boost::geometry::covered_by(autoware_utils::Point2d(x, y), polygon);
+    }
+    EXPECT_EQ(*result, expected) << "x: " << x << ", y: " << y;
+  }
+  // most of the points are far from the boundaries
+  EXPECT_GT(known_nb, 19000u);
+}
+
+TEST(LaneletRasterCache, PolygonQueryMatchesExactTest)
+{
+  const auto polygons = createPolygons();
+  std::vector<Polygon2d> exact_polygons;
+  for (const auto & polygon : polygons) {
+    exact_polygons.push_back(toPolygon2d(polygon));
+  }
+  auto cache = createCache(polygons, 0.5, 64);
+
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> coordinate(-60.0, 60.0);
+  std::uniform_real_distribution<double> size(0.2, 5.0);
+  std::uniform_real_distribution<double> angle(-M_PI, M_PI);
+  for (size_t i = 0; i < 5000; ++i) {
+    const double x = coordinate(generator);
+    const double y = coordinate(generator);
+    const double length = size(generator);
+    const double width = size(generator);
+    const double yaw = angle(generator);
+    Polygon2d box;
+    for (const auto & [dx, dy] : std::vector<std::pair<double, double>>{
+           {0.5, 0.5}, {0.5, -0.5}, {-0.5, -0.5}, {-0.5, 0.5}, {0.5, 0.5}}) {
+      box.outer().emplace_back(
+        x + std::cos(yaw) * dx * length - std::sin(yaw) * dy * width,
+        y + std::sin(yaw) * dx * length + std::cos(yaw) * dy * width);
+    }
+    boost::geometry::correct(box);
+    const auto result = cache.isPolygonOverlapPolygons(box);
+    if (!result) {
+      continue;
+    }
+    bool expected = false;
+    for (const auto & polygon : exact_polygons) {
+      expected |= boost::geometry::intersects(box, polygon);
+    }
+    EXPECT_EQ(*result, expected) << "x: " << x << ", y: " << y;
+  }
+}
+
+TEST(LaneletRasterCache, EvictLeastRecentlyUsedTiles)
+{
+  size_t loads_nb = 0;
+  auto cache = createCache(createPolygons(), 1.0, 2, &loads_nb);
+  const double tile_extent = static_cast<double>(LaneletRasterCache::tile_cells);
+
+  EXPECT_EQ(cache.isPointInPolygons(1.0, 1.0), std::make_optional(true));
+  EXPECT_EQ(cache.isPointInPolygons(tile_extent + 1.0, 1.0), std::make_optional(false));
+  EXPECT_EQ(loads_nb, 2u);
+
+  // the tiles are reused while they are in the cache
+  cache.isPointInPolygons(2.0, 2.0);
+  EXPECT_EQ(loads_nb, 2u);
+
+  // the tile of the first point is the least recently used one
+  cache.isPointInPolygons(tile_extent + 2.0, 2.0);
+  cache.isPointInPolygons(-tile_extent, 1.0);
+  EXPECT_EQ(cache.tiles_nb(), 2u);
+  EXPECT_EQ(loads_nb, 3u);
+  cache.isPointInPolygons(tile_extent + 1.0, 1.0);
+  EXPECT_EQ(loads_nb, 3u);
+  cache.isPointInPolygons(1.0, 1.0);
+  EXPECT_EQ(loads_nb, 4u);
+
+  cache.clear();
+  EXPECT_EQ(cache.tiles_nb(), 0u);
+}
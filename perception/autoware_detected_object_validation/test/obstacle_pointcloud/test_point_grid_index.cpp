@@ -0,0 +1,119 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../src/obstacle_pointcloud/point_grid_index.hpp"
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+
+using autoware::detected_object_validation::obstacle_pointcloud::PointGridIndex;
+
+namespace
+{
+sensor_msgs::msg::PointCloud2 createPointCloud(const std::vector<std::array<float, 3>> & points)
+{
+  sensor_msgs::msg::PointCloud2 pointcloud;
+  sensor_msgs::PointCloud2Modifier modifier(pointcloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(points.size());
+  sensor_msgs::PointCloud2Iterator<float> iter_x(pointcloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(pointcloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(pointcloud, "z");
+  for (const auto & point : points) {
+    *iter_x = point[0];
+    *iter_y = point[1];
+    *iter_z = point[2];
+    ++iter_x;
+    ++iter_y;
+    ++iter_z;
+  }
+  return pointcloud;
+}
+}  // namespace
+
+TEST(PointGridIndex, EmptyPointCloud)
+{
+  PointGridIndex grid_index;
+  grid_index.build(createPointCloud({}));
+  EXPECT_TRUE(grid_index.empty());
+
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  grid_index.build(createPointCloud({{nan, 0.0f, 0.0f}, {0.0f, nan, 0.0f}}));
+  EXPECT_TRUE(grid_index.empty());
+}
+
+TEST(PointGridIndex, SkipNonFinitePoints)
+{
+  PointGridIndex grid_index;
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  grid_index.build(createPointCloud({{1.0f, 2.0f, 3.0f}, {nan, 0.0f, 0.0f}, {-1.0f, 0.5f, 0.0f}}));
+  EXPECT_EQ(grid_index.size(), 2u);
+}
+
+TEST(PointGridIndex, BoxQueryVisitsAllPointsInBox)
+{
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<float> coordinate(-50.0f, 50.0f);
+  std::vector<std::array<float, 3>> points(5000);
+  for (auto & point : points) {
+    point = {coordinate(generator), coordinate(generator), coordinate(generator)};
+  }
+  PointGridIndex grid_index(2.0f);
+  grid_index.build(createPointCloud(points));
+  ASSERT_EQ(grid_index.size(), points.size());
+
+  for (size_t query = 0; query < 50; ++query) {
+    const auto x = coordinate(generator);
+    const auto y = coordinate(generator);
+    const auto half_size = std::abs(coordinate(generator)) * 0.2f;
+    size_t expected = 0;
+    for (const auto & point : points) {
+      if (
+        point[0] >= x - half_size && point[0] <= x + half_size && point[1] >= y - half_size &&
+        point[1] <= y + half_size) {
+        ++expected;
+      }
+    }
+    size_t visited_in_box = 0;
+    grid_index.forEachPointInBox(
+      x - half_size, y - half_size, x + half_size, y + half_size,
+      [&](const float px, const float py, const float) {
+        if (
+          px >= x - half_size && px <= x + half_size && py >= y - half_size &&
+          py <= y + half_size) {
+          ++visited_in_box;
+        }
+      });
+    EXPECT_EQ(visited_in_box, expected);
+  }
+}
+
+TEST(PointGridIndex, LargeExtentIncreasesCellSize)
+{
+  PointGridIndex grid_index(0.1f);
+  grid_index.build(createPointCloud({{-1e5f, -1e5f, 0.0f}, {1e5f, 1e5f, 0.0f}}));
+  EXPECT_EQ(grid_index.size(), 2u);
+  EXPECT_GT(grid_index.cell_size(), 0.1f);
+
+  size_t visited = 0;
+  grid_index.forEachPointInBox(
+    9e4f, 9e4f, 2e5f, 2e5f, [&](const float, const float, const float) { ++visited; });
+  EXPECT_EQ(visited, 1u);
+}
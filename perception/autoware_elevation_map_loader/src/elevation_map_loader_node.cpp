@@ -38,13 +38,19 @@
 #include <boost/iostreams/device/mapped_file.hpp>
 
 #include <lanelet2_core/geometry/Polygon.h>
+#include <opencv2/core.hpp>
+#include <opencv2/photo.hpp>
 #include <pcl/filters/voxel_grid.h>
 #include <pcl/pcl_base.h>
 #include <pcl/point_types.h>
 #include <pcl_conversions/pcl_conversions.h>
 #include <sensor_msgs/msg/point_cloud2.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <filesystem>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -59,6 +65,68 @@
 
 namespace autoware::elevation_map_loader
 {
+namespace
+{
+/**
+ * @brief inpaint the masked cells of a block of the elevation layer
+ * @details the cells of the block extended by the overlap are used as context, and only the
+ * masked cells of the block itself are written to the output, so that the blocks can be inpainted
+ * concurrently.
+ */
+void inpaintBlock(
+  const grid_map::Matrix & elevation, const grid_map::Matrix & inpaint_mask,
+  const Eigen::Index row, const Eigen::Index col, const Eigen::Index rows, const Eigen::Index cols,
+  const Eigen::Index overlap, const double radius_in_pixels, grid_map::Matrix & output)
+{
+  const auto is_masked = [&](const Eigen::Index r, const Eigen::Index c) {
+    return inpaint_mask(r, c) > 0.5f;
+  };
+  if ((inpaint_mask.block(row, col, rows, cols).array() <= 0.5f).all()) {
+    return;
+  }
+
+  const Eigen::Index first_row = std::max<Eigen::Index>(row - overlap, 0);
+  const Eigen::Index first_col = std::max<Eigen::Index>(col - overlap, 0);
+  const Eigen::Index last_row = std::min<Eigen::Index>(row + rows + overlap, elevation.rows());
+  const Eigen::Index last_col = std::min<Eigen::Index>(col + cols + overlap, elevation.cols());
+
+  float min_value = std::numeric_limits<float>::max();
+  for (Eigen::Index c = first_col; c < last_col; ++c) {
+    for (Eigen::Index r = first_row; r < last_row; ++r) {
+      if (std::isfinite(elevation(r, c))) {
+        min_value = std::min(min_value, elevation(r, c));
+      }
+    }
+  }
+  if (min_value == std::numeric_limits<float>::max()) {
+    // no valid cell to inpaint from
+    return;
+  }
+
+  const auto image_rows = static_cast<int>(last_row - first_row);
+  const auto image_cols = static_cast<int>(last_col - first_col);
+  cv::Mat image(image_rows, image_cols, CV_32FC1);
+  cv::Mat mask(image_rows, image_cols, CV_8UC1);
+  for (int i = 0; i < image_rows; ++i) {
+    for (int j = 0; j < image_cols; ++j) {
+      const float value = elevation(first_row + i, first_col + j);
+      image.at<float>(i, j) = std::isfinite(value) ? value : min_value;
+      mask.at<uint8_t>(i, j) = is_masked(first_row + i, first_col + j) ? 255 : 0;
+    }
+  }
+  cv::Mat filled_image;
+  cv::inpaint(image, mask, filled_image, radius_in_pixels, cv::INPAINT_NS);
+
+  for (Eigen::Index c = col; c < col + cols; ++c) {
+    for (Eigen::Index r = row; r < row + rows; ++r) {
+      if (is_masked(r, c)) {
+        output(r, c) = filled_image.at<float>(
+          static_cast<int>(r - first_row), static_cast<int>(c - first_col));
+      }
+    }
+  }
+}
+}  // namespace
 
 ElevationMapLoaderNode::ElevationMapLoaderNode(const rclcpp::NodeOptions & options)
 : Node("elevation_map_loader", options)
@@ -75,6 +143,9 @@ ElevationMapLoaderNode::ElevationMapLoaderNode(const rclcpp::NodeOptions & optio
   }
   use_inpaint_ = this->declare_parameter("use_inpaint", true);
   inpaint_radius_ = this->declare_parameter("inpaint_radius", 0.3);
+  inpaint_tile_size_ = this->declare_parameter("inpaint_tile_size", 100.0);
+  inpaint_tile_overlap_ = this->declare_parameter("inpaint_tile_overlap", 10.0);
+  inpaint_num_threads_ = std::max(this->declare_parameter("inpaint_num_threads", 4), 1);
   use_elevation_map_cloud_publisher_ =
     this->declare_parameter("use_elevation_map_cloud_publisher", false);
   elevation_map_directory_ = this->declare_parameter("elevation_map_directory", "path_default");
@@ -221,9 +292,9 @@ void ElevationMapLoaderNode::onPointcloudMap(
   }
 
   {
-    pcl::PointCloud<pcl::PointXYZ> map_pcl;
-    pcl::fromROSMsg<pcl::PointXYZ>(*pointcloud_map, map_pcl);
-    data_manager_.map_pcl_ptr_ = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>(map_pcl);
+    auto map_pcl_ptr = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
+    pcl::fromROSMsg<pcl::PointXYZ>(*pointcloud_map, *map_pcl_ptr);
+    data_manager_.map_pcl_ptr_ = map_pcl_ptr;
   }
   if (data_manager_.isInitialized()) {
     publish();
@@ -270,7 +341,7 @@ void ElevationMapLoaderNode::onVectorMap(
 
 bool ElevationMapLoaderNode::receiveMap()
 {
-  sensor_msgs::msg::PointCloud2 pointcloud_map;
+  auto map_pcl_ptr = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
   // create a loading request with mode = 1
   auto request = std::make_shared<autoware_map_msgs::srv::GetSelectedPointCloudMap::Request>();
   if (!pcd_loader_client_->service_is_ready()) {
@@ -301,40 +372,38 @@ bool ElevationMapLoaderNode::receiveMap()
       status = result.wait_for(std::chrono::seconds(1));
     }
 
-    // concatenate maps
-    concatenatePointCloudMaps(pointcloud_map, result.get()->new_pointcloud_with_ids);
+    // append the maps, the response is released before the next request
+    appendPointCloudMaps(*map_pcl_ptr, result.get()->new_pointcloud_with_ids);
   }
   RCLCPP_DEBUG(this->get_logger(), "Pointcloud map receiving process has been finished");
 
   // check for empty point cloud
   // TODO(youtalk): add unit test for empty point cloud handling
-  if (pointcloud_map.data.empty() || pointcloud_map.width == 0 || pointcloud_map.height == 0) {
+  if (map_pcl_ptr->empty()) {
     RCLCPP_WARN_THROTTLE(
       this->get_logger(), *get_clock(), 10000, "Empty pointcloud_map received after concatenation");
     return false;
   }
 
-  pcl::PointCloud<pcl::PointXYZ> map_pcl;
-  pcl::fromROSMsg<pcl::PointXYZ>(pointcloud_map, map_pcl);
-  data_manager_.map_pcl_ptr_ = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>(map_pcl);
+  data_manager_.map_pcl_ptr_ = map_pcl_ptr;
   return true;
 }
 
-void ElevationMapLoaderNode::concatenatePointCloudMaps(
-  sensor_msgs::msg::PointCloud2 & pointcloud_map,
+void ElevationMapLoaderNode::appendPointCloudMaps(
+  pcl::PointCloud<pcl::PointXYZ> & map_pcl,
   const std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID> & new_pointcloud_with_ids)
   const
 {
+  // each cell is converted on its own, so that the whole map is never held as a PointCloud2 in
+  // addition to the pcl cloud
+  pcl::PointCloud<pcl::PointXYZ> cell_pcl;
   for (const auto & new_pointcloud_with_id : new_pointcloud_with_ids) {
-    if (pointcloud_map.width == 0) {
-      pointcloud_map = new_pointcloud_with_id.pointcloud;
-    } else {
-      pointcloud_map.width += new_pointcloud_with_id.pointcloud.width;
-      pointcloud_map.row_step += new_pointcloud_with_id.pointcloud.row_step;
-      pointcloud_map.data.insert(
-        pointcloud_map.data.end(), new_pointcloud_with_id.pointcloud.data.begin(),
-        new_pointcloud_with_id.pointcloud.data.end());
+    const auto & pointcloud = new_pointcloud_with_id.pointcloud;
+    if (pointcloud.data.empty() || pointcloud.width == 0 || pointcloud.height == 0) {
+      continue;
     }
+    pcl::fromROSMsg<pcl::PointXYZ>(pointcloud, cell_pcl);
+    map_pcl += cell_pcl;
   }
 }
 
@@ -431,22 +500,32 @@ void ElevationMapLoaderNode::inpaintElevationMap(const float radius)
       }
     }
   }
-  cv::Mat original_image;
-  cv::Mat mask;
-  cv::Mat filled_image;
-  const float min_value = elevation_map_.get(layer_name_).minCoeffOfFinites();
-  const float max_value = elevation_map_.get(layer_name_).maxCoeffOfFinites();
 
-  grid_map::GridMapCvConverter::toImage<unsigned char, 3>(
-    elevation_map_, layer_name_, CV_8UC3, min_value, max_value, original_image);
-  grid_map::GridMapCvConverter::toImage<unsigned char, 1>(
-    elevation_map_, "inpaint_mask", CV_8UC1, mask);
-
-  const float radius_in_pixels = radius / elevation_map_.getResolution();
-  cv::inpaint(original_image, mask, filled_image, radius_in_pixels, cv::INPAINT_NS);
-
-  grid_map::GridMapCvConverter::addLayerFromImage<unsigned char, 3>(
-    filled_image, layer_name_, elevation_map_, min_value, max_value);
+  // Inpaint the map by overlapping tiles in parallel, instead of converting the whole map to a
+  // single image. Only the masked cells are overwritten, the other ones keep their exact value.
+  elevation_map_.convertToDefaultStartIndex();
+  grid_map::Matrix & elevation = elevation_map_.get(layer_name_);
+  const grid_map::Matrix & inpaint_mask = elevation_map_.get("inpaint_mask");
+  const grid_map::Matrix original_elevation = elevation;
+
+  const double resolution = elevation_map_.getResolution();
+  const double radius_in_pixels = radius / resolution;
+  const auto tile_cells =
+    std::max<Eigen::Index>(static_cast<Eigen::Index>(inpaint_tile_size_ / resolution), 1);
+  const auto overlap_cells = static_cast<Eigen::Index>(
+    std::ceil(std::max(inpaint_tile_overlap_, static_cast<double>(radius)) / resolution));
+  const Eigen::Index tile_rows_nb = (elevation.rows() + tile_cells - 1) / tile_cells;
+  const Eigen::Index tile_cols_nb = (elevation.cols() + tile_cells - 1) / tile_cells;
+  const int tiles_nb = static_cast<int>(tile_rows_nb * tile_cols_nb);
+
+#pragma omp parallel for num_threads(inpaint_num_threads_) schedule(dynamic)
+  for (int i = 0; i < tiles_nb; ++i) {
+    const Eigen::Index row = (i / tile_cols_nb) * tile_cells;
+    const Eigen::Index col = (i % tile_cols_nb) * tile_cells;
+    inpaintBlock(
+      original_elevation, inpaint_mask, row, col, std::min(tile_cells, elevation.rows() - row),
+      std::min(tile_cells, elevation.cols() - col), overlap_cells, radius_in_pixels, elevation);
+  }
   elevation_map_.erase("inpaint_mask");
   RCLCPP_INFO(this->get_logger(), "Elevation map inpainting has been completed");
 }
@@ -84,8 +84,8 @@ private:
   void onPointCloudMapMetaData(
     const autoware_map_msgs::msg::PointCloudMapMetaData pointcloud_map_metadata);
   bool receiveMap();
-  void concatenatePointCloudMaps(
-    sensor_msgs::msg::PointCloud2 & pointcloud_map,
+  void appendPointCloudMaps(
+    pcl::PointCloud<pcl::PointXYZ> & map_pcl,
     const std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID> & new_pointcloud_with_ids)
     const;
   std::vector<std::string> getRequestIDs(const unsigned int map_id_counter) const;
@@ -104,6 +104,9 @@ private:
   std::string elevation_map_directory_;
   bool use_inpaint_;
   float inpaint_radius_;
+  double inpaint_tile_size_;
+  double inpaint_tile_overlap_;
+  int inpaint_num_threads_;
   unsigned int sequential_map_load_num_;
   bool use_elevation_map_cloud_publisher_;
   std::string param_file_path_;
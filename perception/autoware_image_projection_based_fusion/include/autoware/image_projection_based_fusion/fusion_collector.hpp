@@ -42,6 +42,13 @@ struct Det2dStatus
   bool approximate_camera_projection{false};
 };
 
+template <class Msg2D>
+struct Det2dInput
+{
+  const Det2dStatus<Msg2D> * det2d_status;
+  const Msg2D * rois_msg;
+};
+
 struct FusionCollectorInfoBase
 {
   virtual ~FusionCollectorInfoBase() = default;
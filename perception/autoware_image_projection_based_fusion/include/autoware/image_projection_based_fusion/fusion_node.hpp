@@ -70,6 +70,11 @@ public:
   virtual void fuse_on_single_image(
     const Msg3D & input_msg3d, const Det2dStatus<Msg2D> & det2d_status,
     const Msg2D & input_rois_msg, Msg3D & output_msg) = 0;
+  // fuse the inputs of all the cameras in order, calls fuse_on_single_image for each camera by
+  // default and can be overridden to process the cameras in parallel
+  virtual void fuse_on_images(
+    const Msg3D & input_msg3d, const std::vector<Det2dInput<Msg2D>> & det2d_inputs,
+    Msg3D & output_msg);
   void export_process(
     typename Msg3D::SharedPtr & output_det3d_msg,
     std::unordered_map<std::size_t, double> id_to_stamp_map,
@@ -23,7 +23,9 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 namespace autoware::image_projection_based_fusion
 {
 const std::map<std::string, uint8_t> IOU_MODE_MAP{{"iou", 0}, {"iou_x", 1}, {"iou_y", 2}};
@@ -40,6 +42,11 @@ private:
     const ClusterMsgType & input_cluster_msg, const Det2dStatus<RoiMsgType> & det2d_status,
     const RoiMsgType & input_rois_msg, ClusterMsgType & output_cluster_msg) override;
 
+  void fuse_on_images(
+    const ClusterMsgType & input_cluster_msg,
+    const std::vector<Det2dInput<RoiMsgType>> & det2d_inputs,
+    ClusterMsgType & output_cluster_msg) override;
+
   void postprocess(const ClusterMsgType & output_cluster_msg, ClusterMsgType & output_msg) override;
   void publish(const ClusterMsgType & output_msg) override;
 
@@ -58,11 +65,37 @@ private:
   // Pedestrian size validation parameters
   PedestrianSizeValidationParams pedestrian_size_params_;
 
+  int omp_num_threads_{1};
+  static constexpr uint32_t roi_grid_cell_size = 64;  // [pixel]
+
+  // RoIs of the clusters projected on the image of a camera
+  struct ClusterRois
+  {
+    std::vector<std::size_t> cluster_indices;  // in ascending order
+    std::vector<sensor_msgs::msg::RegionOfInterest> rois;
+    std::vector<Eigen::Vector2d> debug_projected_points;
+  };
+
   AUTOWARE_PUBLISHER_PTR(ClusterMsgType) agnocast_pub_ptr_;
   AUTOWARE_SUBSCRIPTION_PTR(ClusterMsgType) agnocast_msg3d_sub_;
 
-  bool is_far_enough(const ClusterObjType & obj, const double distance_threshold);
-  bool out_of_scope(const ClusterObjType & obj);
+  bool is_far_enough(const ClusterObjType & obj, const double distance_threshold) const;
+  bool out_of_scope(const ClusterObjType & obj) const;
+
+  // clusters that can be fused, independently of the camera
+  std::vector<bool> get_fusible_clusters(const ClusterMsgType & input_cluster_msg) const;
+
+  // project all the fusible clusters on the image in one pass, is thread-safe between cameras
+  // return nullopt if the transform to the camera is not available
+  std::optional<ClusterRois> project_clusters(
+    const ClusterMsgType & input_cluster_msg, const std::vector<bool> & is_fusible,
+    const Det2dStatus<RoiMsgType> & det2d_status, const RoiMsgType & input_rois_msg) const;
+
+  // assign the image RoIs to the projected clusters and fuse their classification
+  void associate_rois(
+    const ClusterMsgType & input_cluster_msg, const Det2dStatus<RoiMsgType> & det2d_status,
+    const RoiMsgType & input_rois_msg, const ClusterRois & cluster_rois,
+    ClusterMsgType & output_cluster_msg);
   double cal_iou_by_mode(
     const sensor_msgs::msg::RegionOfInterest & roi_1,
     const sensor_msgs::msg::RegionOfInterest & roi_2, const std::string iou_mode);
@@ -24,6 +24,8 @@
 #include <geometry_msgs/msg/pose.hpp>
 #include <sensor_msgs/msg/region_of_interest.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace autoware::image_projection_based_fusion
@@ -70,6 +72,38 @@ bool isPointInsideRoi(
 
 void sanitizeROI(sensor_msgs::msg::RegionOfInterest & roi, const int width, const int height);
 
+/**
+ * @brief Uniform grid over the image plane indexing RoIs by the cells they overlap
+ * @details used to find the RoIs that may intersect a given RoI without testing all of them. Two
+ * RoIs sharing a point, including a point of their borders, always share a cell, and RoIs out of
+ * the image are assigned to the cells of its border.
+ */
+class RoiGridIndex
+{
+public:
+  RoiGridIndex(const uint32_t image_width, const uint32_t image_height, const uint32_t cell_size);
+
+  void insert(const sensor_msgs::msg::RegionOfInterest & roi, const std::size_t id);
+
+  /**
+   * @brief get the ids of the inserted RoIs sharing a cell with the given RoI
+   * @return ids in ascending order, including the ids of all the RoIs intersecting the given RoI
+   */
+  std::vector<std::size_t> query(const sensor_msgs::msg::RegionOfInterest & roi) const;
+
+private:
+  struct CellRange
+  {
+    std::size_t min_x, min_y, max_x, max_y;
+  };
+  CellRange get_cell_range(const sensor_msgs::msg::RegionOfInterest & roi) const;
+
+  uint32_t cell_size_;
+  std::size_t cols_;
+  std::size_t rows_;
+  std::vector<std::vector<std::size_t>> cells_;
+};
+
 }  // namespace autoware::image_projection_based_fusion
 
 #endif  // AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__GEOMETRY_HPP_
@@ -172,6 +172,8 @@ void FusionCollector<Msg3D, Msg2D, ExportObj>::fusion_callback()
   typename Msg3D::SharedPtr output_det3d_msg = std::make_shared<Msg3D>(*msg3d_);
   ros2_parent_node_->preprocess(*output_det3d_msg);
 
+  std::vector<Det2dInput<Msg2D>> det2d_inputs;
+  det2d_inputs.reserve(id_to_rois_map_.size());
   for (const auto & [rois_id, rois_msg] : id_to_rois_map_) {
     if (det2d_status_list_[rois_id].camera_projector_ptr == nullptr) {
       RCLCPP_WARN_THROTTLE(
@@ -179,9 +181,9 @@ void FusionCollector<Msg3D, Msg2D, ExportObj>::fusion_callback()
         "no camera info. id is %zu", rois_id);
       continue;
     }
-    ros2_parent_node_->fuse_on_single_image(
-      *msg3d_, det2d_status_list_[rois_id], *rois_msg, *output_det3d_msg);
+    det2d_inputs.push_back({&det2d_status_list_[rois_id], rois_msg.get()});
   }
+  ros2_parent_node_->fuse_on_images(*msg3d_, det2d_inputs, *output_det3d_msg);
 
   ros2_parent_node_->export_process(output_det3d_msg, id_to_stamp_map, fusion_collector_info_);
   status_ = CollectorStatus::Finished;
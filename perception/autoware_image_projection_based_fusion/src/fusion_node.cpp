@@ -298,6 +298,17 @@ void FusionNode<Msg3D, Msg2D, ExportObj>::preprocess([[maybe_unused]] Msg3D & ou
   // This function can be overridden by derived classes if needed.
 }
 
+template <class Msg3D, class Msg2D, class ExportObj>
+void FusionNode<Msg3D, Msg2D, ExportObj>::fuse_on_images(
+  const Msg3D & input_msg3d, const std::vector<Det2dInput<Msg2D>> & det2d_inputs,
+  Msg3D & output_msg)
+{
+  for (const auto & det2d_input : det2d_inputs) {
+    fuse_on_single_image(
+      input_msg3d, *det2d_input.det2d_status, *det2d_input.rois_msg, output_msg);
+  }
+}
+
 template <class Msg3D, class Msg2D, class ExportObj>
 void FusionNode<Msg3D, Msg2D, ExportObj>::export_process(
   typename Msg3D::SharedPtr & output_det3d_msg,
@@ -19,14 +19,15 @@
 #include <autoware/object_recognition_utils/object_recognition_utils.hpp>
 #include <autoware_utils/system/time_keeper.hpp>
 
+#include <Eigen/Geometry>
+
 #include <sensor_msgs/msg/point_cloud2.hpp>
 #include <sensor_msgs/point_cloud2_iterator.hpp>
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
-#include <tf2_sensor_msgs/tf2_sensor_msgs.hpp>
 
 #include <algorithm>
-#include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -65,6 +66,7 @@ RoiClusterFusionNode::RoiClusterFusionNode(const rclcpp::NodeOptions & options)
     declare_parameter<double>("pedestrian_size_validation.min_width");
   pedestrian_size_params_.max_width =
     declare_parameter<double>("pedestrian_size_validation.max_width");
+  omp_num_threads_ = std::max(declare_parameter<int>("omp_params.num_threads"), 1);
 
   RCLCPP_INFO(
     get_logger(), "Pedestrian size validation: %s",
@@ -109,7 +111,72 @@ void RoiClusterFusionNode::fuse_on_single_image(
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
-  const sensor_msgs::msg::CameraInfo & camera_info =
+  const auto is_fusible = get_fusible_clusters(input_cluster_msg);
+  const auto cluster_rois =
+    project_clusters(input_cluster_msg, is_fusible, det2d_status, input_rois_msg);
+  if (!cluster_rois) {
+    return;
+  }
+  associate_rois(
+    input_cluster_msg, det2d_status, input_rois_msg, *cluster_rois, output_cluster_msg);
+}
+
+void RoiClusterFusionNode::fuse_on_images(
+  const ClusterMsgType & input_cluster_msg,
+  const std::vector<Det2dInput<RoiMsgType>> & det2d_inputs, ClusterMsgType & output_cluster_msg)
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  const auto is_fusible = get_fusible_clusters(input_cluster_msg);
+
+  // the projections of the cameras are independent, while the association must be done in the
+  // order of the cameras since a RoI can overwrite the classification fused from a previous camera
+  std::vector<std::optional<ClusterRois>> cluster_rois(det2d_inputs.size());
+#pragma omp parallel for num_threads(omp_num_threads_) schedule(dynamic)
+  for (std::size_t i = 0; i < det2d_inputs.size(); ++i) {
+    cluster_rois[i] = project_clusters(
+      input_cluster_msg, is_fusible, *det2d_inputs[i].det2d_status, *det2d_inputs[i].rois_msg);
+  }
+
+  for (std::size_t i = 0; i < det2d_inputs.size(); ++i) {
+    if (!cluster_rois[i]) {
+      continue;
+    }
+    associate_rois(
+      input_cluster_msg, *det2d_inputs[i].det2d_status, *det2d_inputs[i].rois_msg,
+      *cluster_rois[i], output_cluster_msg);
+  }
+}
+
+std::vector<bool> RoiClusterFusionNode::get_fusible_clusters(
+  const ClusterMsgType & input_cluster_msg) const
+{
+  std::vector<bool> is_fusible(input_cluster_msg.feature_objects.size(), false);
+  for (std::size_t i = 0; i < input_cluster_msg.feature_objects.size(); ++i) {
+    const auto & feature_object = input_cluster_msg.feature_objects.at(i);
+    if (feature_object.feature.cluster.data.empty()) {
+      continue;
+    }
+
+    if (is_far_enough(feature_object, fusion_distance_)) {
+      continue;
+    }
+
+    // filter point out of scope
+    if (debugger_ && out_of_scope(feature_object)) {
+      continue;
+    }
+    is_fusible[i] = true;
+  }
+  return is_fusible;
+}
+
+std::optional<RoiClusterFusionNode::ClusterRois> RoiClusterFusionNode::project_clusters(
+  const ClusterMsgType & input_cluster_msg, const std::vector<bool> & is_fusible,
+  const Det2dStatus<RoiMsgType> & det2d_status, const RoiMsgType & input_rois_msg) const
+{
+  const sensor_msgs::msg::CameraInfo camera_info =
     det2d_status.camera_projector_ptr->getCameraInfo();
 
   // get transform from cluster frame id to camera optical frame id
@@ -122,50 +189,38 @@ void RoiClusterFusionNode::fuse_on_single_image(
       RCLCPP_WARN_STREAM(
         get_logger(), "Failed to get transform from " << input_cluster_msg.header.frame_id << " to "
                                                       << input_rois_msg.header.frame_id);
-      return;
+      return std::nullopt;
     }
     transform_stamped = transform_stamped_optional.value();
   }
-
-  std::map<std::size_t, RegionOfInterest> m_cluster_roi;
-
-  std::vector<sensor_msgs::msg::RegionOfInterest> debug_image_rois;
-  std::vector<Eigen::Vector2d> debug_obstacle_points;
-  std::vector<sensor_msgs::msg::RegionOfInterest> debug_obstacle_rois;
-  std::vector<double> debug_max_iou_for_image_rois;
-
+  // same transform in float as tf2::doTransform of a PointCloud2, applied to the points on the fly
+  // instead of copying each cluster
+  const auto & translation = transform_stamped.transform.translation;
+  const auto & rotation = transform_stamped.transform.rotation;
+  const Eigen::Affine3f cluster2camera =
+    Eigen::Translation3f(translation.x, translation.y, translation.z) *
+    Eigen::Quaternionf(rotation.w, rotation.x, rotation.y, rotation.z);
+
+  ClusterRois cluster_rois;
   for (std::size_t i = 0; i < input_cluster_msg.feature_objects.size(); ++i) {
-    if (input_cluster_msg.feature_objects.at(i).feature.cluster.data.empty()) {
+    if (!is_fusible[i]) {
       continue;
     }
 
-    if (is_far_enough(input_cluster_msg.feature_objects.at(i), fusion_distance_)) {
-      continue;
-    }
-
-    // filter point out of scope
-    if (debugger_ && out_of_scope(input_cluster_msg.feature_objects.at(i))) {
-      continue;
-    }
-
-    sensor_msgs::msg::PointCloud2 transformed_cluster;
-    tf2::doTransform(
-      input_cluster_msg.feature_objects.at(i).feature.cluster, transformed_cluster,
-      transform_stamped);
-
+    const auto & cluster = input_cluster_msg.feature_objects.at(i).feature.cluster;
     int min_x(camera_info.width), min_y(camera_info.height), max_x(0), max_y(0);
-    std::vector<Eigen::Vector2d> projected_points;
-    projected_points.reserve(transformed_cluster.data.size());
-    for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(transformed_cluster, "x"),
-         iter_y(transformed_cluster, "y"), iter_z(transformed_cluster, "z");
+    bool is_projected = false;
+    for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(cluster, "x"), iter_y(cluster, "y"),
+         iter_z(cluster, "z");
          iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
-      if (*iter_z <= 0.0) {
+      const Eigen::Vector3f point = cluster2camera * Eigen::Vector3f(*iter_x, *iter_y, *iter_z);
+      if (point.z() <= 0.0) {
         continue;
       }
 
       Eigen::Vector2d projected_point;
       if (det2d_status.camera_projector_ptr->calcImageProjectedPoint(
-            cv::Point3d(*iter_x, *iter_y, *iter_z), projected_point)) {
+            cv::Point3d(point.x(), point.y(), point.z()), projected_point)) {
         const int px = static_cast<int>(projected_point.x());
         const int py = static_cast<int>(projected_point.y());
 
@@ -174,11 +229,11 @@ void RoiClusterFusionNode::fuse_on_single_image(
         max_x = std::max(px, max_x);
         max_y = std::max(py, max_y);
 
-        projected_points.push_back(projected_point);
-        if (debugger_) debug_obstacle_points.push_back(projected_point);
+        is_projected = true;
+        if (debugger_) cluster_rois.debug_projected_points.push_back(projected_point);
       }
     }
-    if (projected_points.empty()) {
+    if (!is_projected) {
       continue;
     }
 
@@ -187,9 +242,36 @@ void RoiClusterFusionNode::fuse_on_single_image(
     roi.y_offset = min_y;
     roi.width = max_x - min_x;
     roi.height = max_y - min_y;
-    m_cluster_roi.emplace(i, roi);
-    if (debugger_) debug_obstacle_rois.push_back(roi);
+    cluster_rois.cluster_indices.push_back(i);
+    cluster_rois.rois.push_back(roi);
   }
+  return cluster_rois;
+}
+
+void RoiClusterFusionNode::associate_rois(
+  const ClusterMsgType & input_cluster_msg, const Det2dStatus<RoiMsgType> & det2d_status,
+  const RoiMsgType & input_rois_msg, const ClusterRois & cluster_rois,
+  ClusterMsgType & output_cluster_msg)
+{
+  const sensor_msgs::msg::CameraInfo camera_info =
+    det2d_status.camera_projector_ptr->getCameraInfo();
+
+  // all the IoU modes are zero for RoIs that do not intersect, so only the clusters sharing a cell
+  // of the grid with the image RoI are evaluated. The candidates are visited in ascending order of
+  // cluster index to keep the first cluster of maximum IoU
+  std::vector<sensor_msgs::msg::RegionOfInterest> sanitized_cluster_rois = cluster_rois.rois;
+  std::vector<bool> use_rough_iou_match(cluster_rois.rois.size());
+  RoiGridIndex cluster_roi_index(camera_info.width, camera_info.height, roi_grid_cell_size);
+  for (std::size_t j = 0; j < sanitized_cluster_rois.size(); ++j) {
+    sanitizeROI(sanitized_cluster_rois[j], camera_info.width, camera_info.height);
+    use_rough_iou_match[j] = is_far_enough(
+      input_cluster_msg.feature_objects.at(cluster_rois.cluster_indices[j]),
+      strict_iou_fusion_distance_);
+    cluster_roi_index.insert(sanitized_cluster_rois[j], j);
+  }
+
+  std::vector<sensor_msgs::msg::RegionOfInterest> debug_image_rois;
+  std::vector<double> debug_max_iou_for_image_rois;
 
   for (const auto & feature_obj : input_rois_msg.feature_objects) {
     int index = -1;
@@ -200,13 +282,10 @@ void RoiClusterFusionNode::fuse_on_single_image(
     auto image_roi = feature_obj.feature.roi;
     sanitizeROI(image_roi, camera_info.width, camera_info.height);
     const bool is_roi_label_known = obj_label != ObjectClassification::UNKNOWN;
-    for (const auto & cluster_map : m_cluster_roi) {
+    for (const auto j : cluster_roi_index.query(image_roi)) {
       double iou(0.0);
-      bool use_rough_iou_match = is_far_enough(
-        input_cluster_msg.feature_objects.at(cluster_map.first), strict_iou_fusion_distance_);
-      auto cluster_roi = cluster_map.second;
-      sanitizeROI(cluster_roi, camera_info.width, camera_info.height);
-      if (use_rough_iou_match || (!is_roi_label_known)) {
+      const auto & cluster_roi = sanitized_cluster_rois[j];
+      if (use_rough_iou_match[j] || (!is_roi_label_known)) {
         iou = cal_iou_by_mode(cluster_roi, image_roi, rough_iou_match_mode_);
       } else {
         iou = cal_iou_by_mode(cluster_roi, image_roi, strict_iou_match_mode_);
@@ -215,7 +294,7 @@ void RoiClusterFusionNode::fuse_on_single_image(
       const bool passed_inside_cluster_gate =
         only_allow_inside_cluster_ ? is_inside(image_roi, cluster_roi, roi_scale_factor_) : true;
       if (max_iou < iou && passed_inside_cluster_gate) {
-        index = cluster_map.first;
+        index = cluster_rois.cluster_indices[j];
         max_iou = iou;
         associated = true;
       }
@@ -260,16 +339,16 @@ void RoiClusterFusionNode::fuse_on_single_image(
   // TODO(badai-nguyen): revise the shared debugger_ usage
   if (debugger_) {
     debugger_->image_rois_ = debug_image_rois;
-    debugger_->obstacle_rois_ = debug_obstacle_rois;
-    debugger_->obstacle_points_ = debug_obstacle_points;
+    debugger_->obstacle_rois_ = cluster_rois.rois;
+    debugger_->obstacle_points_ = cluster_rois.debug_projected_points;
     debugger_->max_iou_for_image_rois_ = debug_max_iou_for_image_rois;
     debugger_->publishImage(det2d_status.id, input_rois_msg.header.stamp);
   }
 }
 
-bool RoiClusterFusionNode::out_of_scope(const DetectedObjectWithFeature & obj)
+bool RoiClusterFusionNode::out_of_scope(const DetectedObjectWithFeature & obj) const
 {
-  auto cluster = obj.feature.cluster;
+  const auto & cluster = obj.feature.cluster;
   bool is_out = false;
   auto valid_point = [](float p, float min_num, float max_num) -> bool {
     return (p > min_num) && (p < max_num);
@@ -298,7 +377,7 @@ bool RoiClusterFusionNode::out_of_scope(const DetectedObjectWithFeature & obj)
 }
 
 bool RoiClusterFusionNode::is_far_enough(
-  const DetectedObjectWithFeature & obj, const double distance_threshold)
+  const DetectedObjectWithFeature & obj, const double distance_threshold) const
 {
   const auto & position = obj.object.kinematics.pose_with_covariance.pose.position;
   return position.x * position.x + position.y * position.y >
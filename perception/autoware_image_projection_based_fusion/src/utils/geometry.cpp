@@ -16,6 +16,7 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <algorithm>
 #include <vector>
 
 namespace autoware::image_projection_based_fusion
@@ -223,4 +224,52 @@ void sanitizeROI(sensor_msgs::msg::RegionOfInterest & roi, const int width_, con
   }
 }
 
+RoiGridIndex::RoiGridIndex(
+  const uint32_t image_width, const uint32_t image_height, const uint32_t cell_size)
+: cell_size_(std::max<uint32_t>(cell_size, 1)),
+  cols_(image_width / cell_size_ + 1),
+  rows_(image_height / cell_size_ + 1),
+  cells_(cols_ * rows_)
+{
+}
+
+RoiGridIndex::CellRange RoiGridIndex::get_cell_range(
+  const sensor_msgs::msg::RegionOfInterest & roi) const
+{
+  // clamping keeps the mapping from pixel to cell monotonic
+  const auto to_cell = [this](const uint64_t pixel, const std::size_t cells_nb) {
+    return std::min<std::size_t>(pixel / cell_size_, cells_nb - 1);
+  };
+  const uint64_t x_offset = roi.x_offset;
+  const uint64_t y_offset = roi.y_offset;
+  return {
+    to_cell(x_offset, cols_), to_cell(y_offset, rows_), to_cell(x_offset + roi.width, cols_),
+    to_cell(y_offset + roi.height, rows_)};
+}
+
+void RoiGridIndex::insert(const sensor_msgs::msg::RegionOfInterest & roi, const std::size_t id)
+{
+  const auto range = get_cell_range(roi);
+  for (std::size_t y = range.min_y; y <= range.max_y; ++y) {
+    for (std::size_t x = range.min_x; x <= range.max_x; ++x) {
+      cells_[y * cols_ + x].push_back(id);
+    }
+  }
+}
+
+std::vector<std::size_t> RoiGridIndex::query(const sensor_msgs::msg::RegionOfInterest & roi) const
+{
+  std::vector<std::size_t> ids;
+  const auto range = get_cell_range(roi);
+  for (std::size_t y = range.min_y; y <= range.max_y; ++y) {
+    for (std::size_t x = range.min_x; x <= range.max_x; ++x) {
+      const auto & cell = cells_[y * cols_ + x];
+      ids.insert(ids.end(), cell.begin(), cell.end());
+    }
+  }
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+  return ids;
+}
+
 }  // namespace autoware::image_projection_based_fusion
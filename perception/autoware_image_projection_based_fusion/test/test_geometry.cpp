@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <vector>
 
 TEST(objectToVertices, test_objectToVertices)
@@ -202,6 +203,58 @@ TEST(sanitizeROI, test_sanitizeROI)
   }
 }
 
+TEST(RoiGridIndex, test_query)
+{
+  const auto make_roi = [](uint32_t x_offset, uint32_t y_offset, uint32_t width, uint32_t height) {
+    sensor_msgs::msg::RegionOfInterest roi;
+    roi.x_offset = x_offset;
+    roi.y_offset = y_offset;
+    roi.width = width;
+    roi.height = height;
+    return roi;
+  };
+  const auto intersects = [](
+                            const sensor_msgs::msg::RegionOfInterest & roi_1,
+                            const sensor_msgs::msg::RegionOfInterest & roi_2) {
+    return roi_1.x_offset <= roi_2.x_offset + roi_2.width &&
+           roi_2.x_offset <= roi_1.x_offset + roi_1.width &&
+           roi_1.y_offset <= roi_2.y_offset + roi_2.height &&
+           roi_2.y_offset <= roi_1.y_offset + roi_1.height;
+  };
+
+  const uint32_t image_width = 1920;
+  const uint32_t image_height = 1080;
+  autoware::image_projection_based_fusion::RoiGridIndex grid_index(image_width, image_height, 64);
+  std::vector<sensor_msgs::msg::RegionOfInterest> rois;
+  for (uint32_t i = 0; i < 200; ++i) {
+    // deterministic spread of RoIs, including RoIs on the border of the image
+    rois.push_back(make_roi(
+      (i * 97) % (image_width + 10), (i * 61) % (image_height + 10), (i * 13) % 300,
+      (i * 7) % 200));
+    grid_index.insert(rois.back(), i);
+  }
+
+  for (uint32_t i = 0; i < 50; ++i) {
+    const auto query_roi =
+      make_roi((i * 151) % image_width, (i * 89) % image_height, (i * 29) % 400, (i * 17) % 300);
+    const auto ids = grid_index.query(query_roi);
+    EXPECT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+    EXPECT_EQ(std::adjacent_find(ids.begin(), ids.end()), ids.end());
+    for (std::size_t id = 0; id < rois.size(); ++id) {
+      if (intersects(rois.at(id), query_roi)) {
+        EXPECT_TRUE(std::binary_search(ids.begin(), ids.end(), id));
+      }
+    }
+  }
+
+  // RoIs touching by a corner are candidates, distant RoIs are not
+  autoware::image_projection_based_fusion::RoiGridIndex touching_index(
+    image_width, image_height, 64);
+  touching_index.insert(make_roi(0, 0, 64, 64), 0);
+  EXPECT_EQ(touching_index.query(make_roi(64, 64, 10, 10)).size(), 1u);
+  EXPECT_TRUE(touching_index.query(make_roi(130, 0, 10, 10)).empty());
+}
+
 int main(int argc, char * argv[])
 {
   testing::InitGoogleTest(&argc, argv);
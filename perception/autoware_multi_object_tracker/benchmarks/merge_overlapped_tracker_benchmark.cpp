@@ -0,0 +1,90 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/processor/processor.hpp"
+#include "../test/test_bench.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <optional>
+
+using std::chrono_literals::operator""ms;
+
+int main()
+{
+  try {
+    constexpr auto nb_iterations = 50;
+    const auto processor_config = createProcessorConfig();
+    const auto associator_config = createAssociatorConfig();
+    const auto input_channels_config = createInputChannelsConfig();
+    std::printf("nb_objects, nb_trackers, prune_avg_ns, prune_max_ns\n");
+    // scenario of 100 objects (60 cars, 20 pedestrians and 20 unknown objects) scaled up to 500
+    for (const auto scale : {1, 2, 3, 4, 5}) {
+      ScenarioParams params;
+      params.num_lanes = 2 * scale;
+      params.cars_per_lane = 30;
+      params.pedestrian_clusters = 4 * scale;
+      params.pedestrians_per_cluster = 5;
+      params.unknown_objects = 20 * scale;
+
+      auto processor = std::make_unique<autoware::multi_object_tracker::TrackerProcessor>(
+        processor_config, associator_config, input_channels_config);
+      TestBench simulator(params);
+      simulator.initializeObjects();
+
+      rclcpp::Clock clock;
+      rclcpp::Time current_time = rclcpp::Time(clock.now(), RCL_ROS_TIME);
+      std::chrono::nanoseconds prune_time{0};
+      std::chrono::nanoseconds prune_max_time{0};
+      size_t nb_trackers = 0;
+      for (auto i = 0; i < nb_iterations; ++i) {
+        current_time += 100ms;
+        auto detections = simulator.generateDetections(current_time);
+        detections = autoware::multi_object_tracker::uncertainty::modelUncertainty(detections);
+        processor->predict(current_time, std::nullopt);
+        const auto association_result = processor->associate(detections);
+        const autoware::multi_object_tracker::types::AssociatedObjects associated_objects{
+          detections, association_result};
+        processor->update(associated_objects);
+        nb_trackers += processor->getListTracker().size();
+        // the overlapped trackers are merged in the prune step
+        const auto prune_start = std::chrono::steady_clock::now();
+        processor->prune(current_time);
+        const auto prune_end = std::chrono::steady_clock::now();
+        processor->spawn(associated_objects);
+        const auto time =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(prune_end - prune_start);
+        prune_time += time;
+        prune_max_time = std::max(prune_max_time, time);
+      }
+      std::printf(
+        "%d, %lu, %ld, %ld\n",
+        params.num_lanes * params.cars_per_lane +
+          params.pedestrian_clusters * params.pedestrians_per_cluster + params.unknown_objects,
+        nb_trackers / nb_iterations, prune_time.count() / nb_iterations, prune_max_time.count());
+    }
+  } catch (const std::exception & e) {
+    std::cerr << "Exception in main(): " << e.what() << std::endl;
+    return {};
+  } catch (...) {
+    std::cerr << "Unknown exception in main()" << std::endl;
+    return {};
+  }
+  return 0;
+}
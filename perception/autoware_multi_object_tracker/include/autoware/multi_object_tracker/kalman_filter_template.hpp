@@ -186,6 +186,46 @@ public:
    */
   bool predict(const StateVec & x_next, const ProcessMat & A) { return predict(x_next, A, Q_); }
 
+  /**
+   * @brief same as predict(x_next, A, Q) for a block triangular A = [A11 A12; 0 D], where A11 is
+   * UpperSize x UpperSize and D is diagonal, e.g. when the velocities are propagated on their own.
+   * The zero and off-diagonal blocks are skipped in the covariance propagation, which assumes a
+   * symmetric covariance.
+   * @param x_next predicted state
+   * @param A coefficient matrix of x for process model
+   * @param Q covariance matrix for process model
+   * @return bool to check matrix operations are being performed properly
+   */
+  template <int UpperSize>
+  bool predictBlockTriangular(const StateVec & x_next, const ProcessMat & A, const StateMat & Q)
+  {
+    static_assert(
+      UpperSize > 0 && UpperSize < StateSize, "UpperSize must be in [1, StateSize - 1]");
+    constexpr int LowerSize = StateSize - UpperSize;
+    const auto A11 = A.template topLeftCorner<UpperSize, UpperSize>();
+    const auto A12 = A.template topRightCorner<UpperSize, LowerSize>();
+    const auto D = A.template bottomRightCorner<LowerSize, LowerSize>().diagonal().asDiagonal();
+
+    // upper rows of A * P, the lower ones are D * P_lower
+    const Eigen::Matrix<Scalar, UpperSize, StateSize> AP_upper =
+      A11 * P_.template topRows<UpperSize>() + A12 * P_.template bottomRows<LowerSize>();
+
+    StateMat P_next;
+    P_next.template topLeftCorner<UpperSize, UpperSize>().noalias() =
+      AP_upper.template leftCols<UpperSize>() * A11.transpose() +
+      AP_upper.template rightCols<LowerSize>() * A12.transpose();
+    P_next.template topRightCorner<UpperSize, LowerSize>().noalias() =
+      AP_upper.template rightCols<LowerSize>() * D;
+    P_next.template bottomLeftCorner<LowerSize, UpperSize>() =
+      P_next.template topRightCorner<UpperSize, LowerSize>().transpose();
+    P_next.template bottomRightCorner<LowerSize, LowerSize>().noalias() =
+      D * P_.template bottomRightCorner<LowerSize, LowerSize>() * D;
+
+    x_ = x_next;
+    P_ = P_next + Q;
+    return true;
+  }
+
   /**
    * @brief predict
    * @param u control vector
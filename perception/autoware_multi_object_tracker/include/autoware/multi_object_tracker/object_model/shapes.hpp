@@ -18,6 +18,7 @@
 #include "autoware/multi_object_tracker/object_model/types.hpp"
 
 #include <Eigen/Core>
+#include <autoware_utils_geometry/boost_geometry.hpp>
 
 #include <tf2_ros/buffer.h>
 
@@ -36,13 +37,27 @@ double get2dIoU(
   const types::DynamicObject & source_object, const types::DynamicObject & target_object,
   const double min_union_area = 0.01);
 
+// overload for footprints which are already computed, e.g. cached for several comparisons
+double get2dIoU(
+  const autoware_utils_geometry::Polygon2d & source_polygon,
+  const autoware_utils_geometry::Polygon2d & target_polygon, const double min_union_area = 0.01);
+
 double get2dGeneralizedIoU(
   const types::DynamicObject & source_object, const types::DynamicObject & target_object);
 
+double get2dGeneralizedIoU(
+  const autoware_utils_geometry::Polygon2d & source_polygon,
+  const autoware_utils_geometry::Polygon2d & target_polygon);
+
 bool get2dPrecisionRecallGIoU(
   const types::DynamicObject & source_object, const types::DynamicObject & target_object,
   double & precision, double & recall, double & generalized_iou);
 
+bool get2dPrecisionRecallGIoU(
+  const autoware_utils_geometry::Polygon2d & source_polygon,
+  const autoware_utils_geometry::Polygon2d & target_polygon, double & precision, double & recall,
+  double & generalized_iou);
+
 bool convertConvexHullToBoundingBox(
   const types::DynamicObject & input_object, types::DynamicObject & output_object);
 
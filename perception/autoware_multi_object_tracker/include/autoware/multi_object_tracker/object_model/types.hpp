@@ -35,6 +35,7 @@
 #include <boost/optional.hpp>
 
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -253,7 +254,8 @@ struct ObjectsWithAssociation
   }
 };
 
-using ObjectsWithAssociationList = std::vector<ObjectsWithAssociation>;
+// the objects are shared between the input queues and the processing without copy
+using ObjectsWithAssociationList = std::vector<std::shared_ptr<const ObjectsWithAssociation>>;
 
 DynamicObject toDynamicObject(
   const autoware_perception_msgs::msg::DetectedObject & det_object, const uint channel_index = 0);
@@ -121,6 +121,14 @@ double get2dIoU(
   if (boost::geometry::area(source_polygon) < MIN_AREA) return 0.0;
   const auto target_polygon =
     autoware_utils_geometry::to_polygon2d(target_object.pose, target_object.shape);
+  return get2dIoU(source_polygon, target_polygon, min_union_area);
+}
+
+double get2dIoU(
+  const autoware_utils_geometry::Polygon2d & source_polygon,
+  const autoware_utils_geometry::Polygon2d & target_polygon, const double min_union_area)
+{
+  if (boost::geometry::area(source_polygon) < MIN_AREA) return 0.0;
   if (boost::geometry::area(target_polygon) < MIN_AREA) return 0.0;
 
   const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
@@ -135,13 +143,20 @@ double get2dIoU(
 double get2dGeneralizedIoU(
   const types::DynamicObject & source_object, const types::DynamicObject & target_object)
 {
-  static const double MIN_AREA = 1e-6;
-
   const auto source_polygon =
     autoware_utils_geometry::to_polygon2d(source_object.pose, source_object.shape);
-  const double source_area = boost::geometry::area(source_polygon);
   const auto target_polygon =
     autoware_utils_geometry::to_polygon2d(target_object.pose, target_object.shape);
+  return get2dGeneralizedIoU(source_polygon, target_polygon);
+}
+
+double get2dGeneralizedIoU(
+  const autoware_utils_geometry::Polygon2d & source_polygon,
+  const autoware_utils_geometry::Polygon2d & target_polygon)
+{
+  static const double MIN_AREA = 1e-6;
+
+  const double source_area = boost::geometry::area(source_polygon);
   const double target_area = boost::geometry::area(target_polygon);
   if (source_area < MIN_AREA && target_area < MIN_AREA) return -1.0;
 
@@ -157,14 +172,24 @@ bool get2dPrecisionRecallGIoU(
   const types::DynamicObject & source_object, const types::DynamicObject & target_object,
   double & precision, double & recall, double & generalized_iou)
 {
-  static const double MIN_AREA = 1e-6;
-
   const auto source_polygon =
     autoware_utils_geometry::to_polygon2d(source_object.pose, source_object.shape);
-  const double source_area = boost::geometry::area(source_polygon);
-  if (source_area < MIN_AREA) return false;
+  if (boost::geometry::area(source_polygon) < MIN_AREA) return false;
   const auto target_polygon =
     autoware_utils_geometry::to_polygon2d(target_object.pose, target_object.shape);
+  return get2dPrecisionRecallGIoU(
+    source_polygon, target_polygon, precision, recall, generalized_iou);
+}
+
+bool get2dPrecisionRecallGIoU(
+  const autoware_utils_geometry::Polygon2d & source_polygon,
+  const autoware_utils_geometry::Polygon2d & target_polygon, double & precision, double & recall,
+  double & generalized_iou)
+{
+  static const double MIN_AREA = 1e-6;
+
+  const double source_area = boost::geometry::area(source_polygon);
+  if (source_area < MIN_AREA) return false;
   const double target_area = boost::geometry::area(target_polygon);
   if (target_area < MIN_AREA) return false;
 
@@ -633,8 +633,8 @@ bool BicycleMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) c
   // Eigen::MatrixXd B = Eigen::MatrixXd::Zero(DIM, DIM);
   // Eigen::MatrixXd u = Eigen::MatrixXd::Zero(DIM, 1);
 
-  // predict state
-  return ekf.predict(X_next_t, A, Q);
+  // predict state, the velocity rows of A are diagonal
+  return ekf.predictBlockTriangular<IDX::U>(X_next_t, A, Q);
 }
 
 bool BicycleMotionModel::getPredictedState(
@@ -308,8 +308,8 @@ bool CTRVMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) cons
   // Eigen::MatrixXd B = Eigen::MatrixXd::Zero(DIM, DIM);
   // Eigen::MatrixXd u = Eigen::MatrixXd::Zero(DIM, 1);
 
-  // predict state
-  return ekf.predict(X_next_t, A, Q);
+  // predict state, the velocity rows of A are diagonal
+  return ekf.predictBlockTriangular<IDX::VEL>(X_next_t, A, Q);
 }
 
 bool CTRVMotionModel::getPredictedState(
@@ -217,8 +217,8 @@ bool CVMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) const
   // Eigen::MatrixXd B = Eigen::MatrixXd::Zero(DIM, DIM);
   // Eigen::MatrixXd u = Eigen::MatrixXd::Zero(DIM, 1);
 
-  // predict state
-  return ekf.predict(X_next_t, A, Q);
+  // predict state, the velocity rows of A are diagonal
+  return ekf.predictBlockTriangular<IDX::VX>(X_next_t, A, Q);
 }
 
 bool CVMotionModel::getPredictedState(
@@ -250,21 +250,26 @@ MeasurementProcessingResult process_measurement(
   result.has_objects = false;
   result.should_process = false;
 
-  const auto objects = state.input_manager->processMessage(channel_index, msg);
+  auto objects = state.input_manager->processMessage(channel_index, msg);
   if (!objects) {
     return result;
   }
 
-  const auto association_result = state.processor->associate(*objects);
-  state.input_manager->push(channel_index, *objects, association_result);
+  auto association_result = state.processor->associate(*objects);
+  // the objects are immutable from here, and shared with the input manager without copy
+  const auto objects_with_association = std::make_shared<const types::ObjectsWithAssociation>(
+    types::ObjectsWithAssociation{std::move(*objects), std::move(association_result)});
+  state.input_manager->push(channel_index, objects_with_association);
 
   result.has_objects = true;
   result.should_process = (channel_index == state.input_manager->getTargetChannelIdx());
 
-  const auto measurement_time = rclcpp::Time(objects->header.stamp, current_time.get_clock_type());
+  const auto measurement_time =
+    objects_with_association->getTimestamp(current_time.get_clock_type());
 
   // Collect debug information - tracker list, existence probabilities, association results
-  const types::AssociatedObjects associated_objects{*objects, association_result};
+  const types::AssociatedObjects associated_objects{
+    objects_with_association->objects, objects_with_association->association};
   debugger.collectObjectInfo(
     measurement_time, state.processor->getListTracker(), associated_objects);
 
@@ -326,16 +331,16 @@ ObjectProcessingResult process_objects_batch(
   }
 
   // process start - start measurement time before processing
-  debugger.startMeasurementTime(current_time, objects_with_associations.back().getTimestamp());
+  debugger.startMeasurementTime(current_time, objects_with_associations.back()->getTimestamp());
 
   // run process for each DynamicObject
   for (const auto & objects_data : objects_with_associations) {
-    process_objects_(objects_data, current_time, state, logger);
+    process_objects_(*objects_data, current_time, state, logger);
   }
 
   // Update last_updated_time and last_tracker_time
   state.last_updated_time = current_time;
-  state.last_tracker_time = objects_with_associations.back().getTimestamp();
+  state.last_tracker_time = objects_with_associations.back()->getTimestamp();
 
   // process end - end measurement time after processing
   debugger.endMeasurementTime(current_time);
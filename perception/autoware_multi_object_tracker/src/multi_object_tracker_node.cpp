@@ -22,6 +22,7 @@
 
 #include <autoware_perception_msgs/msg/object_classification.hpp>
 
+#include <algorithm>
 #include <array>
 #include <iomanip>
 #include <list>
@@ -147,6 +148,7 @@ MultiObjectTracker::MultiObjectTracker(const rclcpp::NodeOptions & node_options)
     declare_parameter<double>("pruning_moving_object_speed");
   params_.processor_config.pruning_static_iou_threshold =
     declare_parameter<double>("pruning_static_iou_threshold");
+  params_.processor_config.num_threads = std::max(declare_parameter<int>("num_threads"), 1);
 
   // overlap distance threshold
   params_.pruning_distance_thresholds =
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -50,17 +51,17 @@ InputStream::InputStream(
 }
 
 void InputStream::push(
-  const types::DynamicObjectList & objects, const types::AssociationResult & association)
+  const std::shared_ptr<const types::ObjectsWithAssociation> & objects_with_association)
 {
-  // Move the objects_with_uncertainty to the objects queue
-  objects_que_.push_back(types::ObjectsWithAssociation{objects, association});
+  // Store the shared objects in the objects queue
+  objects_que_.push_back(objects_with_association);
   while (objects_que_.size() > que_size_) {
     objects_que_.pop_front();
   }
 
   // update the timing statistics
   rclcpp::Time now = clock_->now();
-  rclcpp::Time objects_time(objects.header.stamp);
+  rclcpp::Time objects_time = objects_with_association->getTimestamp();
   updateTimingStatus(now, objects_time);
 
   // trigger the function if it is set
@@ -94,7 +95,7 @@ std::optional<types::DynamicObjectList> InputStream::processMessage(
       channel_.long_name.c_str());
     return std::nullopt;
   }
-  dynamic_objects = transformed_objects.value();
+  dynamic_objects = std::move(transformed_objects.value());
 
   // object shape processing
   for (auto & object : dynamic_objects.objects) {
@@ -217,7 +218,7 @@ void InputStream::getObjectsOlderThan(
   }
 
   for (const auto & objects_pair : objects_que_) {
-    const rclcpp::Time object_time = objects_pair.getTimestamp();
+    const rclcpp::Time object_time = objects_pair->getTimestamp();
     // ignore objects older than the specified duration
     if (object_time < object_earliest_time) {
       continue;
@@ -231,7 +232,7 @@ void InputStream::getObjectsOlderThan(
 
   // remove objects older than 'object_latest_time'
   while (!objects_que_.empty()) {
-    const rclcpp::Time object_time = objects_que_.front().getTimestamp();
+    const rclcpp::Time object_time = objects_que_.front()->getTimestamp();
     if (object_time < object_latest_time) {
       objects_que_.pop_front();
     } else {
@@ -280,8 +281,8 @@ void InputManager::init(const std::vector<types::InputChannel> & input_channels)
 }
 
 void InputManager::push(
-  const size_t channel_index, const types::DynamicObjectList & objects,
-  const types::AssociationResult & association)
+  const size_t channel_index,
+  const std::shared_ptr<const types::ObjectsWithAssociation> & objects_with_association)
 {
   if (channel_index >= input_streams_.size()) {
     RCLCPP_WARN(
@@ -289,7 +290,10 @@ void InputManager::push(
       channel_index, input_streams_.size());
     return;
   }
-  input_streams_.at(channel_index)->push(objects, association);
+  input_streams_.at(channel_index)->push(objects_with_association);
+
+  // Only the statistics of this stream changed, update the target stream with them
+  updateTargetStream(channel_index);
 }
 
 std::optional<types::DynamicObjectList> InputManager::processMessage(
@@ -385,6 +389,34 @@ void InputManager::optimizeTimings()
   target_stream_interval_std_ = selected_stream_interval_std;
 }
 
+void InputManager::updateTargetStream(const size_t channel_index)
+{
+  const auto & input_stream = input_streams_.at(channel_index);
+  if (!input_stream->isTimeInitialized()) return;
+
+  double latency_mean, latency_var, interval_mean, interval_var;
+  input_stream->getTimeStatistics(latency_mean, latency_var, interval_mean, interval_var);
+
+  const bool is_target = input_stream->getIndex() == target_stream_idx_;
+  if (
+    !input_streams_.at(target_stream_idx_)->isTimeInitialized() || target_stream_latency_ <= 0.0 ||
+    (is_target && latency_mean < target_stream_latency_)) {
+    // no target stream was selected from a measured latency yet, or the latency of the target
+    // stream decreased and another stream may have the maximum latency
+    optimizeTimings();
+    return;
+  }
+
+  // select the stream if it has the maximum latency
+  if (is_target || latency_mean > target_stream_latency_) {
+    target_stream_idx_ = input_stream->getIndex();
+    target_stream_latency_ = latency_mean;
+    target_stream_latency_std_ = std::sqrt(latency_var);
+    target_stream_interval_ = interval_mean;
+    target_stream_interval_std_ = std::sqrt(interval_var);
+  }
+}
+
 bool InputManager::getObjects(
   const rclcpp::Time & now, types::ObjectsWithAssociationList & objects_with_associations)
 {
@@ -401,10 +433,7 @@ bool InputManager::getObjects(
   rclcpp::Time object_earliest_time;
   getObjectTimeInterval(now, object_latest_time, object_earliest_time);
 
-  // Optimize the target stream, latency, and its band
-  // The result will be used for the next time, so the optimization is after getting the time
-  // interval
-  optimizeTimings();
+  // The target stream, latency, and its band are updated incrementally when the objects are pushed
 
   // Get objects from all input streams
   // adds up to the objects vector for efficient processing
@@ -417,13 +446,13 @@ bool InputManager::getObjects(
   std::sort(
     objects_with_associations.begin(), objects_with_associations.end(),
     [](const auto & a, const auto & b) {
-      return (a.getTimestamp() - b.getTimestamp()).seconds() < 0;
+      return (a->getTimestamp() - b->getTimestamp()).seconds() < 0;
     });
 
   // Update the latest exported object time
   bool is_any_object = !objects_with_associations.empty();
   if (is_any_object) {
-    latest_exported_object_time_ = objects_with_associations.back().getTimestamp();
+    latest_exported_object_time_ = objects_with_associations.back()->getTimestamp();
   } else {
     // check time jump back
     if (now < latest_exported_object_time_) {
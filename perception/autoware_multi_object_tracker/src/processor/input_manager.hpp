@@ -29,6 +29,8 @@
 #include <utility>
 #include <vector>
 
+class InputManagerTest;
+
 namespace autoware::multi_object_tracker
 {
 
@@ -46,7 +48,7 @@ public:
 
   std::optional<types::DynamicObjectList> processMessage(
     const autoware_perception_msgs::msg::DetectedObjects::ConstSharedPtr msg);
-  void push(const types::DynamicObjectList & objects, const types::AssociationResult & association);
+  void push(const std::shared_ptr<const types::ObjectsWithAssociation> & objects_with_association);
   void updateTimingStatus(const rclcpp::Time & now, const rclcpp::Time & objects_time);
 
   bool isTimeInitialized() const { return initial_count_ > 0; }
@@ -74,7 +76,7 @@ private:
   rclcpp::Clock::SharedPtr clock_;
 
   size_t que_size_{30};
-  std::deque<types::ObjectsWithAssociation> objects_que_;
+  std::deque<std::shared_ptr<const types::ObjectsWithAssociation>> objects_que_;
 
   std::function<void(const size_t)> func_trigger_;
 
@@ -101,8 +103,8 @@ public:
     const size_t channel_index,
     const autoware_perception_msgs::msg::DetectedObjects::ConstSharedPtr msg);
   void push(
-    const size_t channel_index, const types::DynamicObjectList & objects,
-    const types::AssociationResult & association);
+    const size_t channel_index,
+    const std::shared_ptr<const types::ObjectsWithAssociation> & objects_with_association);
 
   bool getObjects(
     const rclcpp::Time & now, types::ObjectsWithAssociationList & objects_with_associations);
@@ -130,6 +132,9 @@ private:
     const rclcpp::Time & now, rclcpp::Time & object_latest_time,
     rclcpp::Time & object_earliest_time) const;
   void optimizeTimings();
+  void updateTargetStream(const size_t channel_index);
+
+  friend class ::InputManagerTest;
 };
 
 }  // namespace autoware::multi_object_tracker
@@ -20,15 +20,12 @@
 #include "autoware/multi_object_tracker/tracker/tracker.hpp"
 
 #include <autoware/object_recognition_utils/object_recognition_utils.hpp>
+#include <autoware_utils_geometry/boost_polygon_utils.hpp>
 
 #include <autoware_perception_msgs/msg/tracked_objects.hpp>
 
-#include <boost/geometry.hpp>
-#include <boost/geometry/geometries/box.hpp>
-#include <boost/geometry/geometries/point.hpp>
-#include <boost/geometry/index/rtree.hpp>
-
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <iterator>
 #include <map>
@@ -62,8 +59,15 @@ void TrackerProcessor::predict(
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
-  for (auto itr = list_tracker_.begin(); itr != list_tracker_.end(); ++itr) {
-    (*itr)->predict(time);
+  // the trackers are independent, so that they are predicted in parallel
+  tracker_buffer_.clear();
+  for (const auto & tracker : list_tracker_) {
+    tracker_buffer_.push_back(tracker.get());
+  }
+  const int trackers_nb = static_cast<int>(tracker_buffer_.size());
+#pragma omp parallel for num_threads(config_.num_threads) schedule(dynamic, 8)
+  for (int i = 0; i < trackers_nb; ++i) {
+    tracker_buffer_[i]->predict(time);
   }
 }
 
@@ -275,6 +279,8 @@ void TrackerProcessor::mergeOverlappedTracker(const rclcpp::Time & time)
     int measurement_count;
     double elapsed_time;
     bool is_valid;
+    // footprint at the given time, computed on the first IoU check of the tracker
+    std::optional<autoware_utils_geometry::Polygon2d> footprint;
 
     explicit TrackerData(const std::shared_ptr<Tracker> & t)
     : tracker(t),
@@ -287,10 +293,17 @@ void TrackerProcessor::mergeOverlappedTracker(const rclcpp::Time & time)
       is_valid(false)
     {
     }
+
+    const autoware_utils_geometry::Polygon2d & getFootprint()
+    {
+      if (!footprint) {
+        footprint = autoware_utils_geometry::to_polygon2d(object.pose, object.shape);
+      }
+      return *footprint;
+    }
   };
 
-  auto isIoUOverThreshold = [this](
-                              const TrackerData & target_data, const TrackerData & source_data) {
+  auto isIoUOverThreshold = [this](TrackerData & target_data, TrackerData & source_data) {
     constexpr double min_union_iou_area = 1e-2;
     constexpr float min_known_prob = 0.2;
     constexpr double min_valid_iou = 1e-6;
@@ -310,7 +323,8 @@ void TrackerProcessor::mergeOverlappedTracker(const rclcpp::Time & time)
       if (iou < min_valid_iou) return false;
       return iou > config_.min_known_object_removal_iou;
     } else if (is_target_known && is_source_known) {
-      iou = shapes::get2dIoU(source_data.object, target_data.object, min_union_iou_area);
+      iou = shapes::get2dIoU(
+        source_data.getFootprint(), target_data.getFootprint(), min_union_iou_area);
       if (iou < min_valid_iou) return false;
       return iou > config_.min_known_object_removal_iou;
     } else if (is_target_known || is_source_known) {
@@ -319,7 +333,8 @@ void TrackerProcessor::mergeOverlappedTracker(const rclcpp::Time & time)
       double recall = 0.0;
       double generalized_iou = 0.0;
       if (!shapes::get2dPrecisionRecallGIoU(
-            source_data.object, target_data.object, precision, recall, generalized_iou)) {
+            source_data.getFootprint(), target_data.getFootprint(), precision, recall,
+            generalized_iou)) {
         return false;
       }
       // Adjust generalized IoU threshold based on target object speed and static/moving status
@@ -335,7 +350,7 @@ void TrackerProcessor::mergeOverlappedTracker(const rclcpp::Time & time)
         generalized_iou > generalized_iou_threshold_unknown);
     } else {
       // both are unknown, use generalized IoU
-      iou = shapes::get2dGeneralizedIoU(source_data.object, target_data.object);
+      iou = shapes::get2dGeneralizedIoU(source_data.getFootprint(), target_data.getFootprint());
       return iou > generalized_iou_threshold;
     }
 
@@ -388,53 +403,52 @@ void TrackerProcessor::mergeOverlappedTracker(const rclcpp::Time & time)
       config_.pruning_distance_thresholds.at(static_cast<LabelType>(i));
   }
 
-  // Build spatial index for quick neighbor lookup
-  using Point = boost::geometry::model::point<double, 2, boost::geometry::cs::cartesian>;
-  using Value = std::pair<Point, size_t>;  // Point and index into valid_trackers
-  boost::geometry::index::rtree<Value, boost::geometry::index::quadratic<16>> rtree;
-
-  // Insert valid trackers into R-tree
-  std::vector<ValueType> rtree_points;
-  rtree_points.reserve(valid_trackers.size());
+  // Sort the trackers along x, so that the neighbors of a tracker are found by a sweep over the
+  // x interval of its search distance
+  std::vector<std::pair<double, size_t>> x_sorted_trackers;
+  x_sorted_trackers.reserve(valid_trackers.size());
   for (size_t i = 0; i < valid_trackers.size(); ++i) {
-    const auto & data = valid_trackers[i];
-    if (!data.is_valid) continue;
-
-    Point p(data.object.pose.position.x, data.object.pose.position.y);
-    rtree_points.emplace_back(p, i);
+    x_sorted_trackers.emplace_back(valid_trackers[i].object.pose.position.x, i);
   }
-  rtree.insert(rtree_points.begin(), rtree_points.end());
+  std::sort(x_sorted_trackers.begin(), x_sorted_trackers.end());
 
   // Vector to store indices of trackers to remove
   std::vector<size_t> to_remove;
   to_remove.reserve(valid_trackers.size() / 4);  // Reasonable initial capacity
 
+  std::vector<size_t> nearby;
+  nearby.reserve(16);  // Reasonable initial capacity
+
   // Second pass: merge overlapping trackers
   for (size_t i = 0; i < valid_trackers.size(); ++i) {
     auto & data1 = valid_trackers[i];
     if (!data1.is_valid || !data1.tracker->isConfident(adaptive_threshold_cache_, ego_pose_, time))
       continue;
 
-    // Find nearby trackers using R-tree
-    std::vector<Value> nearby;
-    nearby.reserve(16);  // Reasonable initial capacity
-
-    Point p1(data1.object.pose.position.x, data1.object.pose.position.y);
-    double max_search_dist_sq = search_distance_sq_per_label[data1.label];
-
-    // Query R-tree with circle
-    rtree.query(
-      boost::geometry::index::satisfies([&](const Value & v) {
-        if (v.second <= i) return false;  // Skip already processed and self
-
-        const double dx = boost::geometry::get<0>(v.first) - data1.object.pose.position.x;
-        const double dy = boost::geometry::get<1>(v.first) - data1.object.pose.position.y;
-        return dx * dx + dy * dy <= max_search_dist_sq;
-      }),
-      std::back_inserter(nearby));
+    // Find nearby trackers in the x interval of the search distance
+    const double x1 = data1.object.pose.position.x;
+    const double y1 = data1.object.pose.position.y;
+    const double max_search_dist_sq = search_distance_sq_per_label[data1.label];
+    const double max_search_dist = std::sqrt(max_search_dist_sq);
+
+    nearby.clear();
+    auto itr = std::lower_bound(
+      x_sorted_trackers.begin(), x_sorted_trackers.end(), x1 - max_search_dist,
+      [](const std::pair<double, size_t> & entry, const double x) { return entry.first < x; });
+    for (; itr != x_sorted_trackers.end() && itr->first <= x1 + max_search_dist; ++itr) {
+      if (itr->second <= i) continue;  // Skip already processed and self
+
+      const double dx = itr->first - x1;
+      const double dy = valid_trackers[itr->second].object.pose.position.y - y1;
+      if (dx * dx + dy * dy <= max_search_dist_sq) {
+        nearby.push_back(itr->second);
+      }
+    }
+    // keep the priority order of the trackers to merge
+    std::sort(nearby.begin(), nearby.end());
 
     // Process nearby trackers
-    for (const auto & [p2, idx2] : nearby) {
+    for (const auto idx2 : nearby) {
       auto & data2 = valid_trackers[idx2];
       if (!data2.is_valid) continue;
 
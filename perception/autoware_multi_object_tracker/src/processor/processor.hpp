@@ -50,6 +50,7 @@ struct TrackerProcessorConfig
   double pruning_static_object_speed;                                 // [m/s]
   double pruning_moving_object_speed;                                 // [m/s]
   double pruning_static_iou_threshold;                                // [ratio]
+  int num_threads{1};  // threads predicting the trackers
 };
 
 class TrackerProcessor
@@ -90,6 +91,7 @@ private:
   mutable rclcpp::Time last_prune_time_;
 
   std::list<std::shared_ptr<Tracker>> list_tracker_;
+  std::vector<Tracker *> tracker_buffer_;  // random access to the trackers for parallel loops
   void removeOldTracker(const rclcpp::Time & time);
   void mergeOverlappedTracker(const rclcpp::Time & time);
   bool canMergeOverlappedTarget(
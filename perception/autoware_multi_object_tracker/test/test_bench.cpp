@@ -66,6 +66,7 @@ autoware::multi_object_tracker::TrackerProcessorConfig createProcessorConfig()
   config.pruning_moving_object_speed = 5.5;   // [m/s]
   config.pruning_static_object_speed = 1.38;  // [m/s]
   config.pruning_static_iou_threshold = 0.0;  // [ratio]
+  config.num_threads = 4;
   // overlap distance threshold for each class
   config.pruning_distance_thresholds = {
     {ObjectClassification::UNKNOWN, 9.0}, {ObjectClassification::CAR, 5.0},
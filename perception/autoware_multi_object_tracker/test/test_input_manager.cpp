@@ -0,0 +1,110 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/processor/input_manager.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+using autoware::multi_object_tracker::InputManager;
+namespace types = autoware::multi_object_tracker::types;
+
+class InputManagerTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    clock_ = std::make_shared<rclcpp::Clock>(RCL_SYSTEM_TIME);
+    input_manager_ =
+      std::make_unique<InputManager>(nullptr, rclcpp::get_logger("test_input_manager"), clock_);
+
+    std::vector<types::InputChannel> input_channels(4);
+    for (size_t i = 0; i < input_channels.size(); ++i) {
+      input_channels.at(i).index = static_cast<uint>(i);
+    }
+    input_manager_->init(input_channels);
+  }
+
+  // push objects measured the given latency ago to the channel
+  void push(const size_t channel_index, const double latency)
+  {
+    types::DynamicObjectList objects;
+    objects.header.stamp = clock_->now() - rclcpp::Duration::from_seconds(latency);
+    objects.channel_index = static_cast<uint>(channel_index);
+    input_manager_->push(
+      channel_index, std::make_shared<const types::ObjectsWithAssociation>(
+                       types::ObjectsWithAssociation{objects, types::AssociationResult{}}));
+  }
+
+  // check that the incrementally updated target stream is the one of a full scan of the streams
+  void expectSameTargetAsFullScan()
+  {
+    const auto target_stream_idx = input_manager_->target_stream_idx_;
+    const auto target_stream_latency = input_manager_->target_stream_latency_;
+    const auto target_stream_latency_std = input_manager_->target_stream_latency_std_;
+    const auto target_stream_interval = input_manager_->target_stream_interval_;
+    const auto target_stream_interval_std = input_manager_->target_stream_interval_std_;
+
+    input_manager_->optimizeTimings();
+
+    EXPECT_EQ(target_stream_idx, input_manager_->target_stream_idx_);
+    EXPECT_DOUBLE_EQ(target_stream_latency, input_manager_->target_stream_latency_);
+    EXPECT_DOUBLE_EQ(target_stream_latency_std, input_manager_->target_stream_latency_std_);
+    EXPECT_DOUBLE_EQ(target_stream_interval, input_manager_->target_stream_interval_);
+    EXPECT_DOUBLE_EQ(target_stream_interval_std, input_manager_->target_stream_interval_std_);
+  }
+
+  // push objects to every channel in the order of the map, and check the target stream after
+  // each push
+  void pushAndCheck(const std::map<size_t, double> & latencies, const size_t num_cycles)
+  {
+    for (size_t cycle = 0; cycle < num_cycles; ++cycle) {
+      for (const auto & [channel_index, latency] : latencies) {
+        push(channel_index, latency);
+        expectSameTargetAsFullScan();
+      }
+    }
+  }
+
+  rclcpp::Clock::SharedPtr clock_;
+  std::unique_ptr<InputManager> input_manager_;
+};
+
+TEST_F(InputManagerTest, incrementalTargetStreamMatchesFullScan)
+{
+  // streams are inserted one by one, neither the first one nor the one of maximum latency
+  pushAndCheck({{1, 0.15}}, 20);
+  pushAndCheck({{1, 0.15}, {3, 0.30}}, 20);
+  pushAndCheck({{0, 0.10}, {1, 0.15}, {3, 0.30}}, 20);
+  pushAndCheck({{0, 0.10}, {1, 0.15}, {2, 0.20}, {3, 0.30}}, 20);
+  EXPECT_EQ(input_manager_->getTargetChannelIdx(), 3u);
+
+  // the order of the latencies changes, the target stream is not the slowest anymore
+  pushAndCheck({{0, 0.35}, {1, 0.25}, {2, 0.05}, {3, 0.12}}, 100);
+  EXPECT_EQ(input_manager_->getTargetChannelIdx(), 0u);
+
+  // the target stream and another one stop publishing, their statistics are kept while the
+  // latency of the remaining ones decreases
+  pushAndCheck({{1, 0.08}, {3, 0.02}}, 100);
+  EXPECT_EQ(input_manager_->getTargetChannelIdx(), 0u);
+
+  // the stopped stream of maximum latency publishes again, faster than the others
+  pushAndCheck({{0, 0.01}, {1, 0.08}, {3, 0.02}}, 100);
+  EXPECT_EQ(input_manager_->getTargetChannelIdx(), 1u);
+}
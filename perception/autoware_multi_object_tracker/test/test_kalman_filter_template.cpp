@@ -0,0 +1,75 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/multi_object_tracker/kalman_filter_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace
+{
+template <int StateSize, int UpperSize>
+void expectSameAsDensePrediction(const unsigned int seed)
+{
+  using KalmanFilter = autoware::multi_object_tracker::KalmanFilterTemplate<StateSize, 2>;
+  using StateMat = typename KalmanFilter::StateMat;
+  using StateVec = typename KalmanFilter::StateVec;
+
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  const auto random_matrix = [&]() {
+    return StateMat::NullaryExpr([&]() { return distribution(engine); }).eval();
+  };
+
+  // random symmetric positive-definite covariances
+  const StateMat L = random_matrix();
+  const StateMat P = L * L.transpose() + StateMat::Identity();
+  const StateMat M = random_matrix();
+  const StateMat Q = M * M.transpose();
+
+  // block triangular transition matrix [A11 A12; 0 D] with a diagonal D
+  StateMat A = random_matrix();
+  A.template bottomLeftCorner<StateSize - UpperSize, UpperSize>().setZero();
+  const auto D = A.template bottomRightCorner<StateSize - UpperSize, StateSize - UpperSize>()
+                   .diagonal()
+                   .eval();
+  A.template bottomRightCorner<StateSize - UpperSize, StateSize - UpperSize>() = D.asDiagonal();
+
+  const StateVec x = StateVec::NullaryExpr([&]() { return distribution(engine); });
+  KalmanFilter kf(
+    StateVec::Zero(), StateMat::Identity(), KalmanFilter::ControlMat::Zero(),
+    KalmanFilter::MeasModelMat::Zero(), StateMat::Identity(), KalmanFilter::MeasMat::Identity(),
+    P);
+  ASSERT_TRUE(kf.template predictBlockTriangular<UpperSize>(x, A, Q));
+
+  StateMat P_next;
+  kf.getP(P_next);
+  const StateMat P_expected = A * P * A.transpose() + Q;
+  EXPECT_LT((P_next - P_expected).cwiseAbs().maxCoeff(), 1e-12);
+  StateVec x_next;
+  kf.getX(x_next);
+  EXPECT_EQ(x_next, x);
+}
+}  // namespace
+
+TEST(KalmanFilterTemplate, predictBlockTriangularSameAsDense)
+{
+  for (unsigned int seed = 0; seed < 20; ++seed) {
+    // bicycle, CTRV and CV motion models
+    expectSameAsDensePrediction<6, 4>(seed);
+    expectSameAsDensePrediction<5, 3>(seed);
+    expectSameAsDensePrediction<4, 2>(seed);
+  }
+}
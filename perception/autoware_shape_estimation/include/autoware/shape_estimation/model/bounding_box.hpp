@@ -18,8 +18,6 @@
 #include "autoware/shape_estimation/model/model_interface.hpp"
 #include "autoware/shape_estimation/shape_estimator.hpp"
 
-#include <vector>
-
 namespace autoware::shape_estimation
 {
 namespace model
@@ -31,7 +29,6 @@ private:
   bool fitLShape(
     const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle,
     autoware_perception_msgs::msg::Shape & shape_output, geometry_msgs::msg::Pose & pose_output);
-  float calcClosenessCriterion(const std::vector<float> & C_1, const std::vector<float> & C_2);
   float optimize(
     const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle);
   float boostOptimize(
@@ -32,7 +32,9 @@
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
 #include <utility>
 #include <vector>
 
@@ -43,6 +45,78 @@ namespace model
 
 constexpr float epsilon = 0.001;
 
+namespace
+{
+/// @brief number of angles whose closeness criterion is evaluated in a single pass over the cluster
+constexpr size_t angle_batch_size = 8;
+/// @brief step, in number of angle_resolution, of the coarse search of the optimal angle
+constexpr size_t coarse_angle_step = 3;
+
+std::pair<std::vector<float>, std::vector<float>> toStructureOfArrays(
+  const pcl::PointCloud<pcl::PointXYZ> & cluster)
+{
+  std::vector<float> xs;
+  std::vector<float> ys;
+  xs.reserve(cluster.size());
+  ys.reserve(cluster.size());
+  for (const auto & point : cluster) {
+    xs.push_back(point.x);
+    ys.push_back(point.y);
+  }
+  return {xs, ys};
+}
+
+/**
+ * @brief Paper : Algo.4 Closeness Criterion, evaluated for N angles at once
+ * @details the projections (col.5 and col.6, Algo.2) are calculated on the fly in two passes over
+ * the points (bounds of the projections, then the criterion) so that nothing is allocated. The
+ * inner loops over the N angles have a fixed trip count and are vectorized by the compiler.
+ */
+template <size_t N>
+void calcClosenessCriteria(
+  const std::vector<float> & xs, const std::vector<float> & ys,
+  const std::array<float, N> & cos_theta, const std::array<float, N> & sin_theta,
+  std::array<float, N> & q)
+{
+  std::array<float, N> min_c_1;
+  std::array<float, N> max_c_1;
+  std::array<float, N> min_c_2;
+  std::array<float, N> max_c_2;
+  min_c_1.fill(std::numeric_limits<float>::max());
+  max_c_1.fill(std::numeric_limits<float>::lowest());
+  min_c_2.fill(std::numeric_limits<float>::max());
+  max_c_2.fill(std::numeric_limits<float>::lowest());
+  for (size_t i = 0; i < xs.size(); ++i) {
+    const float x = xs[i];
+    const float y = ys[i];
+    for (size_t k = 0; k < N; ++k) {
+      const float c_1 = x * cos_theta[k] + y * sin_theta[k];
+      const float c_2 = -x * sin_theta[k] + y * cos_theta[k];
+      min_c_1[k] = std::min(min_c_1[k], c_1);  // col.2, Algo.4
+      max_c_1[k] = std::max(max_c_1[k], c_1);
+      min_c_2[k] = std::min(min_c_2[k], c_2);  // col.3, Algo.4
+      max_c_2[k] = std::max(max_c_2[k], c_2);
+    }
+  }
+
+  constexpr float d_min = 0.1 * 0.1;
+  constexpr float d_max = 0.4 * 0.4;
+  q.fill(0.0);  // col.6, Algo.4
+  for (size_t i = 0; i < xs.size(); ++i) {
+    const float x = xs[i];
+    const float y = ys[i];
+    for (size_t k = 0; k < N; ++k) {
+      const float c_1 = x * cos_theta[k] + y * sin_theta[k];
+      const float c_2 = -x * sin_theta[k] + y * cos_theta[k];
+      const float v_1 = std::min(max_c_1[k] - c_1, c_1 - min_c_1[k]);
+      const float v_2 = std::min(max_c_2[k] - c_2, c_2 - min_c_2[k]);
+      const float d = std::min(v_1 * v_1, v_2 * v_2);  // col.4 and col.5, Algo.4
+      q[k] += d <= d_max ? 1.0f / std::max(d, d_min) : 0.0f;
+    }
+  }
+}
+}  // namespace
+
 BoundingBoxShapeModel::BoundingBoxShapeModel()
 : ref_yaw_info_(boost::none), use_boost_bbox_optimizer_(false)
 {
@@ -161,87 +235,108 @@ bool BoundingBoxShapeModel::fitLShape(
   return true;
 }
 
-float BoundingBoxShapeModel::calcClosenessCriterion(
-  const std::vector<float> & C_1, const std::vector<float> & C_2)
-{
-  // Paper : Algo.4 Closeness Criterion
-  const float min_c_1 = *std::min_element(C_1.begin(), C_1.end());  // col.2, Algo.4
-  const float max_c_1 = *std::max_element(C_1.begin(), C_1.end());  // col.2, Algo.4
-  const float min_c_2 = *std::min_element(C_2.begin(), C_2.end());  // col.3, Algo.4
-  const float max_c_2 = *std::max_element(C_2.begin(), C_2.end());  // col.3, Algo.4
-
-  std::vector<float> D_1;  // col.4, Algo.4
-  for (const auto & c_1_element : C_1) {
-    const float v = std::min(max_c_1 - c_1_element, c_1_element - min_c_1);
-    D_1.push_back(v * v);
-  }
-
-  std::vector<float> D_2;  // col.5, Algo.4
-  for (const auto & c_2_element : C_2) {
-    const float v = std::min(max_c_2 - c_2_element, c_2_element - min_c_2);
-    D_2.push_back(v * v);
-  }
-  constexpr float d_min = 0.1 * 0.1;
-  constexpr float d_max = 0.4 * 0.4;
-  float beta = 0;  // col.6, Algo.4
-  for (size_t i = 0; i < D_1.size(); ++i) {
-    if (d_max < std::min(D_1.at(i), D_2.at(i))) {
-      continue;
-    }
-    const float d = std::max(std::min(D_1.at(i), D_2.at(i)), d_min);
-    beta += 1.0 / d;
-  }
-  return beta;
-}
-
 float BoundingBoxShapeModel::optimize(
   const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle)
 {
-  std::vector<std::pair<float /*theta*/, float /*q*/>> Q;
   constexpr float angle_resolution = M_PI / 180.0;
-  for (float theta = min_angle; theta <= max_angle + epsilon; theta += angle_resolution) {
-    Eigen::Vector2f e_1;
-    e_1 << std::cos(theta), std::sin(theta);  // col.3, Algo.2
-    Eigen::Vector2f e_2;
-    e_2 << -std::sin(theta), std::cos(theta);  // col.4, Algo.2
-    std::vector<float> C_1;                    // col.5, Algo.2
-    std::vector<float> C_2;                    // col.6, Algo.2
-    for (const auto & point : cluster) {
-      C_1.push_back(point.x * e_1.x() + point.y * e_1.y());
-      C_2.push_back(point.x * e_2.x() + point.y * e_2.y());
-    }
-    float q = calcClosenessCriterion(C_1, C_2);  // col.7, Algo.2
-    Q.emplace_back(theta, q);                    // col.8, Algo.2
+  if (cluster.empty() || max_angle + epsilon < min_angle) {
+    return 0.0;
   }
+  const auto angles_nb =
+    static_cast<size_t>(std::floor((max_angle + epsilon - min_angle) / angle_resolution)) + 1;
+  const auto [xs, ys] = toStructureOfArrays(cluster);
+
+  // col.8, Algo.2, the criterion is non-negative so a negative value marks an angle not evaluated
+  std::vector<float> Q(angles_nb, -1.0);
+  std::array<size_t, angle_batch_size> batch_indices{};
+  size_t batch_count = 0;
+  const auto flush = [&]() {
+    if (batch_count == 0) {
+      return;
+    }
+    // unused lanes repeat the last angle of the batch
+    std::array<float, angle_batch_size> cos_theta{};
+    std::array<float, angle_batch_size> sin_theta{};
+    for (size_t k = 0; k < angle_batch_size; ++k) {
+      const float theta =
+        min_angle + static_cast<float>(batch_indices[std::min(k, batch_count - 1)]) *
+                      angle_resolution;
+      cos_theta[k] = std::cos(theta);
+      sin_theta[k] = std::sin(theta);
+    }
+    std::array<float, angle_batch_size> q{};
+    calcClosenessCriteria(xs, ys, cos_theta, sin_theta, q);  // col.7, Algo.2
+    for (size_t k = 0; k < batch_count; ++k) {
+      Q[batch_indices[k]] = q[k];
+    }
+    batch_count = 0;
+  };
+  const auto add = [&](const size_t i) {
+    if (Q[i] >= 0.0 || std::find(batch_indices.begin(), batch_indices.begin() + batch_count, i) !=
+                         batch_indices.begin() + batch_count) {
+      return;
+    }
+    batch_indices[batch_count++] = i;
+    if (batch_count == angle_batch_size) {
+      flush();
+    }
+  };
 
-  float theta_star{0.0};  // col.10, Algo.2
-  float max_q = 0.0;
-  for (size_t i = 0; i < Q.size(); ++i) {
-    if (max_q < Q.at(i).second || i == 0) {
-      max_q = Q.at(i).second;
-      theta_star = Q.at(i).first;
+  if (angles_nb <= 4 * coarse_angle_step) {
+    for (size_t i = 0; i < angles_nb; ++i) {
+      add(i);
+    }
+    flush();
+  } else {
+    // coarse search
+    for (size_t i = 0; i < angles_nb; i += coarse_angle_step) {
+      add(i);
+    }
+    add(angles_nb - 1);
+    flush();
+    // fine search around the best coarse angles
+    size_t best = 0;
+    size_t second_best = 0;
+    for (size_t i = 1; i < angles_nb; ++i) {
+      if (Q[i] < 0.0) {
+        continue;
+      }
+      if (Q[i] > Q[best]) {
+        second_best = best;
+        best = i;
+      } else if (second_best == best || Q[i] > Q[second_best]) {
+        second_best = i;
+      }
     }
+    for (const auto center : {best, second_best}) {
+      const auto first = center < coarse_angle_step ? 0 : center - coarse_angle_step + 1;
+      const auto last = std::min(center + coarse_angle_step - 1, angles_nb - 1);
+      for (size_t i = first; i <= last; ++i) {
+        add(i);
+      }
+    }
+    flush();
   }
 
-  return theta_star;
+  size_t i_star = 0;  // col.10, Algo.2
+  for (size_t i = 1; i < angles_nb; ++i) {
+    if (Q[i_star] < Q[i]) {
+      i_star = i;
+    }
+  }
+  return min_angle + static_cast<float>(i_star) * angle_resolution;
 }
 
 float BoundingBoxShapeModel::boostOptimize(
   const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle)
 {
+  const auto [xs, ys] = toStructureOfArrays(cluster);
   auto closeness_func = [&](float theta) {
-    Eigen::Vector2f e_1;
-    e_1 << std::cos(theta), std::sin(theta);  // col.3, Algo.2
-    Eigen::Vector2f e_2;
-    e_2 << -std::sin(theta), std::cos(theta);  // col.4, Algo.2
-    std::vector<float> C_1;                    // col.5, Algo.2
-    std::vector<float> C_2;                    // col.6, Algo.2
-    for (const auto & point : cluster) {
-      C_1.push_back(point.x * e_1.x() + point.y * e_1.y());
-      C_2.push_back(point.x * e_2.x() + point.y * e_2.y());
-    }
-    float q = calcClosenessCriterion(C_1, C_2);
-    return -q;
+    const std::array<float, 1> cos_theta{std::cos(theta)};  // col.3, Algo.2
+    const std::array<float, 1> sin_theta{std::sin(theta)};  // col.4, Algo.2
+    std::array<float, 1> q{};
+    calcClosenessCriteria(xs, ys, cos_theta, sin_theta, q);
+    return -q.front();
   };
 
   int bits = 6;
@@ -24,9 +24,11 @@
 #include "autoware_perception_msgs/msg/object_classification.hpp"
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace autoware::shape_estimation
 {
@@ -50,6 +52,7 @@ ShapeEstimationNode::ShapeEstimationNode(const rclcpp::NodeOptions & node_option
   bool use_boost_bbox_optimizer = declare_parameter<bool>("use_boost_bbox_optimizer");
   fix_filtered_objects_label_to_unknown_ =
     declare_parameter<bool>("fix_filtered_objects_label_to_unknown");
+  num_threads_ = std::max(declare_parameter<int>("omp_params.num_threads"), 1);
   RCLCPP_INFO(this->get_logger(), "using boost shape estimation : %d", use_boost_bbox_optimizer);
   estimator_ =
     std::make_unique<ShapeEstimator>(use_corrector, use_filter, use_boost_bbox_optimizer);
@@ -97,6 +100,49 @@ static bool label_is_vehicle(
          Label::TRAILER == label;
 }
 
+ShapeEstimationNode::EstimationResult ShapeEstimationNode::estimate(
+  const tier4_perception_msgs::msg::DetectedObjectWithFeature & feature_object) const
+{
+  EstimationResult result;
+  const auto & object = feature_object.object;
+  const auto label = get_label(object.classification);
+  const auto is_vehicle = label_is_vehicle(label);
+  const auto & feature = feature_object.feature;
+  // convert ros to pcl
+  pcl::PointCloud<pcl::PointXYZ>::Ptr cluster(new pcl::PointCloud<pcl::PointXYZ>);
+  pcl::fromROSMsg(feature.cluster, *cluster);
+
+  // check cluster data
+  if (cluster->empty()) {
+    return result;
+  }
+  result.has_cluster = true;
+
+#ifdef USE_CUDA
+  // If ml based shape estimation is enabled, the object is estimated with the input batch
+  if (is_vehicle && use_ml_shape_estimation_ && cluster->size() > min_points_) {
+    result.use_ml_shape_estimator = true;
+    return result;
+  }
+#endif
+
+  // estimate shape and pose
+  boost::optional<ReferenceYawInfo> ref_yaw_info = boost::none;
+  boost::optional<ReferenceShapeSizeInfo> ref_shape_size_info = boost::none;
+  boost::optional<geometry_msgs::msg::Pose> ref_pose = boost::none;
+  if (use_vehicle_reference_yaw_ && is_vehicle) {
+    ref_yaw_info = ReferenceYawInfo{
+      static_cast<float>(tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation)),
+      autoware_utils::deg2rad(10)};
+  }
+  if (use_vehicle_reference_shape_size_ && is_vehicle) {
+    ref_shape_size_info = ReferenceShapeSizeInfo{object.shape, ReferenceShapeSizeInfo::Mode::Min};
+  }
+  result.success = estimator_->estimateShapeAndPose(
+    label, *cluster, ref_yaw_info, ref_shape_size_info, ref_pose, result.shape, result.pose);
+  return result;
+}
+
 void ShapeEstimationNode::callback(
   const AUTOWARE_MESSAGE_CONST_SHARED_PTR(DetectedObjectsWithFeature) & input_msg)
 {
@@ -113,57 +159,40 @@ void ShapeEstimationNode::callback(
   // Create ml model input batch
   DetectedObjectsWithFeature input_trt_batch;
 
-  // Estimate shape for each object and pack msg
-  for (const auto & feature_object : input_msg->feature_objects) {
-    const auto & object = feature_object.object;
-    const auto label = get_label(object.classification);
-    const auto is_vehicle = label_is_vehicle(label);
-    const auto & feature = feature_object.feature;
-    // convert ros to pcl
-    pcl::PointCloud<pcl::PointXYZ>::Ptr cluster(new pcl::PointCloud<pcl::PointXYZ>);
-    pcl::fromROSMsg(feature.cluster, *cluster);
-
-    // check cluster data
-    if (cluster->empty()) {
+  // Estimate shape for each object in parallel, the estimator does not hold any per-object state
+  const auto & feature_objects = input_msg->feature_objects;
+  std::vector<EstimationResult> results(feature_objects.size());
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+  for (size_t i = 0; i < feature_objects.size(); ++i) {
+    results[i] = estimate(feature_objects[i]);
+  }
+
+  // Pack msg in the order of the input objects
+  for (size_t i = 0; i < feature_objects.size(); ++i) {
+    const auto & feature_object = feature_objects[i];
+    const auto & result = results[i];
+    if (!result.has_cluster) {
       continue;
     }
 
 #ifdef USE_CUDA
-    // If ml based shape estimation is enabled, add object to input batch and continue
-    if (is_vehicle && use_ml_shape_estimation_ && cluster->size() > min_points_) {
+    if (result.use_ml_shape_estimator) {
       input_trt_batch.feature_objects.push_back(feature_object);
       continue;
     }
 #endif
 
-    // estimate shape and pose
-    autoware_perception_msgs::msg::Shape shape;
-    geometry_msgs::msg::Pose pose;
-    boost::optional<ReferenceYawInfo> ref_yaw_info = boost::none;
-    boost::optional<ReferenceShapeSizeInfo> ref_shape_size_info = boost::none;
-    boost::optional<geometry_msgs::msg::Pose> ref_pose = boost::none;
-    if (use_vehicle_reference_yaw_ && is_vehicle) {
-      ref_yaw_info = ReferenceYawInfo{
-        static_cast<float>(tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation)),
-        autoware_utils::deg2rad(10)};
-    }
-    if (use_vehicle_reference_shape_size_ && is_vehicle) {
-      ref_shape_size_info = ReferenceShapeSizeInfo{object.shape, ReferenceShapeSizeInfo::Mode::Min};
-    }
-    const bool estimated_success = estimator_->estimateShapeAndPose(
-      label, *cluster, ref_yaw_info, ref_shape_size_info, ref_pose, shape, pose);
-
     // If the shape estimation fails, change to Unknown object.
-    if (!fix_filtered_objects_label_to_unknown_ && !estimated_success) {
+    if (!fix_filtered_objects_label_to_unknown_ && !result.success) {
       continue;
     }
     output_msg->feature_objects.push_back(feature_object);
-    if (!estimated_success) {
+    if (!result.success) {
       output_msg->feature_objects.back().object.classification.front().label = Label::UNKNOWN;
     }
 
-    output_msg->feature_objects.back().object.shape = shape;
-    output_msg->feature_objects.back().object.kinematics.pose_with_covariance.pose = pose;
+    output_msg->feature_objects.back().object.shape = result.shape;
+    output_msg->feature_objects.back().object.kinematics.pose_with_covariance.pose = result.pose;
   }
 
 #ifdef USE_CUDA
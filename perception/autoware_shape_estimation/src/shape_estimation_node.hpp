@@ -53,12 +53,24 @@ private:
   std::unique_ptr<autoware_utils::BasicDebugPublisher<autoware::agnocast_wrapper::Node>>
     processing_time_publisher_;
 
+  struct EstimationResult
+  {
+    bool has_cluster{false};
+    bool use_ml_shape_estimator{false};
+    bool success{false};
+    autoware_perception_msgs::msg::Shape shape;
+    geometry_msgs::msg::Pose pose;
+  };
+
   void callback(const AUTOWARE_MESSAGE_CONST_SHARED_PTR(DetectedObjectsWithFeature) & input_msg);
+  EstimationResult estimate(
+    const tier4_perception_msgs::msg::DetectedObjectWithFeature & feature_object) const;
 
   std::unique_ptr<ShapeEstimator> estimator_;
   bool use_vehicle_reference_yaw_;
   bool use_vehicle_reference_shape_size_;
   bool fix_filtered_objects_label_to_unknown_;
+  int num_threads_;
 
 #ifdef USE_CUDA
   std::unique_ptr<TrtShapeEstimator> tensorrt_shape_estimator_;
@@ -21,6 +21,8 @@
 #include <gtest/gtest.h>
 #include <math.h>
 
+#include <algorithm>
+
 namespace
 {
 double yawFromQuaternion(const geometry_msgs::msg::Quaternion & q)
@@ -148,6 +150,45 @@ TEST(BoundingBoxShapeModel, test_estimateShape_rotated)
   EXPECT_NEAR(pose_output_yaw, yaw, deg2rad(15.0));
 }
 
+// 3. large rotated case without reference yaw (coarse-to-fine angle search)
+TEST(BoundingBoxShapeModel, test_estimateShape_large_rotated)
+{
+  // Generate cluster
+  const double length = 12.0;
+  const double width = 2.5;
+  const double height = 3.0;
+  const double yaw = deg2rad(37.0);
+  const double offset_x = 20.0;
+  const double offset_y = -5.0;
+  pcl::PointCloud<pcl::PointXYZ> cluster =
+    createLShapeCluster(length, width, height, yaw, offset_x, offset_y);
+
+  // Generate BoundingBoxShapeModel
+  auto bbox_shape_model = autoware::shape_estimation::model::BoundingBoxShapeModel();
+
+  // Generate shape and pose output
+  autoware_perception_msgs::msg::Shape shape_output;
+  geometry_msgs::msg::Pose pose_output;
+
+  // Test estimateShape
+  const bool result = bbox_shape_model.estimate(cluster, shape_output, pose_output);
+  EXPECT_TRUE(result);
+
+  // Check shape_output, the search range is [0, 90] deg so length and width may be swapped
+  EXPECT_EQ(shape_output.type, autoware_perception_msgs::msg::Shape::BOUNDING_BOX);
+  EXPECT_NEAR(
+    std::max(shape_output.dimensions.x, shape_output.dimensions.y), length, length * 0.1);
+  EXPECT_NEAR(std::min(shape_output.dimensions.x, shape_output.dimensions.y), width, width * 0.1);
+
+  // Check pose_output
+  EXPECT_NEAR(pose_output.position.x, offset_x, 1.0);
+  EXPECT_NEAR(pose_output.position.y, offset_y, 1.0);
+
+  // transform quaternion to yaw
+  const double pose_output_yaw = yawFromQuaternion(pose_output.orientation);
+  EXPECT_NEAR(pose_output_yaw, yaw, deg2rad(1.0));
+}
+
 // test CylinderShapeModel
 TEST(CylinderShapeModel, test_estimateShape)
 {
@@ -15,7 +15,11 @@
 
 #include "occlusion_predictor.hpp"
 
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <map>
 #include <vector>
 namespace
@@ -35,13 +39,111 @@ autoware::traffic_light::Ray point2ray(const pcl::PointXYZ & pt)
 namespace autoware::traffic_light
 {
 
+RayGrid::RayGrid(float azimuth_resolution_deg, float elevation_resolution_deg)
+: cell_azimuth_deg_(azimuth_resolution_deg / cells_per_resolution),
+  cell_elevation_deg_(elevation_resolution_deg / cells_per_resolution)
+{
+}
+
+void RayGrid::reset(const std::vector<AngularBox> & boxes)
+{
+  boxes_ = boxes;
+  cols_ = 0;
+  rows_ = 0;
+  if (boxes_.empty()) {
+    return;
+  }
+  bounds_ = boxes_.front();
+  for (const auto & box : boxes_) {
+    bounds_.min_azimuth = std::min(bounds_.min_azimuth, box.min_azimuth);
+    bounds_.max_azimuth = std::max(bounds_.max_azimuth, box.max_azimuth);
+    bounds_.min_elevation = std::min(bounds_.min_elevation, box.min_elevation);
+    bounds_.max_elevation = std::max(bounds_.max_elevation, box.max_elevation);
+  }
+  cols_ = toCol(bounds_.max_azimuth) + 1;
+  rows_ = toRow(bounds_.max_elevation) + 1;
+  min_distances_.assign(
+    static_cast<size_t>(cols_) * static_cast<size_t>(rows_),
+    std::numeric_limits<float>::infinity());
+}
+
+int RayGrid::toCol(float azimuth) const
+{
+  return static_cast<int>(std::floor((azimuth - bounds_.min_azimuth) / cell_azimuth_deg_));
+}
+
+int RayGrid::toRow(float elevation) const
+{
+  return static_cast<int>(std::floor((elevation - bounds_.min_elevation) / cell_elevation_deg_));
+}
+
+void RayGrid::insert(const Ray & ray)
+{
+  if (!std::any_of(
+        boxes_.begin(), boxes_.end(), [&ray](const auto & box) { return box.contains(ray); })) {
+    return;
+  }
+  const int col = std::clamp(toCol(ray.azimuth), 0, cols_ - 1);
+  const int row = std::clamp(toRow(ray.elevation), 0, rows_ - 1);
+  float & min_distance = min_distances_[static_cast<size_t>(row) * cols_ + col];
+  min_distance = std::min(min_distance, ray.dist);
+}
+
+void RayGrid::finalize()
+{
+  // separable minimum filter over the cells within the resolution
+  constexpr int r = cells_per_resolution;
+  buffer_.resize(min_distances_.size());
+  for (int row = 0; row < rows_; ++row) {
+    const float * src = min_distances_.data() + static_cast<size_t>(row) * cols_;
+    float * dst = buffer_.data() + static_cast<size_t>(row) * cols_;
+    for (int col = 0; col < cols_; ++col) {
+      const int end = std::min(col + r, cols_ - 1);
+      float min_distance = src[col];
+      for (int c = std::max(col - r, 0); c <= end; ++c) {
+        min_distance = std::min(min_distance, src[c]);
+      }
+      dst[col] = min_distance;
+    }
+  }
+  for (int row = 0; row < rows_; ++row) {
+    const int end = std::min(row + r, rows_ - 1);
+    float * dst = min_distances_.data() + static_cast<size_t>(row) * cols_;
+    std::copy_n(buffer_.data() + static_cast<size_t>(row) * cols_, cols_, dst);
+    for (int rr = std::max(row - r, 0); rr <= end; ++rr) {
+      const float * src = buffer_.data() + static_cast<size_t>(rr) * cols_;
+      for (int col = 0; col < cols_; ++col) {
+        dst[col] = std::min(dst[col], src[col]);
+      }
+    }
+  }
+}
+
+float RayGrid::getMinDistance(const Ray & ray) const
+{
+  const int col = toCol(ray.azimuth);
+  const int row = toRow(ray.elevation);
+  if (col < 0 || col >= cols_ || row < 0 || row >= rows_) {
+    return std::numeric_limits<float>::infinity();
+  }
+  return min_distances_[static_cast<size_t>(row) * cols_ + col];
+}
+
+bool RayGrid::covers(const AngularBox & box) const
+{
+  return std::any_of(boxes_.begin(), boxes_.end(), [&box](const auto & b) {
+    return b.contains(box);
+  });
+}
+
 CloudOcclusionPredictor::CloudOcclusionPredictor(
   rclcpp::Node * node_ptr, float max_valid_pt_distance, float azimuth_occlusion_resolution_deg,
   float elevation_occlusion_resolution_deg)
 : node_ptr_(node_ptr),
   max_valid_pt_distance_(max_valid_pt_distance),
   azimuth_occlusion_resolution_deg_(azimuth_occlusion_resolution_deg),
-  elevation_occlusion_resolution_deg_(elevation_occlusion_resolution_deg)
+  elevation_occlusion_resolution_deg_(elevation_occlusion_resolution_deg),
+  ray_grid_(azimuth_occlusion_resolution_deg, elevation_occlusion_resolution_deg)
 {
 }
 
@@ -100,21 +202,59 @@ void CloudOcclusionPredictor::predict(
       roi_brs[i]);
   }
 
-  lidar_rays_.clear();
-  // points in camera frame
-  pcl::PointCloud<pcl::PointXYZ> cloud_camera;
-  // points within roi
-  pcl::PointCloud<pcl::PointXYZ> cloud_roi;
-  autoware_utils::transform_point_cloud_from_ros_msg(*cloud_msg, cloud_camera, camera2cloud);
-
-  filterCloud(cloud_camera, roi_tls, roi_brs, cloud_roi);
+  // sample the rois, the occlusion of the samples is searched within the resolution around them
+  const uint32_t horizontal_sample_num = 20;
+  const uint32_t vertical_sample_num = 20;
+  static_assert(horizontal_sample_num > 1);
+  static_assert(vertical_sample_num > 1);
+  std::vector<std::vector<Ray>> tl_rays(roi_tls.size());
+  std::vector<AngularBox> boxes;
+  boxes.reserve(roi_tls.size());
+  pcl::PointCloud<pcl::PointXYZ> tl_sample_cloud;
+  for (size_t i = 0; i < roi_tls.size(); i++) {
+    if (rois_msg->rois[i].roi.height == 0) {
+      continue;
+    }
+    sampleTrafficLightRoi(
+      roi_tls[i], roi_brs[i], horizontal_sample_num, vertical_sample_num, tl_sample_cloud);
+    AngularBox box{
+      std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest(),
+      std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()};
+    for (const pcl::PointXYZ & tl_pt : tl_sample_cloud) {
+      const Ray tl_ray = ::point2ray(tl_pt);
+      box.min_azimuth = std::min(box.min_azimuth, tl_ray.azimuth);
+      box.max_azimuth = std::max(box.max_azimuth, tl_ray.azimuth);
+      box.min_elevation = std::min(box.min_elevation, tl_ray.elevation);
+      box.max_elevation = std::max(box.max_elevation, tl_ray.elevation);
+      tl_rays[i].push_back(tl_ray);
+    }
+    box.min_azimuth -= azimuth_occlusion_resolution_deg_;
+    box.max_azimuth += azimuth_occlusion_resolution_deg_;
+    box.min_elevation -= elevation_occlusion_resolution_deg_;
+    box.max_elevation += elevation_occlusion_resolution_deg_;
+    boxes.push_back(box);
+  }
 
-  for (const pcl::PointXYZ & pt : cloud_roi) {
-    Ray ray = ::point2ray(pt);
-    lidar_rays_[static_cast<int>(ray.azimuth)][static_cast<int>(ray.elevation)].push_back(ray);
+  const bool is_same_input = ray_grid_camera_frame_ == camera_info_msg->header.frame_id &&
+                             ray_grid_camera_stamp_ == camera_info_msg->header.stamp &&
+                             ray_grid_cloud_frame_ == cloud_msg->header.frame_id &&
+                             ray_grid_cloud_stamp_ == cloud_msg->header.stamp;
+  const bool is_covered = std::all_of(
+    boxes.begin(), boxes.end(), [this](const auto & box) { return ray_grid_.covers(box); });
+  if (!is_same_input || !is_covered) {
+    if (is_same_input) {
+      // keep the area of the other rois to be reused for them again
+      boxes.insert(boxes.end(), ray_grid_.boxes().begin(), ray_grid_.boxes().end());
+    }
+    fillRayGrid(*cloud_msg, camera2cloud.cast<float>(), boxes);
+    ray_grid_camera_frame_ = camera_info_msg->header.frame_id;
+    ray_grid_camera_stamp_ = camera_info_msg->header.stamp;
+    ray_grid_cloud_frame_ = cloud_msg->header.frame_id;
+    ray_grid_cloud_stamp_ = cloud_msg->header.stamp;
   }
+
   for (size_t i = 0; i < roi_tls.size(); i++) {
-    occlusion_ratios[i] = rois_msg->rois[i].roi.height == 0 ? 0 : predict(roi_tls[i], roi_brs[i]);
+    occlusion_ratios[i] = rois_msg->rois[i].roi.height == 0 ? 0 : predict(tl_rays[i]);
   }
 }
 
@@ -148,43 +288,35 @@ void CloudOcclusionPredictor::calcRoiVector3D(
   }
 }
 
-void CloudOcclusionPredictor::filterCloud(
-  const pcl::PointCloud<pcl::PointXYZ> & cloud_in, const std::vector<pcl::PointXYZ> & roi_tls,
-  const std::vector<pcl::PointXYZ> & roi_brs, pcl::PointCloud<pcl::PointXYZ> & cloud_out) const
+void CloudOcclusionPredictor::fillRayGrid(
+  const sensor_msgs::msg::PointCloud2 & cloud_msg, const Eigen::Matrix4f & camera2cloud,
+  const std::vector<AngularBox> & boxes)
 {
-  float min_x = 0, max_x = 0, min_y = 0, max_y = 0, min_z = 0, max_z = 0;
-  for (const auto & pt : roi_tls) {
-    min_x = std::min(min_x, pt.x);
-    max_x = std::max(max_x, pt.x);
-    min_y = std::min(min_y, pt.y);
-    max_y = std::max(max_y, pt.y);
-    min_z = std::min(min_z, pt.z);
-    max_z = std::max(max_z, pt.z);
-  }
-  for (const auto & pt : roi_brs) {
-    min_x = std::min(min_x, pt.x);
-    max_x = std::max(max_x, pt.x);
-    min_y = std::min(min_y, pt.y);
-    max_y = std::max(max_y, pt.y);
-    min_z = std::min(min_z, pt.z);
-    max_z = std::max(max_z, pt.z);
+  ray_grid_.reset(boxes);
+  if (boxes.empty()) {
+    return;
   }
   const float min_dist_to_cam = 1.0f;
-  cloud_out.clear();
-  for (const auto & pt : cloud_in) {
-    if (
-      pt.x < min_x || pt.x > max_x || pt.y < min_y || pt.y > max_y || pt.z < min_z ||
-      pt.z > max_z) {
+  const Eigen::Matrix3f rotation = camera2cloud.topLeftCorner<3, 3>();
+  const Eigen::Vector3f translation = camera2cloud.topRightCorner<3, 1>();
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud_msg, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(cloud_msg, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(cloud_msg, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    const Eigen::Vector3f pt = rotation * Eigen::Vector3f(*iter_x, *iter_y, *iter_z) + translation;
+    // the traffic lights are in front of the camera
+    if (pt.z() <= 0.0f) {
       continue;
     }
-    float dist = pt.getVector3fMap().squaredNorm();
+    const float dist = pt.squaredNorm();
     if (
       dist <= min_dist_to_cam * min_dist_to_cam ||
       dist >= max_valid_pt_distance_ * max_valid_pt_distance_) {
       continue;
     }
-    cloud_out.push_back(pt);
+    ray_grid_.insert(::point2ray(pcl::PointXYZ(pt.x(), pt.y(), pt.z())));
   }
+  ray_grid_.finalize();
 }
 
 void CloudOcclusionPredictor::sampleTrafficLightRoi(
@@ -209,51 +341,21 @@ void CloudOcclusionPredictor::sampleTrafficLightRoi(
   }
 }
 
-uint32_t CloudOcclusionPredictor::predict(
-  const pcl::PointXYZ & roi_top_left, const pcl::PointXYZ & roi_bottom_right)
+uint32_t CloudOcclusionPredictor::predict(const std::vector<Ray> & tl_rays) const
 {
-  const uint32_t horizontal_sample_num = 20;
-  const uint32_t vertical_sample_num = 20;
-  static_assert(horizontal_sample_num > 1);
-  static_assert(vertical_sample_num > 1);
-
   const float min_dist_from_occlusion_to_tl = 5.0f;
 
-  pcl::PointCloud<pcl::PointXYZ> tl_sample_cloud;
-  sampleTrafficLightRoi(
-    roi_top_left, roi_bottom_right, horizontal_sample_num, vertical_sample_num, tl_sample_cloud);
+  /**
+   * for a lidar ray r1 whose azimuth and elevation are very close to tl_ray,
+   * and the distance from r1 to camera is smaller than the distance from tl_ray to camera,
+   * then tl_ray is occluded by r1.
+   */
   uint32_t occluded_num = 0;
-  for (const pcl::PointXYZ & tl_pt : tl_sample_cloud) {
-    Ray tl_ray = ::point2ray(tl_pt);
-    bool occluded = false;
-    // the azimuth and elevation range to search for points that may occlude tl_pt
-    int min_azimuth = static_cast<int>(tl_ray.azimuth - azimuth_occlusion_resolution_deg_);
-    int max_azimuth = static_cast<int>(tl_ray.azimuth + azimuth_occlusion_resolution_deg_);
-    int min_elevation = static_cast<int>(tl_ray.elevation - elevation_occlusion_resolution_deg_);
-    int max_elevation = static_cast<int>(tl_ray.elevation + elevation_occlusion_resolution_deg_);
-    /**
-     * search among lidar rays whose azimuth and elevation angle are close to the tl_ray.
-     * for a lidar ray r1 whose azimuth and elevation are very close to tl_pt,
-     * and the distance from r1 to camera is smaller than the distance from tl_pt to camera,
-     * then tl_pt is occluded by r1.
-     */
-    for (int azimuth = min_azimuth; (azimuth <= max_azimuth) && !occluded; azimuth++) {
-      for (int elevation = min_elevation; (elevation <= max_elevation) && !occluded; elevation++) {
-        for (const Ray & lidar_ray : lidar_rays_[azimuth][elevation]) {
-          if (
-            std::abs(lidar_ray.azimuth - tl_ray.azimuth) <= azimuth_occlusion_resolution_deg_ &&
-            std::abs(lidar_ray.elevation - tl_ray.elevation) <=
-              elevation_occlusion_resolution_deg_ &&
-            lidar_ray.dist < tl_ray.dist - min_dist_from_occlusion_to_tl) {
-            occluded = true;
-            break;
-          }
-        }
-      }
-    }
-    occluded_num += occluded;
+  for (const Ray & tl_ray : tl_rays) {
+    occluded_num +=
+      ray_grid_.getMinDistance(tl_ray) < tl_ray.dist - min_dist_from_occlusion_to_tl;
   }
-  return 100 * occluded_num / tl_sample_cloud.size();
+  return 100 * occluded_num / tl_rays.size();
 }
 
 }  // namespace autoware::traffic_light
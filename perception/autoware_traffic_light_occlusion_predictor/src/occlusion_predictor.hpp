@@ -17,10 +17,10 @@
 #define OCCLUSION_PREDICTOR_HPP_
 
 #include <autoware_utils/geometry/geometry.hpp>
-#include <autoware_utils/ros/pcl_conversion.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <tf2_eigen/tf2_eigen.hpp>
 
+#include <builtin_interfaces/msg/time.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 #include <tier4_perception_msgs/msg/traffic_light_roi_array.hpp>
 
@@ -31,15 +31,12 @@
 #endif
 
 #include <lanelet2_core/Forward.h>
-#include <pcl/common/transforms.h>
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
-#include <list>
 #include <map>
-#include <set>
 #include <string>
 #include <vector>
 
@@ -53,6 +50,75 @@ struct Ray
   float dist;
 };
 
+/**
+ * @brief azimuth and elevation range of the rays [deg]
+ */
+struct AngularBox
+{
+  float min_azimuth;
+  float max_azimuth;
+  float min_elevation;
+  float max_elevation;
+
+  bool contains(const Ray & ray) const
+  {
+    return ray.azimuth >= min_azimuth && ray.azimuth <= max_azimuth &&
+           ray.elevation >= min_elevation && ray.elevation <= max_elevation;
+  }
+
+  bool contains(const AngularBox & box) const
+  {
+    return box.min_azimuth >= min_azimuth && box.max_azimuth <= max_azimuth &&
+           box.min_elevation >= min_elevation && box.max_elevation <= max_elevation;
+  }
+};
+
+/**
+ * @brief dense azimuth x elevation grid of the minimum distance of the lidar rays
+ *
+ * only the rays in the given angular boxes are stored. after finalize(), each cell holds the
+ * minimum distance of the rays within the occlusion resolution around it, so that an occlusion
+ * query is a single lookup. the buffers are kept between the resets to avoid reallocations
+ */
+class RayGrid
+{
+public:
+  RayGrid(float azimuth_resolution_deg, float elevation_resolution_deg);
+
+  void reset(const std::vector<AngularBox> & boxes);
+
+  void insert(const Ray & ray);
+
+  void finalize();
+
+  /**
+   * @brief minimum distance of the rays whose azimuth and elevation differences with the given ray
+   * are within the resolution. the neighborhood is rounded up to the cells, i.e. up to a half of
+   * the resolution is added on each side
+   */
+  float getMinDistance(const Ray & ray) const;
+
+  bool covers(const AngularBox & box) const;
+
+  const std::vector<AngularBox> & boxes() const { return boxes_; }
+
+private:
+  //! number of cells per occlusion resolution
+  static constexpr int cells_per_resolution = 2;
+
+  int toCol(float azimuth) const;
+  int toRow(float elevation) const;
+
+  float cell_azimuth_deg_;
+  float cell_elevation_deg_;
+  std::vector<AngularBox> boxes_;
+  AngularBox bounds_{};
+  int cols_{0};
+  int rows_{0};
+  std::vector<float> min_distances_;
+  std::vector<float> buffer_;
+};
+
 class CloudOcclusionPredictor
 {
 public:
@@ -69,11 +135,11 @@ public:
     std::vector<int> & occlusion_ratios);
 
 private:
-  uint32_t predict(const pcl::PointXYZ & roi_top_left, const pcl::PointXYZ & roi_bottom_right);
+  uint32_t predict(const std::vector<Ray> & tl_rays) const;
 
-  void filterCloud(
-    const pcl::PointCloud<pcl::PointXYZ> & cloud_in, const std::vector<pcl::PointXYZ> & roi_tls,
-    const std::vector<pcl::PointXYZ> & roi_brs, pcl::PointCloud<pcl::PointXYZ> & cloud_out) const;
+  void fillRayGrid(
+    const sensor_msgs::msg::PointCloud2 & cloud_msg, const Eigen::Matrix4f & camera2cloud,
+    const std::vector<AngularBox> & boxes);
 
   static void sampleTrafficLightRoi(
     const pcl::PointXYZ & top_left, const pcl::PointXYZ & bottom_right,
@@ -86,11 +152,18 @@ private:
     const std::map<lanelet::Id, tf2::Vector3> & traffic_light_position_map,
     const tf2::Transform & tf_camera2map, pcl::PointXYZ & top_left, pcl::PointXYZ & bottom_right);
 
-  std::map<int, std::map<int, std::vector<Ray> > > lidar_rays_;
   rclcpp::Node * node_ptr_;
   float max_valid_pt_distance_;
   float azimuth_occlusion_resolution_deg_;
   float elevation_occlusion_resolution_deg_;
+
+  // the car and pedestrian traffic lights of a camera are predicted with the same cloud, so the
+  // ray grid is reused if it covers the rois
+  RayGrid ray_grid_;
+  std::string ray_grid_camera_frame_;
+  builtin_interfaces::msg::Time ray_grid_camera_stamp_;
+  std::string ray_grid_cloud_frame_;
+  builtin_interfaces::msg::Time ray_grid_cloud_stamp_;
 };
 
 }  // namespace autoware::traffic_light
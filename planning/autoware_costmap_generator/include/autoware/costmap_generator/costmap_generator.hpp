@@ -117,6 +117,18 @@ private:
 
   std::vector<geometry_msgs::msg::Polygon> primitives_polygons_;
 
+  /// \brief primitives layer of the last costmap, only rasterized again when the map, the
+  /// transform of the primitives or the grid center changes
+  struct PrimitivesCostmapCache
+  {
+    bool is_valid{false};
+    geometry_msgs::msg::Transform primitives2costmap;
+    std::vector<geometry_msgs::msg::Polygon> transformed_primitives;
+    grid_map::Position position;
+    grid_map::Matrix costmap;
+  };
+  PrimitivesCostmapCache primitives_costmap_cache_;
+
   PointsToCostmap points2costmap_{};
   ObjectsToCostmap objects2costmap_;
 
@@ -185,7 +197,15 @@ private:
   grid_map::Matrix generateObjectsCostmap(const PredictedObjects::ConstSharedPtr in_objects);
 
   /// \brief calculate cost from lanelet2 map
-  grid_map::Matrix generatePrimitivesCostmap();
+  /// \details the cached layer is reused as is if the grid did not move and shifted if it moved,
+  /// such that only the cells that entered the grid are rasterized
+  const grid_map::Matrix & generatePrimitivesCostmap();
+
+  /// \brief rasterize the cached primitives over a block of cells of the costmap
+  /// \param[in] start_index index of the first cell of the block
+  /// \param[in] size number of cells of the block
+  grid_map::Matrix rasterizePrimitives(
+    const grid_map::Index & start_index, const grid_map::Size & size);
 
   /// \brief calculate cost for final output
   grid_map::Matrix generateCombinedCostmap();
@@ -49,6 +49,7 @@
 
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -74,11 +75,21 @@ public:
     const pcl::PointCloud<pcl::PointXYZ> & in_sensor_points);
 
 private:
+  /// \brief occupancy of a grid cell, ordered such that the state of a cell is the maximum of the
+  /// states of its points
+  enum CellState : uint8_t { EMPTY = 0, OUT_OF_HEIGHT_RANGE = 1, IN_HEIGHT_RANGE = 2 };
+
   double grid_length_x_;
   double grid_length_y_;
   double grid_resolution_;
   double grid_position_x_;
   double grid_position_y_;
+  int x_cell_size_;
+  int y_cell_size_;
+
+  /// \brief state of each cell, flattened in column-major order like grid_map::Matrix. Kept as a
+  /// member to reuse its allocation between calls
+  std::vector<uint8_t> cell_states_;
 
   /// \brief initialize gridmap parameters
   /// \param[in] gridmap: gridmap object to be initialized
@@ -94,27 +105,23 @@ private:
   /// \param[out] index in gridmap
   grid_map::Index fetchGridIndexFromPoint(const pcl::PointXYZ & point);
 
-  /// \brief Assign pointcloud to appropriate cell in gridmap
+  /// \brief Assign pointcloud to appropriate cell in gridmap, filling cell_states_ in a single pass
+  /// \param[in] maximum_height_thres: Maximum height threshold for pointcloud data
+  /// \param[in] minimum_height_thres: Minimum height threshold for pointcloud data
   /// \param[in] in_sensor_points: subscribed pointcloud
-  /// \param[out] grid-x-length x grid-y-length size grid stuffed with point's height in
-  /// corresponding grid cell
-  std::vector<std::vector<std::vector<double>>> assignPoints2GridCell(
+  void assignPoints2GridCell(
+    const double maximum_height_thres, const double minimum_height_thres,
     const pcl::PointCloud<pcl::PointXYZ> & in_sensor_points);
 
-  /// \brief calculate costmap from subscribed pointcloud
-  /// \param[in] maximum_height_thres: Maximum height threshold for pointcloud data
-  /// \param[in] minimum_height_thres: Minimum height threshold for pointcloud data
+  /// \brief calculate costmap from the cell states
   /// \param[in] grid_min_value: Minimum cost for costmap
   /// \param[in] grid_max_value: Maximum cost fot costmap
   /// \param[in] gridmap: costmap based on gridmap
   /// \param[in] gridmap_layer_name: gridmap layer name for gridmap
-  /// \param[in] grid_vec: grid-x-length x grid-y-length size grid stuffed with point's height in
-  /// corresponding grid cell \param[out] calculated costmap in grid_map::Matrix format
+  /// \param[out] calculated costmap in grid_map::Matrix format
   grid_map::Matrix calculateCostmap(
-    const double maximum_height_thres, const double minimum_lidar_height_thres,
     const double grid_min_value, const double grid_max_value, const grid_map::GridMap & gridmap,
-    const std::string & gridmap_layer_name,
-    const std::vector<std::vector<std::vector<double>>> grid_vec);
+    const std::string & gridmap_layer_name);
 };
 }  // namespace autoware::costmap_generator
 
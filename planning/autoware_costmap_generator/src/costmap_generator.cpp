@@ -60,6 +60,8 @@
 #include <lanelet2_core/Forward.h>
 #include <lanelet2_core/geometry/Polygon.h>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <string>
 #include <vector>
@@ -252,6 +254,9 @@ void CostmapGenerator::onLaneletMapBin(
   lanelet_map_ = autoware::experimental::lanelet2_utils::remove_const(
     autoware::experimental::lanelet2_utils::from_autoware_map_msgs(*msg));
 
+  primitives_polygons_.clear();
+  primitives_costmap_cache_.is_valid = false;
+
   if (param_->use_wayarea) {
     loadRoadAreasFromLaneletMap(lanelet_map_, primitives_polygons_);
   }
@@ -432,11 +437,10 @@ grid_map::Matrix CostmapGenerator::generateObjectsCostmap(
   return objects_costmap;
 }
 
-grid_map::Matrix CostmapGenerator::generatePrimitivesCostmap()
+const grid_map::Matrix & CostmapGenerator::generatePrimitivesCostmap()
 {
-  grid_map::GridMap lanelet2_costmap = costmap_;
   if (primitives_polygons_.empty()) {
-    return lanelet2_costmap[LayerName::primitives];
+    return costmap_[LayerName::primitives];
   }
 
   geometry_msgs::msg::TransformStamped primitives2costmap;
@@ -447,33 +451,86 @@ grid_map::Matrix CostmapGenerator::generatePrimitivesCostmap()
     RCLCPP_ERROR(rclcpp::get_logger("costmap_generator"), "%s", ex.what());
   }
 
-  const auto transformed_primitives =
-    getTransformedPrimitives(primitives_polygons_, primitives2costmap);
+  auto & cache = primitives_costmap_cache_;
+  const grid_map::Size size = costmap_.getSize();
+  if (!cache.is_valid || cache.primitives2costmap != primitives2costmap.transform) {
+    cache.transformed_primitives =
+      getTransformedPrimitives(primitives_polygons_, primitives2costmap);
+    cache.primitives2costmap = primitives2costmap.transform;
+    cache.position = costmap_.getPosition();
+    cache.costmap = rasterizePrimitives(grid_map::Index(0, 0), size);
+    cache.is_valid = true;
+    return cache.costmap;
+  }
+
+  // the grid center only moves by multiples of the resolution (see set_grid_center)
+  const grid_map::Position displacement = costmap_.getPosition() - cache.position;
+  const grid_map::Index shift(
+    static_cast<int>(std::round(displacement.x() / costmap_.getResolution())),
+    static_cast<int>(std::round(displacement.y() / costmap_.getResolution())));
+  cache.position = costmap_.getPosition();
+  if ((shift == 0).all()) {
+    return cache.costmap;
+  }
+  if ((shift.abs() >= size).any()) {
+    cache.costmap = rasterizePrimitives(grid_map::Index(0, 0), size);
+    return cache.costmap;
+  }
 
+  // the cells of index 0 are at the maximum coordinates, so the cell of index i after the shift is
+  // the cell of index i - shift before the shift
+  const grid_map::Size kept_size = size - shift.abs();
+  const grid_map::Index kept_start = shift.max(0);
+  grid_map::Matrix shifted_costmap(size.x(), size.y());
+  shifted_costmap.block(kept_start.x(), kept_start.y(), kept_size.x(), kept_size.y()) =
+    cache.costmap.block(
+      std::max(-shift.x(), 0), std::max(-shift.y(), 0), kept_size.x(), kept_size.y());
+
+  // rasterize the rows then the rest of the columns that entered the grid
+  if (shift.x() != 0) {
+    const grid_map::Index start(shift.x() > 0 ? 0 : size.x() + shift.x(), 0);
+    const grid_map::Size block_size(std::abs(shift.x()), size.y());
+    shifted_costmap.block(start.x(), start.y(), block_size.x(), block_size.y()) =
+      rasterizePrimitives(start, block_size);
+  }
+  if (shift.y() != 0) {
+    const grid_map::Index start(kept_start.x(), shift.y() > 0 ? 0 : size.y() + shift.y());
+    const grid_map::Size block_size(kept_size.x(), std::abs(shift.y()));
+    shifted_costmap.block(start.x(), start.y(), block_size.x(), block_size.y()) =
+      rasterizePrimitives(start, block_size);
+  }
+
+  cache.costmap.swap(shifted_costmap);
+  return cache.costmap;
+}
+
+grid_map::Matrix CostmapGenerator::rasterizePrimitives(
+  const grid_map::Index & start_index, const grid_map::Size & size)
+{
+  // gridmap covering only the block, with the same cell centers as the costmap
+  const auto resolution = costmap_.getResolution();
+  const grid_map::Length block_length = size.cast<double>() * resolution;
+  const grid_map::Position block_position =
+    costmap_.getPosition() +
+    (0.5 * costmap_.getLength() - start_index.cast<double>() * resolution - 0.5 * block_length)
+      .matrix();
+
+  grid_map::GridMap block_costmap;
+  block_costmap.setGeometry(block_length, resolution, block_position);
   object_map::fill_polygon_areas(
-    lanelet2_costmap, transformed_primitives, LayerName::primitives, param_->grid_max_value,
-    param_->grid_min_value);
+    block_costmap, primitives_costmap_cache_.transformed_primitives, LayerName::primitives,
+    param_->grid_max_value, param_->grid_min_value);
 
-  return lanelet2_costmap[LayerName::primitives];
+  return block_costmap[LayerName::primitives];
 }
 
 grid_map::Matrix CostmapGenerator::generateCombinedCostmap()
 {
   // assuming combined_costmap is calculated by element wise max operation
-  grid_map::GridMap combined_costmap = costmap_;
-
-  combined_costmap[LayerName::combined].setConstant(param_->grid_min_value);
-
-  combined_costmap[LayerName::combined] =
-    combined_costmap[LayerName::combined].cwiseMax(combined_costmap[LayerName::points]);
-
-  combined_costmap[LayerName::combined] =
-    combined_costmap[LayerName::combined].cwiseMax(combined_costmap[LayerName::primitives]);
-
-  combined_costmap[LayerName::combined] =
-    combined_costmap[LayerName::combined].cwiseMax(combined_costmap[LayerName::objects]);
-
-  return combined_costmap[LayerName::combined];
+  return costmap_[LayerName::points]
+    .cwiseMax(costmap_[LayerName::primitives])
+    .cwiseMax(costmap_[LayerName::objects])
+    .cwiseMax(static_cast<float>(param_->grid_min_value));
 }
 
 void CostmapGenerator::publishCostmap(
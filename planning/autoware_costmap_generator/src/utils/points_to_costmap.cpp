@@ -44,6 +44,8 @@
 
 #include "autoware/costmap_generator/utils/points_to_costmap.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -57,19 +59,19 @@ void PointsToCostmap::initGridmapParam(const grid_map::GridMap & gridmap)
   grid_resolution_ = gridmap.getResolution();
   grid_position_x_ = gridmap.getPosition().x();
   grid_position_y_ = gridmap.getPosition().y();
+  // the number of cells computed from the length can exceed the size of the gridmap by rounding
+  x_cell_size_ = std::min(
+    static_cast<int>(std::ceil(grid_length_x_ * (1 / grid_resolution_))), gridmap.getSize().x());
+  y_cell_size_ = std::min(
+    static_cast<int>(std::ceil(grid_length_y_ * (1 / grid_resolution_))), gridmap.getSize().y());
 }
 
 bool PointsToCostmap::isValidInd(const grid_map::Index & grid_ind)
 {
-  bool is_valid = false;
   int x_grid_ind = grid_ind.x();
   int y_grid_ind = grid_ind.y();
-  if (
-    x_grid_ind >= 0 && x_grid_ind < std::ceil(grid_length_x_ * (1 / grid_resolution_)) &&
-    y_grid_ind >= 0 && y_grid_ind < std::ceil(grid_length_y_ * (1 / grid_resolution_))) {
-    is_valid = true;
-  }
-  return is_valid;
+  return x_grid_ind >= 0 && x_grid_ind < x_cell_size_ && y_grid_ind >= 0 &&
+         y_grid_ind < y_cell_size_;
 }
 
 grid_map::Index PointsToCostmap::fetchGridIndexFromPoint(const pcl::PointXYZ & point)
@@ -88,43 +90,42 @@ grid_map::Index PointsToCostmap::fetchGridIndexFromPoint(const pcl::PointXYZ & p
   return index;
 }
 
-std::vector<std::vector<std::vector<double>>> PointsToCostmap::assignPoints2GridCell(
+void PointsToCostmap::assignPoints2GridCell(
+  const double maximum_height_thres, const double minimum_height_thres,
   const pcl::PointCloud<pcl::PointXYZ> & in_sensor_points)
 {
-  double y_cell_size = std::ceil(grid_length_y_ * (1 / grid_resolution_));
-  double x_cell_size = std::ceil(grid_length_x_ * (1 / grid_resolution_));
-  std::vector<double> z_vec;
-  std::vector<std::vector<double>> vec_y_z(y_cell_size, z_vec);
-  std::vector<std::vector<std::vector<double>>> vec_x_y_z(x_cell_size, vec_y_z);
+  cell_states_.assign(static_cast<size_t>(x_cell_size_) * y_cell_size_, CellState::EMPTY);
 
   for (const auto & point : in_sensor_points) {
     grid_map::Index grid_ind = fetchGridIndexFromPoint(point);
-    if (isValidInd(grid_ind)) {
-      vec_x_y_z[grid_ind.x()][grid_ind.y()].push_back(point.z);
+    if (!isValidInd(grid_ind)) {
+      continue;
     }
+    const uint8_t state = point.z > maximum_height_thres || point.z < minimum_height_thres
+                            ? CellState::OUT_OF_HEIGHT_RANGE
+                            : CellState::IN_HEIGHT_RANGE;
+    auto & cell_state = cell_states_[grid_ind.y() * x_cell_size_ + grid_ind.x()];
+    cell_state = std::max(cell_state, state);
   }
-  return vec_x_y_z;
 }
 
 grid_map::Matrix PointsToCostmap::calculateCostmap(
-  const double maximum_height_thres, const double minimum_lidar_height_thres,
   const double grid_min_value, const double grid_max_value, const grid_map::GridMap & gridmap,
-  const std::string & gridmap_layer_name,
-  const std::vector<std::vector<std::vector<double>>> grid_vec)
+  const std::string & gridmap_layer_name)
 {
   grid_map::Matrix gridmap_data = gridmap[gridmap_layer_name];
-  for (size_t x_ind = 0; x_ind < grid_vec.size(); x_ind++) {
-    for (size_t y_ind = 0; y_ind < grid_vec[0].size(); y_ind++) {
-      if (grid_vec[x_ind][y_ind].size() == 0) {
-        gridmap_data(x_ind, y_ind) = grid_min_value;
-        continue;
-      }
-      for (const auto & z : grid_vec[x_ind][y_ind]) {
-        if (z > maximum_height_thres || z < minimum_lidar_height_thres) {
-          continue;
-        }
-        gridmap_data(x_ind, y_ind) = grid_max_value;
-        break;
+  for (int y_ind = 0; y_ind < y_cell_size_; y_ind++) {
+    for (int x_ind = 0; x_ind < x_cell_size_; x_ind++) {
+      // cells whose points are all out of the height range keep their current cost
+      switch (cell_states_[y_ind * x_cell_size_ + x_ind]) {
+        case CellState::EMPTY:
+          gridmap_data(x_ind, y_ind) = grid_min_value;
+          break;
+        case CellState::IN_HEIGHT_RANGE:
+          gridmap_data(x_ind, y_ind) = grid_max_value;
+          break;
+        default:
+          break;
       }
     }
   }
@@ -137,11 +138,8 @@ grid_map::Matrix PointsToCostmap::makeCostmapFromPoints(
   const std::string & gridmap_layer_name, const pcl::PointCloud<pcl::PointXYZ> & in_sensor_points)
 {
   initGridmapParam(gridmap);
-  std::vector<std::vector<std::vector<double>>> grid_vec = assignPoints2GridCell(in_sensor_points);
-  grid_map::Matrix costmap = calculateCostmap(
-    maximum_height_thres, minimum_lidar_height_thres, grid_min_value, grid_max_value, gridmap,
-    gridmap_layer_name, grid_vec);
-  return costmap;
+  assignPoints2GridCell(maximum_height_thres, minimum_lidar_height_thres, in_sensor_points);
+  return calculateCostmap(grid_min_value, grid_max_value, gridmap, gridmap_layer_name);
 }
 
 }  // namespace autoware::costmap_generator
@@ -23,6 +23,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 using autoware::costmap_generator::CostmapGenerator;
@@ -129,6 +130,38 @@ public:
     return costmap_generator_->isActive();
   }
 
+  void set_up_primitives()
+  {
+    costmap_generator_->primitives_polygons_.clear();
+    costmap_generator_->loadRoadAreasFromLaneletMap(
+      lanelet_map_, costmap_generator_->primitives_polygons_);
+    costmap_generator_->loadParkingAreasFromLaneletMap(
+      lanelet_map_, costmap_generator_->primitives_polygons_);
+    costmap_generator_->primitives_costmap_cache_.is_valid = false;
+  }
+
+  void move_ego(const double x, const double y)
+  {
+    geometry_msgs::msg::TransformStamped tf;
+    tf.transform.translation.x = x;
+    tf.transform.translation.y = y;
+    costmap_generator_->set_grid_center(tf);
+  }
+
+  /// \brief return the primitives layer updated from the cache and the same layer rasterized
+  /// from scratch at the current grid position
+  std::pair<grid_map::Matrix, grid_map::Matrix> test_generate_primitives_costmap()
+  {
+    const grid_map::Matrix cached = costmap_generator_->generatePrimitivesCostmap();
+    costmap_generator_->primitives_costmap_cache_.is_valid = false;
+    const grid_map::Matrix rasterized = costmap_generator_->generatePrimitivesCostmap();
+    return {cached, rasterized};
+  }
+
+  [[nodiscard]] double get_grid_max_value() { return costmap_generator_->param_->grid_max_value; }
+
+  [[nodiscard]] double get_grid_min_value() { return costmap_generator_->param_->grid_min_value; }
+
   void TearDown() override
   {
     rclcpp::shutdown();
@@ -173,3 +206,24 @@ TEST_F(TestCostmapGenerator, testIsActive)
   EXPECT_FALSE(test_is_active_by_scenario(false));
   EXPECT_FALSE(test_is_active_by_scenario(true, true));
 }
+
+TEST_F(TestCostmapGenerator, testShiftedPrimitivesCostmap)
+{
+  set_up_primitives();
+  move_ego(3697.07, 73735.49);
+  test_generate_primitives_costmap();
+
+  // ego moves that are not multiples of the grid resolution, in both directions of both axes
+  const std::vector<std::pair<double, double>> ego_positions{
+    {3698.44, 73733.38}, {3697.49, 73733.82}, {3707.61, 73741.55}, {3701.23, 73739.04}};
+  for (const auto & [x, y] : ego_positions) {
+    move_ego(x, y);
+    const auto [cached, rasterized] = test_generate_primitives_costmap();
+    ASSERT_EQ(cached.rows(), rasterized.rows());
+    ASSERT_EQ(cached.cols(), rasterized.cols());
+    EXPECT_EQ((cached.array() != rasterized.array()).count(), 0);
+    // both the areas and the cells outside of them are compared
+    EXPECT_GT((rasterized.array() == static_cast<float>(get_grid_max_value())).count(), 0);
+    EXPECT_GT((rasterized.array() == static_cast<float>(get_grid_min_value())).count(), 0);
+  }
+}
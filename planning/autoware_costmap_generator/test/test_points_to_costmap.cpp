@@ -221,4 +221,52 @@ TEST_F(PointsToCostmapTest, TestMakeCostmapFromPoints_invalidPoints_outOfGrid)
 
   EXPECT_EQ(nonempty_grid_cell_num, 0);
 }
+
+TEST_F(PointsToCostmapTest, TestMakeCostmapFromPoints_mixedHeightsInCell)
+{
+  // construct pointcloud in map frame
+  pointcloud in_sensor_points;
+  in_sensor_points.width = 3;
+  in_sensor_points.height = 1;
+  in_sensor_points.is_dense = false;
+  in_sensor_points.resize(in_sensor_points.width * in_sensor_points.height);
+
+  // the first two points are in the same cell, only the second one is in the height range
+  in_sensor_points.points[0].x = 0.7;
+  in_sensor_points.points[0].y = 1;
+  in_sensor_points.points[0].z = 3;
+  in_sensor_points.points[1].x = 0.6;
+  in_sensor_points.points[1].y = 1;
+  in_sensor_points.points[1].z = 0.5;
+  in_sensor_points.points[2].x = 4.5;
+  in_sensor_points.points[2].y = 4.5;
+  in_sensor_points.points[2].z = 3;
+
+  grid_map::GridMap gridmap = construct_gridmap();
+
+  PointsToCostmap point2costmap;
+  const double maximum_height_thres = 0.99;
+  const double minimum_lidar_height_thres = 0.0;
+  const double grid_min_value = 0.0;
+  const double grid_max_value = 1.0;
+  const std::string gridmap_layer_name = "points";
+
+  // the result must not depend on a previous call with the same instance
+  for (int call = 0; call < 2; call++) {
+    grid_map::Matrix costmap_data = point2costmap.makeCostmapFromPoints(
+      maximum_height_thres, minimum_lidar_height_thres, grid_min_value, grid_max_value, gridmap,
+      gridmap_layer_name, in_sensor_points);
+
+    int nonempty_grid_cell_num = 0;
+    for (int i = 0; i < costmap_data.rows(); i++) {
+      for (int j = 0; j < costmap_data.cols(); j++) {
+        if (costmap_data(i, j) == grid_max_value) {
+          nonempty_grid_cell_num += 1;
+        }
+      }
+    }
+
+    EXPECT_EQ(nonempty_grid_cell_num, 1);
+  }
+}
 }  // namespace autoware::costmap_generator
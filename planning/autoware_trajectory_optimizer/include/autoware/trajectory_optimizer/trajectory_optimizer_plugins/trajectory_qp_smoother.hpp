@@ -21,6 +21,7 @@
 #include "autoware/trajectory_optimizer/trajectory_optimizer_structs.hpp"
 
 #include <Eigen/Dense>
+#include <Eigen/Sparse>
 #include <autoware/osqp_interface/osqp_interface.hpp>
 #include <autoware_utils/system/time_keeper.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -55,6 +56,8 @@ struct QPSmootherParams
   double osqp_eps_rel{1e-4};
   int osqp_max_iter{4000};
   bool osqp_verbose{false};
+  // Keep the solver between cycles and warm start it while the problem structure is unchanged
+  bool enable_warm_start{true};
 
   // Orientation preservation
   bool preserve_input_trajectory_orientation{
@@ -74,6 +77,30 @@ struct QPSmootherParams
   int num_constrained_points_end{3};  // Number of points from end to constrain
 };
 
+/**
+ * @brief OSQP workspace kept between cycles
+ *
+ * The solver is only updated with the new values while the sparsity pattern of the problem
+ * matrices is unchanged, and rebuilt otherwise (e.g., when the trajectory size changes).
+ */
+struct QPSmootherWorkspace
+{
+  std::unique_ptr<autoware::osqp_interface::OSQPInterface> solver;
+  autoware::osqp_interface::CSC_Matrix P_csc;  // Sparsity pattern of the solver problem
+  autoware::osqp_interface::CSC_Matrix A_csc;
+  TrajectoryPoints input_trajectory;  // Input trajectory of the previous solution
+  std::vector<double> primal_solution;
+  std::vector<double> dual_solution;
+
+  void reset()
+  {
+    solver.reset();
+    input_trajectory.clear();
+    primal_solution.clear();
+    dual_solution.clear();
+  }
+};
+
 /**
  * @brief QP-based trajectory smoother for path geometry optimization
  *
@@ -106,23 +133,28 @@ private:
   // QP smoother specific parameters
   QPSmootherParams qp_params_;
 
+  // Solver workspace reused between cycles
+  QPSmootherWorkspace workspace_;
+
   /**
    * @brief Solve the QP problem for trajectory smoothing
    * @param input_trajectory Original trajectory from planner
    * @param semantic_speed_tracker Tracker containing semantic speed information (e.g., stop points)
    * @param output_trajectory Smoothed trajectory (output)
    * @return true if optimization succeeded, false otherwise
+   * @note The solver workspace of the previous cycle is updated when the sparsity pattern of the
+   *       problem is unchanged, and rebuilt otherwise
    */
   bool solve_qp_problem(
     const TrajectoryPoints & input_trajectory, const SemanticSpeedTracker & semantic_speed_tracker,
-    TrajectoryPoints & output_trajectory) const;
+    TrajectoryPoints & output_trajectory);
 
   /**
    * @brief Construct matrices for OSQP solver
    * @param input_trajectory Original trajectory for fidelity term
    * @param semantic_speed_tracker Tracker used to add hard equality constraints at detected stop
    *        positions (pinning them in place regardless of smoothness weight)
-   * @param H Hessian matrix (objective quadratic term)
+   * @param H Hessian matrix (objective quadratic term, upper triangular part)
    * @param A Constraint matrix
    * @param f_vec Gradient vector (objective linear term)
    * @param l_vec Lower bounds for constraints
@@ -130,9 +162,16 @@ private:
    */
   void prepare_osqp_matrices(
     const TrajectoryPoints & input_trajectory, const SemanticSpeedTracker & semantic_speed_tracker,
-    Eigen::MatrixXd & H, Eigen::MatrixXd & A, std::vector<double> & f_vec,
+    Eigen::SparseMatrix<double> & H, Eigen::SparseMatrix<double> & A, std::vector<double> & f_vec,
     std::vector<double> & l_vec, std::vector<double> & u_vec) const;
 
+  /**
+   * @brief Initial guess from the previous solution shifted by the ego progress
+   * @param input_trajectory Current input trajectory
+   * @return Smoothing offsets of the previous solution applied to the current input positions
+   */
+  std::vector<double> calc_warm_start_primal(const TrajectoryPoints & input_trajectory) const;
+
   /**
    * @brief Convert QP solution back to trajectory format
    * @param solution Optimization solution vector
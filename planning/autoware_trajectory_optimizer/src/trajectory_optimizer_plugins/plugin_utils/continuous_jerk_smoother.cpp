@@ -31,9 +31,10 @@ namespace autoware::trajectory_optimizer::plugin
 ContinuousJerkSmoother::ContinuousJerkSmoother(const ContinuousJerkSmootherParams & params)
 : params_(params)
 {
-  // Initialize QP solver with ProxQP
+  // Initialize QP solver with ProxQP, warm started from the previous result while the problem size
+  // is unchanged (the interface rebuilds the solver when the size changes)
   qp_interface_ =
-    std::make_shared<autoware::qp_interface::ProxQPInterface>(false, 20000, 1.0e-8, 1.0e-6, false);
+    std::make_shared<autoware::qp_interface::ProxQPInterface>(true, 20000, 1.0e-8, 1.0e-6, false);
 }
 
 void ContinuousJerkSmoother::set_params(const ContinuousJerkSmootherParams & params)
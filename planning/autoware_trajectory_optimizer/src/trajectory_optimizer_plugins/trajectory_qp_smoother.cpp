@@ -32,6 +32,26 @@
 
 namespace autoware::trajectory_optimizer::plugin
 {
+namespace
+{
+autoware::osqp_interface::CSC_Matrix to_csc_matrix(const Eigen::SparseMatrix<double> & matrix)
+{
+  autoware::osqp_interface::CSC_Matrix csc;
+  const auto nnz = static_cast<size_t>(matrix.nonZeros());
+  const auto cols = static_cast<size_t>(matrix.outerSize());
+  csc.m_vals.assign(matrix.valuePtr(), matrix.valuePtr() + nnz);
+  csc.m_row_idxs.assign(matrix.innerIndexPtr(), matrix.innerIndexPtr() + nnz);
+  csc.m_col_idxs.assign(matrix.outerIndexPtr(), matrix.outerIndexPtr() + cols + 1);
+  return csc;
+}
+
+bool has_same_sparsity(
+  const autoware::osqp_interface::CSC_Matrix & lhs,
+  const autoware::osqp_interface::CSC_Matrix & rhs)
+{
+  return lhs.m_row_idxs == rhs.m_row_idxs && lhs.m_col_idxs == rhs.m_col_idxs;
+}
+}  // namespace
 
 void TrajectoryQPSmoother::set_up_params()
 {
@@ -52,6 +72,8 @@ void TrajectoryQPSmoother::set_up_params()
     get_or_declare_parameter<int>(*node_ptr, "trajectory_qp_smoother.osqp_max_iter");
   qp_params_.osqp_verbose =
     get_or_declare_parameter<bool>(*node_ptr, "trajectory_qp_smoother.osqp_verbose");
+  qp_params_.enable_warm_start =
+    get_or_declare_parameter<bool>(*node_ptr, "trajectory_qp_smoother.enable_warm_start");
   qp_params_.preserve_input_trajectory_orientation = get_or_declare_parameter<bool>(
     *node_ptr, "trajectory_qp_smoother.preserve_input_trajectory_orientation");
   qp_params_.max_distance_for_orientation_m = get_or_declare_parameter<double>(
@@ -105,6 +127,8 @@ rcl_interfaces::msg::SetParametersResult TrajectoryQPSmoother::on_parameter(
   update_param<double>(parameters, "trajectory_qp_smoother.osqp_eps_rel", qp_params_.osqp_eps_rel);
   update_param<int>(parameters, "trajectory_qp_smoother.osqp_max_iter", qp_params_.osqp_max_iter);
   update_param<bool>(parameters, "trajectory_qp_smoother.osqp_verbose", qp_params_.osqp_verbose);
+  update_param<bool>(
+    parameters, "trajectory_qp_smoother.enable_warm_start", qp_params_.enable_warm_start);
   update_param<bool>(
     parameters, "trajectory_qp_smoother.preserve_input_trajectory_orientation",
     qp_params_.preserve_input_trajectory_orientation);
@@ -199,30 +223,59 @@ void TrajectoryQPSmoother::optimize_trajectory(
 
 bool TrajectoryQPSmoother::solve_qp_problem(
   const TrajectoryPoints & input_trajectory, const SemanticSpeedTracker & semantic_speed_tracker,
-  TrajectoryPoints & output_trajectory) const
+  TrajectoryPoints & output_trajectory)
 {
   const int N = static_cast<int>(input_trajectory.size());
   const int num_variables = 2 * N;  // [x, y] for each point (path-only optimization)
 
-  // Prepare OSQP matrices
-  Eigen::MatrixXd H(num_variables, num_variables);
-  Eigen::MatrixXd A;
-  std::vector<double> f_vec(num_variables);
-  std::vector<double> l_vec;
-  std::vector<double> u_vec;
-
-  prepare_osqp_matrices(input_trajectory, semantic_speed_tracker, H, A, f_vec, l_vec, u_vec);
-
-  // Create OSQP solver with settings
-  autoware::osqp_interface::OSQPInterface osqp_solver(qp_params_.osqp_eps_abs, true);
+  {
+    autoware_utils_debug::ScopedTimeTrack st("setup_qp", *get_time_keeper());
+
+    // Prepare OSQP matrices
+    Eigen::SparseMatrix<double> H;
+    Eigen::SparseMatrix<double> A;
+    std::vector<double> f_vec(num_variables);
+    std::vector<double> l_vec;
+    std::vector<double> u_vec;
+
+    prepare_osqp_matrices(input_trajectory, semantic_speed_tracker, H, A, f_vec, l_vec, u_vec);
+
+    const auto P_csc = to_csc_matrix(H);
+    const auto A_csc = to_csc_matrix(A);
+
+    // Update the previous workspace only with the new values when the problem structure is
+    // unchanged, which skips the allocation and symbolic factorization of the solver setup
+    const bool reuse_workspace = qp_params_.enable_warm_start && workspace_.solver &&
+                                 has_same_sparsity(P_csc, workspace_.P_csc) &&
+                                 has_same_sparsity(A_csc, workspace_.A_csc);
+    if (reuse_workspace) {
+      workspace_.solver->updateCscP(P_csc);
+      workspace_.solver->updateQ(f_vec);
+      workspace_.solver->updateCscA(A_csc);
+      workspace_.solver->updateBounds(l_vec, u_vec);
+      workspace_.solver->setWarmStart(
+        calc_warm_start_primal(input_trajectory), workspace_.dual_solution);
+    } else {
+      workspace_.reset();
+      workspace_.solver = std::make_unique<autoware::osqp_interface::OSQPInterface>(
+        P_csc, A_csc, f_vec, l_vec, u_vec, qp_params_.osqp_eps_abs);
+      workspace_.P_csc = P_csc;
+      workspace_.A_csc = A_csc;
+    }
 
-  // Configure solver settings
-  osqp_solver.updateEpsRel(qp_params_.osqp_eps_rel);
-  osqp_solver.updateMaxIter(qp_params_.osqp_max_iter);
-  osqp_solver.updateVerbose(qp_params_.osqp_verbose);
+    // Configure solver settings
+    workspace_.solver->updateEpsAbs(qp_params_.osqp_eps_abs);
+    workspace_.solver->updateEpsRel(qp_params_.osqp_eps_rel);
+    workspace_.solver->updateMaxIter(qp_params_.osqp_max_iter);
+    workspace_.solver->updateVerbose(qp_params_.osqp_verbose);
+  }
 
   // Solve the QP problem
-  auto result = osqp_solver.optimize(H, A, f_vec, l_vec, u_vec);
+  auto & osqp_solver = *workspace_.solver;
+  const auto result = [&]() {
+    autoware_utils_debug::ScopedTimeTrack st("solve_qp", *get_time_keeper());
+    return osqp_solver.optimize();
+  }();
 
   // Check solution status
   if (result.solution_status != 1) {
@@ -230,6 +283,7 @@ bool TrajectoryQPSmoother::solve_qp_problem(
       get_node_ptr()->get_logger(),
       "QP Smoother: Optimization FAILED! Status: %d (%s), Iterations: %d, N=%d points",
       result.solution_status, osqp_solver.getStatusMessage().c_str(), result.iteration_status, N);
+    workspace_.reset();
     return false;
   }
 
@@ -239,12 +293,18 @@ bool TrajectoryQPSmoother::solve_qp_problem(
     [](const auto v) { return std::isnan(v); });
   if (has_nan) {
     RCLCPP_WARN(get_node_ptr()->get_logger(), "QP Smoother: Solution contains NaN values");
+    workspace_.reset();
     return false;
   }
 
+  // Keep the solution as the initial guess of the next cycle
+  workspace_.input_trajectory = input_trajectory;
+  workspace_.primal_solution = result.primal_solution;
+  workspace_.dual_solution = result.lagrange_multipliers;
+
   // Post-process to create output trajectory
-  Eigen::VectorXd solution =
-    Eigen::Map<Eigen::VectorXd>(result.primal_solution.data(), result.primal_solution.size());
+  const Eigen::VectorXd solution = Eigen::Map<const Eigen::VectorXd>(
+    result.primal_solution.data(), static_cast<Eigen::Index>(result.primal_solution.size()));
   post_process_trajectory(solution, input_trajectory, semantic_speed_tracker, output_trajectory);
 
   // Calculate path deviation metrics
@@ -287,13 +347,20 @@ bool TrajectoryQPSmoother::solve_qp_problem(
 
 void TrajectoryQPSmoother::prepare_osqp_matrices(
   const TrajectoryPoints & input_trajectory, const SemanticSpeedTracker & semantic_speed_tracker,
-  Eigen::MatrixXd & H, Eigen::MatrixXd & A, std::vector<double> & f_vec,
+  Eigen::SparseMatrix<double> & H, Eigen::SparseMatrix<double> & A, std::vector<double> & f_vec,
   std::vector<double> & l_vec, std::vector<double> & u_vec) const
 {
   const int N = static_cast<int>(input_trajectory.size());
   const int num_variables = 2 * N;
 
-  H = Eigen::MatrixXd::Zero(num_variables, num_variables);
+  // The sparse matrices keep the same sparsity pattern for the same problem structure, whatever
+  // the values, so that the solver workspace can be updated instead of rebuilt.
+  // Only the upper triangular part of H is set, as required by OSQP.
+  std::vector<Eigen::Triplet<double>> H_triplets;
+  H_triplets.reserve(static_cast<size_t>(12 * N));
+  const auto add_H = [&](const int row, const int col, const double value) {
+    H_triplets.emplace_back(std::min(row, col), std::max(row, col), value);
+  };
   std::fill(f_vec.begin(), f_vec.end(), 0.0);
 
   // Use fixed time step for temporal scaling
@@ -305,34 +372,19 @@ void TrajectoryQPSmoother::prepare_osqp_matrices(
 
   // Minimize path curvature: Σ ||(p_{i+1} - 2*p_i + p_{i-1})||²
   for (int i = 1; i < N - 1; ++i) {
-    const int x_im1 = 2 * (i - 1);
-    const int y_im1 = 2 * (i - 1) + 1;
-    const int x_i = 2 * i;
-    const int y_i = 2 * i + 1;
-    const int x_ip1 = 2 * (i + 1);
-    const int y_ip1 = 2 * (i + 1) + 1;
-
-    // x-direction curvature
-    H(x_im1, x_im1) += weight_smoothness_scaled;
-    H(x_i, x_i) += 4.0 * weight_smoothness_scaled;
-    H(x_ip1, x_ip1) += weight_smoothness_scaled;
-    H(x_im1, x_i) += -2.0 * weight_smoothness_scaled;
-    H(x_i, x_im1) += -2.0 * weight_smoothness_scaled;
-    H(x_i, x_ip1) += -2.0 * weight_smoothness_scaled;
-    H(x_ip1, x_i) += -2.0 * weight_smoothness_scaled;
-    H(x_im1, x_ip1) += weight_smoothness_scaled;
-    H(x_ip1, x_im1) += weight_smoothness_scaled;
-
-    // y-direction curvature
-    H(y_im1, y_im1) += weight_smoothness_scaled;
-    H(y_i, y_i) += 4.0 * weight_smoothness_scaled;
-    H(y_ip1, y_ip1) += weight_smoothness_scaled;
-    H(y_im1, y_i) += -2.0 * weight_smoothness_scaled;
-    H(y_i, y_im1) += -2.0 * weight_smoothness_scaled;
-    H(y_i, y_ip1) += -2.0 * weight_smoothness_scaled;
-    H(y_ip1, y_i) += -2.0 * weight_smoothness_scaled;
-    H(y_im1, y_ip1) += weight_smoothness_scaled;
-    H(y_ip1, y_im1) += weight_smoothness_scaled;
+    // x-direction (offset 0) and y-direction (offset 1) curvature
+    for (int offset = 0; offset < 2; ++offset) {
+      const int im1 = 2 * (i - 1) + offset;
+      const int ii = 2 * i + offset;
+      const int ip1 = 2 * (i + 1) + offset;
+
+      add_H(im1, im1, weight_smoothness_scaled);
+      add_H(ii, ii, 4.0 * weight_smoothness_scaled);
+      add_H(ip1, ip1, weight_smoothness_scaled);
+      add_H(im1, ii, -2.0 * weight_smoothness_scaled);
+      add_H(ii, ip1, -2.0 * weight_smoothness_scaled);
+      add_H(im1, ip1, weight_smoothness_scaled);
+    }
   }
 
   // Compute per-point fidelity weights (uniform if feature disabled, velocity-based if enabled)
@@ -346,12 +398,16 @@ void TrajectoryQPSmoother::prepare_osqp_matrices(
     const double y_orig = input_trajectory[i].pose.position.y;
     const double w_i = fidelity_weights[i];  // Per-point weight
 
-    H(x_i, x_i) += w_i;
-    H(y_i, y_i) += w_i;
+    add_H(x_i, x_i, w_i);
+    add_H(y_i, y_i, w_i);
     f_vec[x_i] = -w_i * x_orig;
     f_vec[y_i] = -w_i * y_orig;
   }
 
+  H.resize(num_variables, num_variables);
+  H.setFromTriplets(H_triplets.begin(), H_triplets.end());
+  H.makeCompressed();
+
   const int num_points_start = std::max(0, qp_params_.num_constrained_points_start);
   const int num_points_end = std::max(0, qp_params_.num_constrained_points_end);
 
@@ -373,60 +429,69 @@ void TrajectoryQPSmoother::prepare_osqp_matrices(
 
   const int num_constraints =
     2 * (num_points_start + num_points_end + static_cast<int>(stop_constraint_indices.size()));
-  A = Eigen::MatrixXd::Zero(num_constraints, num_variables);
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  A_triplets.reserve(static_cast<size_t>(num_constraints));
   l_vec.resize(num_constraints);
   u_vec.resize(num_constraints);
 
   int constraint_idx = 0;
 
-  // Fix first num_points_start points
-  for (int i = 0; i < num_points_start; ++i) {
-    const int x_idx = 2 * i;
-    const int y_idx = 2 * i + 1;
-
-    A(constraint_idx, x_idx) = 1.0;
-    l_vec[constraint_idx] = input_trajectory[i].pose.position.x;
-    u_vec[constraint_idx] = input_trajectory[i].pose.position.x;
-    constraint_idx++;
-
-    A(constraint_idx, y_idx) = 1.0;
-    l_vec[constraint_idx] = input_trajectory[i].pose.position.y;
-    u_vec[constraint_idx] = input_trajectory[i].pose.position.y;
-    constraint_idx++;
-  }
-
-  // Fix last num_points_end points
-  for (int i = 0; i < num_points_end; ++i) {
-    const int point_idx = N - num_points_end + i;
+  // Pin the x and y positions of the given point
+  const auto fix_point = [&](const int point_idx) {
     const int x_idx = 2 * point_idx;
     const int y_idx = 2 * point_idx + 1;
 
-    A(constraint_idx, x_idx) = 1.0;
+    A_triplets.emplace_back(constraint_idx, x_idx, 1.0);
     l_vec[constraint_idx] = input_trajectory[point_idx].pose.position.x;
     u_vec[constraint_idx] = input_trajectory[point_idx].pose.position.x;
     constraint_idx++;
 
-    A(constraint_idx, y_idx) = 1.0;
+    A_triplets.emplace_back(constraint_idx, y_idx, 1.0);
     l_vec[constraint_idx] = input_trajectory[point_idx].pose.position.y;
     u_vec[constraint_idx] = input_trajectory[point_idx].pose.position.y;
     constraint_idx++;
+  };
+
+  // Fix first num_points_start points
+  for (int i = 0; i < num_points_start; ++i) {
+    fix_point(i);
+  }
+
+  // Fix last num_points_end points
+  for (int i = 0; i < num_points_end; ++i) {
+    fix_point(N - num_points_end + i);
   }
 
   // Hard-constrain stop points from slowdown ranges
   for (const int point_idx : stop_constraint_indices) {
-    const int x_idx = 2 * point_idx;
-    const int y_idx = 2 * point_idx + 1;
+    fix_point(point_idx);
+  }
 
-    A(constraint_idx, x_idx) = 1.0;
-    l_vec[constraint_idx] = input_trajectory[point_idx].pose.position.x;
-    u_vec[constraint_idx] = input_trajectory[point_idx].pose.position.x;
-    constraint_idx++;
+  A.resize(num_constraints, num_variables);
+  A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+  A.makeCompressed();
+}
 
-    A(constraint_idx, y_idx) = 1.0;
-    l_vec[constraint_idx] = input_trajectory[point_idx].pose.position.y;
-    u_vec[constraint_idx] = input_trajectory[point_idx].pose.position.y;
-    constraint_idx++;
+std::vector<double> TrajectoryQPSmoother::calc_warm_start_primal(
+  const TrajectoryPoints & input_trajectory) const
+{
+  const auto & prev_input = workspace_.input_trajectory;
+  const auto & prev_solution = workspace_.primal_solution;
+  const size_t N = input_trajectory.size();
+  std::vector<double> primal(2 * N);
+
+  // The input trajectory starts further along the previous one as ego moves forward: the
+  // smoothing offsets of the previous solution are applied to the points at the same position
+  const size_t shift =
+    autoware::motion_utils::findNearestIndex(prev_input, input_trajectory.front().pose.position);
+  for (size_t i = 0; i < N; ++i) {
+    const size_t prev_i = std::min(i + shift, prev_input.size() - 1);
+    primal[2 * i] = input_trajectory[i].pose.position.x + prev_solution[2 * prev_i] -
+                    prev_input[prev_i].pose.position.x;
+    primal[2 * i + 1] = input_trajectory[i].pose.position.y + prev_solution[2 * prev_i + 1] -
+                        prev_input[prev_i].pose.position.y;
   }
+  return primal;
 }
 
 void TrajectoryQPSmoother::post_process_trajectory(
@@ -0,0 +1,138 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/trajectory_ranker/data_structs.hpp"
+#include "autoware/trajectory_ranker/evaluation.hpp"
+
+#include <autoware/route_handler/route_handler.hpp>
+#include <autoware_vehicle_info_utils/vehicle_info.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using autoware::trajectory_ranker::CoreData;
+using autoware::trajectory_ranker::Evaluator;
+using autoware::trajectory_ranker::EvaluatorParameters;
+using autoware::trajectory_ranker::TrajectoryPoints;
+using autoware_perception_msgs::msg::PredictedObjects;
+using autoware_planning_msgs::msg::TrajectoryPoint;
+
+// straight trajectory along x with the given lateral offset
+std::shared_ptr<TrajectoryPoints> create_trajectory(const size_t index, const double offset_y)
+{
+  auto points = std::make_shared<TrajectoryPoints>();
+  for (size_t i = 0; i < 50; ++i) {
+    TrajectoryPoint point;
+    point.pose.position.x = static_cast<double>(i);
+    point.pose.position.y = offset_y;
+    point.pose.orientation.w = 1.0;
+    point.longitudinal_velocity_mps = 2.0 + 0.01 * static_cast<double>(index * i);
+    point.lateral_velocity_mps = 0.1 * std::sin(0.1 * static_cast<double>(index + i));
+    point.time_from_start = rclcpp::Duration::from_seconds(static_cast<double>(i) * 0.2);
+    points->push_back(point);
+  }
+  return points;
+}
+
+// objects crossing the candidate trajectories
+std::shared_ptr<PredictedObjects> create_objects(const size_t nb_objects)
+{
+  auto objects = std::make_shared<PredictedObjects>();
+  for (size_t i = 0; i < nb_objects; ++i) {
+    autoware_perception_msgs::msg::PredictedObject object;
+    object.kinematics.initial_pose_with_covariance.pose.position.x = static_cast<double>(i);
+    object.kinematics.initial_pose_with_covariance.pose.position.y = 10.0;
+    autoware_perception_msgs::msg::PredictedPath path;
+    path.confidence = 1.0;
+    path.time_step = rclcpp::Duration::from_seconds(0.5);
+    for (size_t j = 0; j < 20; ++j) {
+      geometry_msgs::msg::Pose pose;
+      pose.position.x = static_cast<double>(i);
+      pose.position.y = 10.0 - static_cast<double>(j);
+      pose.orientation.z = -std::sqrt(0.5);
+      pose.orientation.w = std::sqrt(0.5);
+      path.path.push_back(pose);
+    }
+    object.kinematics.predicted_paths.push_back(path);
+    objects->objects.push_back(object);
+  }
+  return objects;
+}
+
+int main()
+{
+  try {
+    constexpr auto nb_iterations = 20;
+    const std::vector<std::string> metrics{
+      "autoware::trajectory_ranker::metrics::LateralAcceleration",
+      "autoware::trajectory_ranker::metrics::LongitudinalJerk",
+      "autoware::trajectory_ranker::metrics::TravelDistance",
+      "autoware::trajectory_ranker::metrics::TimeToCollision"};
+    const auto route_handler = std::make_shared<autoware::route_handler::RouteHandler>();
+    const auto vehicle_info = std::make_shared<autoware::vehicle_info_utils::VehicleInfo>(
+      autoware::vehicle_info_utils::createVehicleInfo(
+        0.383, 0.235, 2.79, 1.64, 1.0, 1.1, 0.5, 0.5, 2.5, 0.7));
+    const auto objects = create_objects(30);
+    const auto previous_points = create_trajectory(0, 0.0);
+
+    auto params = std::make_shared<EvaluatorParameters>(metrics.size(), 10);
+    params->time_decay_weight.assign(metrics.size(), std::vector<float>(10, 1.0f));
+    params->metrics_max_value = {5.0, 10.0, 50.0, 6.0};
+    params->score_weight = {0.1, 0.1, 0.3, 0.6};
+
+    std::printf("nb_candidates, nb_threads, evaluation_ns\n");
+    for (const auto nb_candidates : {50lu, 100lu, 200lu, 400lu}) {
+      for (const auto nb_threads : {1lu, 2lu, 4lu, 8lu}) {
+        Evaluator evaluator(route_handler, vehicle_info, rclcpp::get_logger("evaluator_benchmark"));
+        evaluator.set_num_threads(nb_threads);
+        for (size_t i = 0; i < metrics.size(); ++i) {
+          evaluator.load_metric(metrics.at(i), i, 0.5);
+        }
+        std::chrono::nanoseconds evaluation_time{0};
+        for (auto iteration = 0; iteration < nb_iterations; ++iteration) {
+          evaluator.clear();
+          for (size_t i = 0; i < nb_candidates; ++i) {
+            auto core_data = std::make_shared<CoreData>(
+              create_trajectory(i, 0.05 * static_cast<double>(i)), previous_points, objects,
+              std::make_shared<lanelet::ConstLanelets>(), "trajectory_" + std::to_string(i));
+            evaluator.add(core_data);
+          }
+          evaluator.setup(previous_points);
+          const auto start = std::chrono::steady_clock::now();
+          evaluator.best(params);
+          const auto end = std::chrono::steady_clock::now();
+          evaluation_time += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        }
+        std::printf(
+          "%lu, %lu, %ld\n", nb_candidates, nb_threads, evaluation_time.count() / nb_iterations);
+      }
+    }
+  } catch (const std::exception & e) {
+    std::cerr << "Exception in main(): " << e.what() << std::endl;
+    return {};
+  } catch (...) {
+    std::cerr << "Unknown exception in main()" << std::endl;
+    return {};
+  }
+  return 0;
+}
@@ -24,6 +24,7 @@
 #include <pluginlib/class_loader.hpp>
 #include <rclcpp/rclcpp.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -68,6 +69,15 @@ public:
    */
   void unload_metric(const std::string & name);
 
+  /**
+   * @brief Sets the number of threads evaluating the metrics of the trajectories in parallel
+   * @param num_threads Number of threads
+   */
+  void set_num_threads(const size_t num_threads)
+  {
+    num_threads_ = std::max<size_t>(num_threads, 1);
+  }
+
   /**
    * @brief Adds trajectory data for evaluation
    * @param core_data Core trajectory data to evaluate
@@ -165,6 +175,8 @@ private:
   rclcpp::Logger logger_;
 
   rclcpp::Node * node_ptr_{nullptr};
+
+  size_t num_threads_{1};
 };
 
 }  // namespace autoware::trajectory_ranker
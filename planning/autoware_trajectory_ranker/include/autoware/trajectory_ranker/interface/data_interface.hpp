@@ -23,6 +23,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::trajectory_ranker
@@ -95,6 +96,11 @@ public:
     metrics_.at(idx) = metric;
   }
 
+  void set_metric(const size_t idx, std::vector<float> && metric)
+  {
+    metrics_.at(idx) = std::move(metric);
+  }
+
   float total() const { return total_; }
 
   float score(const size_t index) const { return scores_.at(index); }
@@ -27,7 +27,9 @@
 namespace autoware::trajectory_ranker::metrics::utils
 {
 
+using autoware_perception_msgs::msg::PredictedObject;
 using autoware_perception_msgs::msg::PredictedObjects;
+using autoware_perception_msgs::msg::PredictedPath;
 using autoware_planning_msgs::msg::TrajectoryPoint;
 using geometry_msgs::msg::Pose;
 using vehicle_info_utils::VehicleInfo;
@@ -109,6 +111,25 @@ float time_to_collision(
   const TrajectoryPoint & ego_point, const rclcpp::Duration & duration,
   const autoware_perception_msgs::msg::PredictedObject & object, const float max_ttc_value);
 
+/**
+ * @brief Finds the predicted path with the highest confidence
+ * @param object Predicted object
+ * @return Pointer to the path in the object, nullptr if the object has no path
+ */
+const PredictedPath * max_confidence_path(const PredictedObject & object);
+
+/**
+ * @brief Calculates time to collision with a predicted object moving along the given path
+ * @param ego_point Ego trajectory point
+ * @param duration Time offset for object prediction
+ * @param object Predicted object
+ * @param predicted_path Path of the object, e.g. the result of max_confidence_path()
+ * @return Time to collision [s] (capped at max_ttc_value)
+ */
+float time_to_collision(
+  const TrajectoryPoint & ego_point, const rclcpp::Duration & duration,
+  const PredictedObject & object, const PredictedPath & predicted_path, const float max_ttc_value);
+
 }  // namespace autoware::trajectory_ranker::metrics::utils
 
 #endif  // AUTOWARE__TRAJECTORY_RANKER__METRICS__METRICS_UTILS_HPP_
@@ -17,7 +17,10 @@
 #include <rclcpp/logging.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <exception>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -67,13 +70,34 @@ void Evaluator::unload_metric(const std::string & name)
 
 void Evaluator::evaluate(const std::vector<float> & max_value)
 {
-  for (const auto & result : results_) {
-    for (const auto & plugin : plugins_) {
-      if (plugin->index() < max_value.size()) {
-        plugin->evaluate(result, max_value.at(plugin->index()));
+  // each pair of a trajectory and a metric only writes its own metric, so the pairs are evaluated
+  // in parallel
+  const auto plugin_num = plugins_.size();
+  const auto pair_num = static_cast<int64_t>(results_.size() * plugin_num);
+  std::exception_ptr exception;
+
+#pragma omp parallel for schedule(dynamic) num_threads(static_cast<int>(num_threads_))
+  for (int64_t i = 0; i < pair_num; i++) {
+    const auto & result = results_.at(static_cast<size_t>(i) / plugin_num);
+    const auto & plugin = plugins_.at(static_cast<size_t>(i) % plugin_num);
+    if (plugin->index() >= max_value.size()) {
+      continue;
+    }
+    try {
+      plugin->evaluate(result, max_value.at(plugin->index()));
+    } catch (...) {
+#pragma omp critical
+      {
+        if (!exception) {
+          exception = std::current_exception();
+        }
       }
     }
   }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
 }
 
 void Evaluator::normalize(const std::vector<std::vector<float>> & weight)
@@ -88,7 +112,7 @@ void Evaluator::normalize(const std::vector<std::vector<float>> & weight)
     return;
   }
 
-  const auto range = [weight](const size_t index) {
+  const auto range = [&weight](const size_t index) {
     float min = 0.0f;
     float max = std::reduce(weight.at(index).begin(), weight.at(index).end());
     return std::make_pair(min, max);
@@ -14,11 +14,12 @@
 
 #include "autoware/trajectory_ranker/metrics/distance_metric.hpp"
 
-#include <autoware/motion_utils/trajectory/trajectory.hpp>
+#include <autoware_utils_geometry/geometry.hpp>
 
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace autoware::trajectory_ranker::metrics
@@ -36,18 +37,18 @@ void TravelDistance::evaluate(
   constexpr float epsilon = 1.0e-3f;
   std::vector<float> distances(points->size(), 0.0f);
   if (max_value < epsilon) {
-    result->set_metric(index(), distances);
+    result->set_metric(index(), std::move(distances));
     return;
   }
 
-  for (size_t i = 0; i < result->points()->size(); i++) {
-    distances.at(i) = std::min(
-      1.0f,
-      static_cast<float>(autoware::motion_utils::calcSignedArcLength(*result->points(), 0L, i)) /
-        max_value);
+  // the arc length is accumulated instead of being measured from the first point for each point
+  double arc_length = 0.0;
+  for (size_t i = 1; i < points->size(); i++) {
+    arc_length += autoware_utils_geometry::calc_distance2d(points->at(i - 1), points->at(i));
+    distances.at(i) = std::min(1.0f, static_cast<float>(arc_length) / max_value);
   }
 
-  result->set_metric(index(), distances);
+  result->set_metric(index(), std::move(distances));
 }
 
 }  // namespace autoware::trajectory_ranker::metrics
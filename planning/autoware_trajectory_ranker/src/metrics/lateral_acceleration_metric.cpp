@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace autoware::trajectory_ranker::metrics
@@ -28,28 +29,28 @@ void LateralAcceleration::evaluate(
   const std::shared_ptr<autoware::trajectory_ranker::DataInterface> & result,
   const float max_value) const
 {
-  if (!result->points() || result->points()->size() < 2) return;
+  const auto points = result->points();
+  if (!points || points->size() < 2) return;
 
-  std::vector<float> lateral_accelerations(result->points()->size(), 0.0f);
+  std::vector<float> lateral_accelerations(points->size(), 0.0f);
   constexpr float epsilon = 1.0e-3f;
   const float time_resolution = resolution() > epsilon ? resolution() : epsilon;
 
   if (max_value < epsilon) {
-    result->set_metric(index(), lateral_accelerations);
+    result->set_metric(index(), std::move(lateral_accelerations));
     return;
   }
 
-  lateral_accelerations.reserve(result->points()->size());
-  for (size_t i = 0; i < result->points()->size() - 1; i++) {
-    const auto lateral_acc = (result->points()->at(i + 1).lateral_velocity_mps -
-                              result->points()->at(i).lateral_velocity_mps) /
-                             time_resolution;
+  for (size_t i = 0; i < points->size() - 1; i++) {
+    const auto lateral_acc =
+      (points->at(i + 1).lateral_velocity_mps - points->at(i).lateral_velocity_mps) /
+      time_resolution;
     lateral_accelerations.at(i) =
       std::min(1.0f, static_cast<float>(std::abs(lateral_acc)) / max_value);
   }
   lateral_accelerations.back() = lateral_accelerations.at(lateral_accelerations.size() - 2);
 
-  result->set_metric(index(), lateral_accelerations);
+  result->set_metric(index(), std::move(lateral_accelerations));
 }
 
 }  // namespace autoware::trajectory_ranker::metrics
@@ -21,6 +21,7 @@
 #include <cmath>
 #include <cstddef>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace autoware::trajectory_ranker::metrics
@@ -39,13 +40,13 @@ void LateralDeviation::evaluate(
   std::vector<float> deviations(points->size(), 0.0f);
 
   if (max_value < epsilon) {
-    result->set_metric(index(), deviations);
+    result->set_metric(index(), std::move(deviations));
     return;
   }
 
   const auto preferred_lanes = result->preferred_lanes();
   if (!preferred_lanes || preferred_lanes->empty()) {
-    result->set_metric(index(), deviations);
+    result->set_metric(index(), std::move(deviations));
     return;
   }
 
@@ -56,7 +57,7 @@ void LateralDeviation::evaluate(
       std::min(1.0f, static_cast<float>(std::abs(arc_coordinates.distance)) / max_value);
   }
 
-  result->set_metric(index(), deviations);
+  result->set_metric(index(), std::move(deviations));
 }
 
 }  // namespace autoware::trajectory_ranker::metrics
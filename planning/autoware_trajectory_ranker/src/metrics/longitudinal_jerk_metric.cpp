@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace autoware::trajectory_ranker::metrics
@@ -37,7 +38,7 @@ void LongitudinalJerk::evaluate(
   const float time_resolution = resolution() > epsilon ? resolution() : epsilon;
 
   if (max_value < epsilon) {
-    result->set_metric(index(), jerk);
+    result->set_metric(index(), std::move(jerk));
     return;
   }
 
@@ -56,7 +57,7 @@ void LongitudinalJerk::evaluate(
   }
   jerk.back() = jerk.at(jerk.size() - 2);
 
-  result->set_metric(index(), jerk);
+  result->set_metric(index(), std::move(jerk));
 }
 
 }  // namespace autoware::trajectory_ranker::metrics
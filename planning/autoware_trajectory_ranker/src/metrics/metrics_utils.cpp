@@ -167,13 +167,27 @@ float time_to_collision(
   const TrajectoryPoint & ego_point, const rclcpp::Duration & duration,
   const autoware_perception_msgs::msg::PredictedObject & object, const float max_ttc_value)
 {
-  // Find the path with highest confidence
-  const auto max_confidence_path = std::max_element(
+  const auto predicted_path = max_confidence_path(object);
+  if (!predicted_path) return max_ttc_value;
+
+  return time_to_collision(ego_point, duration, object, *predicted_path, max_ttc_value);
+}
+
+const PredictedPath * max_confidence_path(const PredictedObject & object)
+{
+  const auto itr = std::max_element(
     object.kinematics.predicted_paths.begin(), object.kinematics.predicted_paths.end(),
     [](const auto & a, const auto & b) { return a.confidence < b.confidence; });
-  if (max_confidence_path == object.kinematics.predicted_paths.end()) return max_ttc_value;
+  if (itr == object.kinematics.predicted_paths.end()) return nullptr;
 
-  const auto & object_path = max_confidence_path->path;
+  return &(*itr);
+}
+
+float time_to_collision(
+  const TrajectoryPoint & ego_point, const rclcpp::Duration & duration,
+  const PredictedObject & object, const PredictedPath & predicted_path, const float max_ttc_value)
+{
+  const auto & object_path = predicted_path.path;
   if (object_path.size() < 2) {
     if (duration.seconds() == 0.0f) {
       TrajectoryPoint object_point;
@@ -188,7 +202,7 @@ float time_to_collision(
     return max_ttc_value;
   }
 
-  const float dt = rclcpp::Duration(max_confidence_path->time_step).seconds();
+  const float dt = rclcpp::Duration(predicted_path.time_step).seconds();
   if (dt <= 0.0f) return max_ttc_value;
 
   const float max_time =
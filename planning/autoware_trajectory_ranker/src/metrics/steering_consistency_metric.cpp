@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace autoware::trajectory_ranker::metrics
@@ -31,26 +32,28 @@ void SteeringConsistency::evaluate(
   const float max_value) const
 {
   if (result->previous() == nullptr) return;
-  if (!result->points() || result->points()->size() < 2) return;
+  const auto points = result->points();
+  if (!points || points->size() < 2) return;
 
   constexpr float epsilon = 1.0e-3f;
-  std::vector<float> steering_command(result->points()->size(), 0.0f);
+  std::vector<float> steering_command(points->size(), 0.0f);
   if (max_value < epsilon) {
-    result->set_metric(index(), steering_command);
+    result->set_metric(index(), std::move(steering_command));
     return;
   }
 
+  const auto previous_points = result->previous();
   const auto wheel_base = vehicle_info()->wheel_base_m;
-  for (size_t i = 0; i < result->points()->size(); i++) {
-    const auto & point = result->points()->at(i);
-    const auto current = utils::steer_command(result->points(), point.pose, wheel_base);
-    const auto previous = utils::steer_command(result->previous(), point.pose, wheel_base);
+  for (size_t i = 0; i < points->size(); i++) {
+    const auto & point = points->at(i);
+    const auto current = utils::steer_command(points, point.pose, wheel_base);
+    const auto previous = utils::steer_command(previous_points, point.pose, wheel_base);
 
     steering_command.at(i) =
       std::min(1.0f, static_cast<float>(std::abs(current - previous)) / max_value);
   }
 
-  result->set_metric(index(), steering_command);
+  result->set_metric(index(), std::move(steering_command));
 }
 
 }  // namespace autoware::trajectory_ranker::metrics
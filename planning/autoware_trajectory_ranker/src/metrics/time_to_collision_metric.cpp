@@ -16,9 +16,12 @@
 
 #include "autoware/trajectory_ranker/metrics/metrics_utils.hpp"
 
+#include <rclcpp/duration.hpp>
+
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace autoware::trajectory_ranker::metrics
@@ -28,25 +31,43 @@ void TimeToCollision::evaluate(
   const std::shared_ptr<autoware::trajectory_ranker::DataInterface> & result,
   const float max_value) const
 {
-  if (!result->points() || result->points()->empty()) {
+  const auto points = result->points();
+  if (!points || points->empty()) {
     return;
   }
 
   constexpr float epsilon = 1.0e-3f;
-  std::vector<float> ttc(result->points()->size(), 0.0f);
+  std::vector<float> ttc(points->size(), 0.0f);
   if (max_value < epsilon) {
-    result->set_metric(index(), ttc);
+    result->set_metric(index(), std::move(ttc));
     return;
   }
 
-  ttc.reserve(result->points()->size());
-  for (size_t i = 0; i < result->points()->size(); i++) {
-    ttc.at(i) = std::min(
-      1.0f,
-      utils::time_to_collision(result->points(), result->objects(), i, max_value) / max_value);
+  // the most confident path of each object does not depend on the ego point
+  std::vector<std::pair<const utils::PredictedObject *, const utils::PredictedPath *>> objects;
+  if (const auto predicted_objects = result->objects()) {
+    objects.reserve(predicted_objects->objects.size());
+    for (const auto & object : predicted_objects->objects) {
+      if (const auto path = utils::max_confidence_path(object)) {
+        objects.emplace_back(&object, path);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < points->size(); i++) {
+    const auto & point = points->at(i);
+    const rclcpp::Duration duration(point.time_from_start);
+    float min_ttc = max_value;
+    for (const auto & [object, path] : objects) {
+      const float object_ttc = utils::time_to_collision(point, duration, *object, *path, max_value);
+      if (std::isfinite(object_ttc) && object_ttc >= 0.0f) {
+        min_ttc = std::min(min_ttc, object_ttc);
+      }
+    }
+    ttc.at(i) = std::min(1.0f, min_ttc / max_value);
   }
 
-  result->set_metric(index(), ttc);
+  result->set_metric(index(), std::move(ttc));
 }
 
 }  // namespace autoware::trajectory_ranker::metrics
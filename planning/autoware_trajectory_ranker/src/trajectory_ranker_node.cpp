@@ -44,6 +44,7 @@ TrajectoryRanker::TrajectoryRanker(const rclcpp::NodeOptions & options)
     vehicle_info_utils::VehicleInfoUtils(*this).getVehicleInfo());
 
   evaluator_ = std::make_shared<Evaluator>(route_handler_, vehicle_info, get_logger(), this);
+  evaluator_->set_num_threads(static_cast<size_t>(listener_->get_params().num_threads));
 
   const auto metrics = listener_->get_params().metrics;
   for (size_t i = 0; i < metrics.name.size(); i++) {
@@ -26,8 +26,10 @@
 #include <gtest/gtest.h>
 #include <lanelet2_core/LaneletMap.h>
 
+#include <cmath>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::trajectory_ranker
@@ -239,6 +241,76 @@ TEST_F(TestEvaluator, MultipleMetricsEvaluation)
   EXPECT_GT(results.size(), 0);
 }
 
+TEST_F(TestEvaluator, ParallelEvaluationMatchesSerial)
+{
+  const std::vector<std::string> metrics{
+    "autoware::trajectory_ranker::metrics::LateralAcceleration",
+    "autoware::trajectory_ranker::metrics::LongitudinalJerk",
+    "autoware::trajectory_ranker::metrics::TravelDistance",
+    "autoware::trajectory_ranker::metrics::TimeToCollision"};
+
+  // objects crossing the candidates
+  auto objects = std::make_shared<PredictedObjects>();
+  for (size_t i = 0; i < 30; ++i) {
+    autoware_perception_msgs::msg::PredictedObject object;
+    object.kinematics.initial_pose_with_covariance.pose.position.x = static_cast<double>(i);
+    object.kinematics.initial_pose_with_covariance.pose.position.y = 10.0;
+    autoware_perception_msgs::msg::PredictedPath path;
+    path.confidence = 1.0;
+    path.time_step = rclcpp::Duration::from_seconds(0.5);
+    for (size_t j = 0; j < 20; ++j) {
+      Pose pose;
+      pose.position.x = static_cast<double>(i);
+      pose.position.y = 10.0 - static_cast<double>(j);
+      pose.orientation.z = -std::sqrt(0.5);
+      pose.orientation.w = std::sqrt(0.5);
+      path.path.push_back(pose);
+    }
+    object.kinematics.predicted_paths.push_back(path);
+    objects->objects.push_back(object);
+  }
+
+  const auto evaluate = [&](const size_t num_threads) {
+    Evaluator evaluator(route_handler_, vehicle_info_, node_->get_logger());
+    evaluator.set_num_threads(num_threads);
+    for (size_t i = 0; i < metrics.size(); ++i) {
+      evaluator.load_metric(metrics.at(i), i, 0.5);
+    }
+    for (size_t i = 0; i < 200; ++i) {
+      auto core_data = createCoreData("trajectory_" + std::to_string(i), 0.05 * i);
+      for (size_t j = 0; j < core_data->points->size(); ++j) {
+        auto & point = core_data->points->at(j);
+        point.longitudinal_velocity_mps = 2.0 + 0.01 * static_cast<double>(i * j);
+        point.lateral_velocity_mps = 0.1 * std::sin(0.1 * static_cast<double>(i + j));
+      }
+      core_data->objects = objects;
+      evaluator.add(core_data);
+    }
+    evaluator.setup(sample_points_);
+
+    auto params = std::make_shared<EvaluatorParameters>(metrics.size(), 10);
+    params->time_decay_weight.assign(metrics.size(), std::vector<float>(10, 1.0f));
+    params->metrics_max_value = {5.0, 10.0, 50.0, 6.0};
+    params->score_weight = {0.1, 0.1, 0.3, 0.6};
+
+    evaluator.best(params);
+
+    std::vector<std::pair<std::string, float>> totals;
+    for (const auto & result : evaluator.results()) {
+      totals.emplace_back(result->tag(), result->total());
+    }
+    return totals;
+  };
+
+  const auto serial = evaluate(1);
+  const auto parallel = evaluate(4);
+  ASSERT_EQ(serial.size(), parallel.size());
+  for (size_t i = 0; i < serial.size(); ++i) {
+    EXPECT_EQ(serial.at(i).first, parallel.at(i).first);
+    EXPECT_FLOAT_EQ(serial.at(i).second, parallel.at(i).second);
+  }
+}
+
 }  // namespace autoware::trajectory_ranker
 
 int main(int argc, char ** argv)
@@ -107,9 +107,14 @@ bool path_footprint_exceeds_target_lane_bound(
   const CommonDataPtr & common_data_ptr, const PathWithLaneId & path, const VehicleInfo & ego_info,
   const double margin = 0.1);
 
+/**
+ * @brief Generate the drivable lanes spanning the current lanes and the lane change lanes.
+ * @param lanelet_query_cache if given, the neighbor lanelets are looked up in this cache.
+ */
 std::vector<DrivableLanes> generateDrivableLanes(
   const RouteHandler & route_handler, const lanelet::ConstLanelets & current_lanes,
-  const lanelet::ConstLanelets & lane_change_lanes);
+  const lanelet::ConstLanelets & lane_change_lanes,
+  const std::shared_ptr<LaneletQueryCache> & lanelet_query_cache = nullptr);
 
 double getLateralShift(const LaneChangePath & path);
 
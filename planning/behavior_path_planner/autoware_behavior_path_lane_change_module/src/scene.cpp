@@ -519,7 +519,8 @@ void NormalLaneChange::extendOutputDrivableArea(BehaviorModuleOutput & output) c
   const auto & dp = planner_data_->drivable_area_expansion_parameters;
 
   const auto drivable_lanes = utils::lane_change::generateDrivableLanes(
-    *getRouteHandler(), get_current_lanes(), get_target_lanes());
+    *getRouteHandler(), get_current_lanes(), get_target_lanes(),
+    planner_data_->lanelet_query_cache);
   const auto shorten_lanes = utils::cutOverlappedLanes(output.path, drivable_lanes);
   const auto expanded_lanes = utils::expandLanelets(
     shorten_lanes, dp.drivable_area_left_bound_offset, dp.drivable_area_right_bound_offset,
@@ -1586,9 +1587,11 @@ bool NormalLaneChange::isValidPath(const PathWithLaneId & path) const
   const auto & dp = planner_data_->drivable_area_expansion_parameters;
 
   // check lane departure
+  const auto & lanelet_query_cache = planner_data_->lanelet_query_cache;
   const auto drivable_lanes = utils::lane_change::generateDrivableLanes(
-    *route_handler, utils::extendLanes(route_handler, get_current_lanes()),
-    utils::extendLanes(route_handler, get_target_lanes()));
+    *route_handler, utils::extendLanes(route_handler, get_current_lanes(), lanelet_query_cache),
+    utils::extendLanes(route_handler, get_target_lanes(), lanelet_query_cache),
+    lanelet_query_cache);
   const auto expanded_lanes = utils::expandLanelets(
     drivable_lanes, dp.drivable_area_left_bound_offset, dp.drivable_area_right_bound_offset,
     dp.drivable_area_types_to_skip);
@@ -190,7 +190,8 @@ bool path_footprint_exceeds_target_lane_bound(
 
 std::vector<DrivableLanes> generateDrivableLanes(
   const RouteHandler & route_handler, const lanelet::ConstLanelets & current_lanes,
-  const lanelet::ConstLanelets & lane_change_lanes)
+  const lanelet::ConstLanelets & lane_change_lanes,
+  const std::shared_ptr<LaneletQueryCache> & lanelet_query_cache)
 {
   size_t current_lc_idx = 0;
   std::vector<DrivableLanes> drivable_lanes(current_lanes.size());
@@ -199,8 +200,14 @@ std::vector<DrivableLanes> generateDrivableLanes(
     drivable_lanes.at(i).left_lane = current_lane;
     drivable_lanes.at(i).right_lane = current_lane;
 
-    const auto left_lane = route_handler.getLeftLanelet(current_lane, false, false);
-    const auto right_lane = route_handler.getRightLanelet(current_lane, false, false);
+    const auto left_lane =
+      lanelet_query_cache
+        ? lanelet_query_cache->getLeftLanelet(route_handler, current_lane, false)
+        : route_handler.getLeftLanelet(current_lane, false, false);
+    const auto right_lane =
+      lanelet_query_cache
+        ? lanelet_query_cache->getRightLanelet(route_handler, current_lane, false)
+        : route_handler.getRightLanelet(current_lane, false, false);
     if (!left_lane && !right_lane) {
       continue;
     }
@@ -398,6 +398,7 @@ void BehaviorPathPlannerNode::run()
   // update map
   if (map_ptr) {
     planner_data_->route_handler->setMap(*map_ptr);
+    planner_data_->lanelet_query_cache->clear();
   }
 
   std::unique_lock<std::mutex> lk_manager(mutex_manager_);  // for planner_manager_
@@ -406,6 +407,7 @@ void BehaviorPathPlannerNode::run()
   const bool is_first_time = !(planner_data_->route_handler->isHandlerReady());
   if (route_ptr) {
     planner_data_->route_handler->setRoute(*route_ptr);
+    planner_data_->lanelet_query_cache->clear();
     // uuid is not changed when rerouting with modified goal,
     // in this case do not need to reset modules.
     const bool has_same_route_id =
@@ -487,6 +489,12 @@ void BehaviorPathPlannerNode::run()
 
   planner_data_->prev_route_id = planner_data_->route_handler->getRouteUuid();
 
+  const auto lanelet_query_statistics = planner_data_->lanelet_query_cache->getStatistics();
+  RCLCPP_DEBUG_THROTTLE(
+    get_logger(), *get_clock(), 5000, "lanelet query cache: hit rate %.3f (hits %zu, misses %zu)",
+    lanelet_query_statistics.hit_rate(), lanelet_query_statistics.hits,
+    lanelet_query_statistics.misses);
+
   lk_pd.unlock();  // release planner_data_
 
   planner_manager_->print();
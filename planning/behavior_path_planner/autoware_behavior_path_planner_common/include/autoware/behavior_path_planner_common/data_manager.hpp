@@ -18,6 +18,8 @@
 #include "autoware/behavior_path_planner_common/parameters.hpp"
 #include "autoware/behavior_path_planner_common/turn_signal_decider.hpp"
 #include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/parameters.hpp"
+#include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/types.hpp"
+#include "autoware/behavior_path_planner_common/utils/lanelet_query_cache.hpp"
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 
 #include <autoware/lanelet2_utils/geometry.hpp>
@@ -171,6 +173,9 @@ struct PlannerData
   std::optional<PoseWithUuidStamped> prev_modified_goal{};
   std::optional<UUID> prev_route_id{};
   std::shared_ptr<RouteHandler> route_handler{std::make_shared<RouteHandler>()};
+  // shared by all the copies of the planner data, cleared when the map or route is updated
+  std::shared_ptr<utils::LaneletQueryCache> lanelet_query_cache{
+    std::make_shared<utils::LaneletQueryCache>()};
   std::map<int64_t, TrafficSignalStamped> traffic_light_id_map;
   BehaviorPathPlannerParameters parameters{};
   autoware::behavior_path_planner::drivable_area_expansion::DrivableAreaExpansionParameters
@@ -179,6 +184,9 @@ struct PlannerData
 
   mutable std::vector<geometry_msgs::msg::Pose> drivable_area_expansion_prev_path_poses{};
   mutable std::vector<double> drivable_area_expansion_prev_curvatures{};
+  // shared by all the copies of the planner data
+  std::shared_ptr<drivable_area_expansion::ExpansionCache> drivable_area_expansion_cache{
+    std::make_shared<drivable_area_expansion::ExpansionCache>()};
   mutable TurnSignalDecider turn_signal_decider;
 
   void init_parameters(rclcpp::Node & node)
@@ -33,6 +33,19 @@ SegmentRtree extract_uncrossable_segments(
   const lanelet::LaneletMap & lanelet_map, const Point & ego_point,
   const DrivableAreaExpansionParameters & params);
 
+/// @brief Extract uncrossable segments from the lanelet map that are in range of ego
+/// @details the uncrossable segments of the whole map are cached and only rebuilt when the map or
+/// the uncrossable linestring types change. The segments in range of ego are then retrieved with a
+/// rtree query. Can be called concurrently with the same cache.
+/// @param[inout] cache cache reused between calls
+/// @param[in] lanelet_map_ptr lanelet map
+/// @param[in] ego_point point of the current ego position
+/// @param[in] params parameters with linestring types that cannot be crossed and maximum range
+/// @return the uncrossable segments stored in a rtree
+SegmentRtree extract_uncrossable_segments(
+  ExpansionCache & cache, const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const Point & ego_point, const DrivableAreaExpansionParameters & params);
+
 /// @brief Determine if the given linestring has one of the given types
 /// @param[in] ls linestring to check
 /// @param[in] types type strings to check
@@ -24,7 +24,11 @@
 
 #include <boost/geometry/index/rtree.hpp>
 
-#include <optional>
+#include <lanelet2_core/Forward.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 namespace autoware::behavior_path_planner::drivable_area_expansion
@@ -70,5 +74,16 @@ struct Expansion
   std::vector<PointDistance> right_projections;
   std::vector<double> min_lane_widths;
 };
+/// @brief data reused from one iteration of the drivable area expansion to the next
+/// @details shared by all the copies of the planner data, the members must only be accessed with
+/// the mutex locked
+struct ExpansionCache
+{
+  std::mutex mutex;
+  // uncrossable segments of the whole map, rebuilt when the map or the uncrossable types change
+  lanelet::LaneletMapConstPtr map{};
+  std::vector<std::string> uncrossable_types{};
+  std::shared_ptr<const SegmentRtree> map_uncrossable_segments{};
+};
 }  // namespace autoware::behavior_path_planner::drivable_area_expansion
 #endif  // AUTOWARE__BEHAVIOR_PATH_PLANNER_COMMON__UTILS__DRIVABLE_AREA_EXPANSION__TYPES_HPP_
@@ -0,0 +1,148 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef AUTOWARE__BEHAVIOR_PATH_PLANNER_COMMON__UTILS__LANELET_QUERY_CACHE_HPP_
+#define AUTOWARE__BEHAVIOR_PATH_PLANNER_COMMON__UTILS__LANELET_QUERY_CACHE_HPP_
+
+#include <autoware/route_handler/route_handler.hpp>
+
+#include <lanelet2_core/Forward.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace autoware::behavior_path_planner::utils
+{
+using autoware::route_handler::RouteHandler;
+
+/**
+ * @brief Memoization of the lanelet queries that only depend on the lanelet map.
+ *
+ * The same queries (next/previous lanelets, neighbors, lengths) are repeated every cycle by the
+ * modules with the same lanelets. The results are kept per lanelet id and direction (an inverted
+ * lanelet has other following, preceding and neighbor lanelets) until the map changes: the
+ * cache is cleared automatically when the map of the given route handler is different from the
+ * one of the cached results, and the owner clears it explicitly when a new map is set.
+ * The number of entries is bounded by the number of lanelets of the map.
+ *
+ * The neighbors are the ones of RouteHandler::getLeftLanelet and RouteHandler::getRightLanelet
+ * with enable_same_root=false only: with enable_same_root=true, the result depends on the route
+ * and is not cached.
+ *
+ * All functions are thread-safe.
+ */
+class LaneletQueryCache
+{
+public:
+  struct Statistics
+  {
+    size_t hits{0};
+    size_t misses{0};
+
+    [[nodiscard]] double hit_rate() const
+    {
+      const auto total = hits + misses;
+      return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+    }
+  };
+
+  /**
+   * @brief Same as RouteHandler::getNextLanelets.
+   */
+  lanelet::ConstLanelets getNextLanelets(
+    const RouteHandler & route_handler, const lanelet::ConstLanelet & lanelet);
+
+  /**
+   * @brief Same as RouteHandler::getPreviousLanelets.
+   */
+  lanelet::ConstLanelets getPreviousLanelets(
+    const RouteHandler & route_handler, const lanelet::ConstLanelet & lanelet);
+
+  /**
+   * @brief Same as RouteHandler::getLeftLanelet with enable_same_root=false.
+   */
+  std::optional<lanelet::ConstLanelet> getLeftLanelet(
+    const RouteHandler & route_handler, const lanelet::ConstLanelet & lanelet,
+    const bool get_shoulder_lane);
+
+  /**
+   * @brief Same as RouteHandler::getRightLanelet with enable_same_root=false.
+   */
+  std::optional<lanelet::ConstLanelet> getRightLanelet(
+    const RouteHandler & route_handler, const lanelet::ConstLanelet & lanelet,
+    const bool get_shoulder_lane);
+
+  /**
+   * @brief 2D length of the lanelet centerline, same as lanelet::geometry::length2d.
+   */
+  double getLaneletLength2d(
+    const RouteHandler & route_handler, const lanelet::ConstLanelet & lanelet);
+
+  /**
+   * @brief 3D length of the lanelet centerline, same as lanelet::geometry::length3d.
+   */
+  double getLaneletLength3d(
+    const RouteHandler & route_handler, const lanelet::ConstLanelet & lanelet);
+
+  /**
+   * @brief Remove all the cached results (the statistics are kept).
+   */
+  void clear();
+
+  /**
+   * @brief Number of queries answered from the cache and computed since the construction.
+   */
+  [[nodiscard]] Statistics getStatistics() const;
+
+private:
+  using LaneletKey = std::pair<lanelet::Id, bool>;          // id, inverted
+  using NeighborKey = std::tuple<lanelet::Id, bool, bool>;  // id, inverted, shoulder lane
+
+  /**
+   * @brief Clear the results if they were computed with another map. Must be called with the
+   * mutex locked.
+   */
+  void invalidateIfMapChanged(const RouteHandler & route_handler);
+
+  void clearResults();
+
+  /**
+   * @brief Return the cached value of the key, or compute and cache it.
+   */
+  template <class Map, class Compute>
+  typename Map::mapped_type getOrCompute(
+    const RouteHandler & route_handler, Map & cache, const typename Map::key_type & key,
+    const Compute & compute);
+
+  mutable std::mutex mutex_;
+  const lanelet::LaneletMap * lanelet_map_{nullptr};
+  std::map<LaneletKey, lanelet::ConstLanelets> next_lanelets_;
+  std::map<LaneletKey, lanelet::ConstLanelets> previous_lanelets_;
+  std::map<NeighborKey, std::optional<lanelet::ConstLanelet>> left_lanelets_;
+  std::map<NeighborKey, std::optional<lanelet::ConstLanelet>> right_lanelets_;
+  std::unordered_map<lanelet::Id, double> lengths_2d_;
+  std::unordered_map<lanelet::Id, double> lengths_3d_;
+
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
+};
+}  // namespace autoware::behavior_path_planner::utils
+
+#endif  // AUTOWARE__BEHAVIOR_PATH_PLANNER_COMMON__UTILS__LANELET_QUERY_CACHE_HPP_
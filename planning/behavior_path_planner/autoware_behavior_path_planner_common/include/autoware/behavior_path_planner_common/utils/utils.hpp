@@ -433,16 +433,27 @@ lanelet::ConstLanelets getCurrentLanes(const std::shared_ptr<const PlannerData>
 lanelet::ConstLanelets getCurrentLanesFromPath(
   const PathWithLaneId & path, const std::shared_ptr<const PlannerData> & planner_data);
 
+/**
+ * @brief Append the next lanelet (preferably in the route) to the lanes.
+ * @param lanelet_query_cache if given, the next lanelets are looked up in this cache.
+ */
 lanelet::ConstLanelets extendNextLane(
   const std::shared_ptr<RouteHandler> route_handler, const lanelet::ConstLanelets & lanes,
-  const bool only_in_route = false);
+  const bool only_in_route = false,
+  const std::shared_ptr<LaneletQueryCache> & lanelet_query_cache = nullptr);
 
+/**
+ * @brief Prepend the previous lanelet (preferably in the route) to the lanes.
+ * @param lanelet_query_cache if given, the previous lanelets are looked up in this cache.
+ */
 lanelet::ConstLanelets extendPrevLane(
   const std::shared_ptr<RouteHandler> route_handler, const lanelet::ConstLanelets & lanes,
-  const bool only_in_route = false);
+  const bool only_in_route = false,
+  const std::shared_ptr<LaneletQueryCache> & lanelet_query_cache = nullptr);
 
 lanelet::ConstLanelets extendLanes(
-  const std::shared_ptr<RouteHandler> route_handler, const lanelet::ConstLanelets & lanes);
+  const std::shared_ptr<RouteHandler> route_handler, const lanelet::ConstLanelets & lanes,
+  const std::shared_ptr<LaneletQueryCache> & lanelet_query_cache = nullptr);
 
 /**
  * @brief Retrieves sequences of preceding lanelets from the target lanes.
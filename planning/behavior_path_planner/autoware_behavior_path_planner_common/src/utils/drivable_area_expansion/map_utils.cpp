@@ -17,12 +17,16 @@
 #include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/parameters.hpp"
 
 #include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/index/predicates.hpp>
 #include <boost/geometry/strategies/strategies.hpp>
 
 #include <lanelet2_core/Attribute.h>
 #include <lanelet2_core/primitives/LineString.h>
 
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 namespace autoware::behavior_path_planner::drivable_area_expansion
@@ -49,6 +53,51 @@ SegmentRtree extract_uncrossable_segments(
   return uncrossable_segments_in_range;
 }
 
+SegmentRtree extract_uncrossable_segments(
+  ExpansionCache & cache, const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const Point & ego_point, const DrivableAreaExpansionParameters & params)
+{
+  std::vector<std::string> uncrossable_types;
+  for (const auto & t : params.avoid_linestring_types)
+    uncrossable_types.push_back(t.type + "." + t.subtype.value_or("*"));
+  std::shared_ptr<const SegmentRtree> map_uncrossable_segments;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (
+      !cache.map_uncrossable_segments || cache.map != lanelet_map_ptr ||
+      cache.uncrossable_types != uncrossable_types) {
+      cache.map = lanelet_map_ptr;
+      cache.uncrossable_types = uncrossable_types;
+      std::vector<Segment2d> segments;
+      LineString2d line;
+      for (const auto & ls : lanelet_map_ptr->lineStringLayer) {
+        if (has_types(ls, params.avoid_linestring_types)) {
+          line.clear();
+          for (const auto & p : ls) line.push_back(Point2d{p.x(), p.y()});
+          for (auto segment_idx = 0LU; segment_idx + 1 < line.size(); ++segment_idx)
+            segments.emplace_back(line[segment_idx], line[segment_idx + 1]);
+        }
+      }
+      cache.map_uncrossable_segments = std::make_shared<const SegmentRtree>(segments);
+    }
+    // the rtree is never modified once built, it can be queried without the lock
+    map_uncrossable_segments = cache.map_uncrossable_segments;
+  }
+
+  const auto ego_p = Point2d{ego_point.x, ego_point.y};
+  const auto range = params.max_path_arc_length;
+  const autoware_utils::Box2d range_box{
+    {ego_p.x() - range, ego_p.y() - range}, {ego_p.x() + range, ego_p.y() + range}};
+  std::vector<Segment2d> segments_in_range;
+  map_uncrossable_segments->query(
+    boost::geometry::index::intersects(range_box) &&
+      boost::geometry::index::satisfies([&](const Segment2d & segment) {
+        return boost::geometry::distance(segment, ego_p) < range;
+      }),
+    std::back_inserter(segments_in_range));
+  return SegmentRtree(segments_in_range);
+}
+
 bool has_types(
   const lanelet::ConstLineString3d & ls,
   const std::vector<DrivableAreaExpansionParameters::LinestringType> & types)
@@ -1537,7 +1537,8 @@ std::vector<geometry_msgs::msg::Point> postProcess(
   lanelet::ConstLanelet goal_lanelet;
   if (route_handler->getGoalLanelet(&goal_lanelet) && checkHasSameLane(lanelets, goal_lanelet)) {
     const auto lanes_after_goal = route_handler->getLanesAfterGoal(vehicle_length);
-    const auto next_lanes_after_goal = route_handler->getNextLanelets(goal_lanelet);
+    const auto next_lanes_after_goal =
+      planner_data->lanelet_query_cache->getNextLanelets(*route_handler, goal_lanelet);
     const auto goal_left_lanelet = route_handler->getLeftLanelet(goal_lanelet);
     const auto goal_right_lanelet = route_handler->getRightLanelet(goal_lanelet);
     lanelet::ConstLanelets goal_lanelets = {goal_lanelet};
@@ -0,0 +1,124 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_path_planner_common/utils/lanelet_query_cache.hpp"
+
+#include <lanelet2_core/geometry/Lanelet.h>
+
+#include <mutex>
+#include <optional>
+
+namespace autoware::behavior_path_planner::utils
+{
+void LaneletQueryCache::invalidateIfMapChanged(const RouteHandler & route_handler)
+{
+  const auto * lanelet_map = route_handler.getLaneletMapPtr().get();
+  if (lanelet_map == lanelet_map_) {
+    return;
+  }
+  clearResults();
+  lanelet_map_ = lanelet_map;
+}
+
+void LaneletQueryCache::clearResults()
+{
+  next_lanelets_.clear();
+  previous_lanelets_.clear();
+  left_lanelets_.clear();
+  right_lanelets_.clear();
+  lengths_2d_.clear();
+  lengths_3d_.clear();
+}
+
+template <class Map, class Compute>
+typename Map::mapped_type LaneletQueryCache::getOrCompute(
+  const RouteHandler & route_handler, Map & cache, const typename Map::key_type & key,
+  const Compute & compute)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  invalidateIfMapChanged(route_handler);
+  if (const auto itr = cache.find(key); itr != cache.end()) {
+    ++hits_;
+    return itr->second;
+  }
+  ++misses_;
+  return cache.emplace(key, compute()).first->second;
+}
+
+lanelet::ConstLanelets LaneletQueryCache::getNextLanelets(
+  const RouteHandler & route_handler, const lanelet::ConstLanelet & lanelet)
+{
+  const LaneletKey key{lanelet.id(), lanelet.inverted()};
+  return getOrCompute(route_handler, next_lanelets_, key, [&]() {
+    return route_handler.getNextLanelets(lanelet);
+  });
+}
+
+lanelet::ConstLanelets LaneletQueryCache::getPreviousLanelets(
+  const RouteHandler & route_handler, const lanelet::ConstLanelet & lanelet)
+{
+  const LaneletKey key{lanelet.id(), lanelet.inverted()};
+  return getOrCompute(route_handler, previous_lanelets_, key, [&]() {
+    return route_handler.getPreviousLanelets(lanelet);
+  });
+}
+
+std::optional<lanelet::ConstLanelet> LaneletQueryCache::getLeftLanelet(
+  const RouteHandler & route_handler, const lanelet::ConstLanelet & lanelet,
+  const bool get_shoulder_lane)
+{
+  const NeighborKey key{lanelet.id(), lanelet.inverted(), get_shoulder_lane};
+  return getOrCompute(route_handler, left_lanelets_, key, [&]() {
+    return route_handler.getLeftLanelet(lanelet, false, get_shoulder_lane);
+  });
+}
+
+std::optional<lanelet::ConstLanelet> LaneletQueryCache::getRightLanelet(
+  const RouteHandler & route_handler, const lanelet::ConstLanelet & lanelet,
+  const bool get_shoulder_lane)
+{
+  const NeighborKey key{lanelet.id(), lanelet.inverted(), get_shoulder_lane};
+  return getOrCompute(route_handler, right_lanelets_, key, [&]() {
+    return route_handler.getRightLanelet(lanelet, false, get_shoulder_lane);
+  });
+}
+
+double LaneletQueryCache::getLaneletLength2d(
+  const RouteHandler & route_handler, const lanelet::ConstLanelet & lanelet)
+{
+  return getOrCompute(route_handler, lengths_2d_, lanelet.id(), [&]() {
+    return static_cast<double>(lanelet::geometry::length2d(lanelet));
+  });
+}
+
+double LaneletQueryCache::getLaneletLength3d(
+  const RouteHandler & route_handler, const lanelet::ConstLanelet & lanelet)
+{
+  return getOrCompute(route_handler, lengths_3d_, lanelet.id(), [&]() {
+    return static_cast<double>(lanelet::geometry::length3d(lanelet));
+  });
+}
+
+void LaneletQueryCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  clearResults();
+  lanelet_map_ = nullptr;
+}
+
+LaneletQueryCache::Statistics LaneletQueryCache::getStatistics() const
+{
+  return Statistics{hits_.load(), misses_.load()};
+}
+}  // namespace autoware::behavior_path_planner::utils
@@ -1357,7 +1357,8 @@ lanelet::ConstLanelets getCurrentLanesFromPath(
   auto extended_lanes = current_lanes;
   while (rclcpp::ok()) {
     const size_t pre_extension_size = extended_lanes.size();  // Get existing size before extension
-    extended_lanes = extendPrevLane(route_handler, extended_lanes, true);
+    extended_lanes =
+      extendPrevLane(route_handler, extended_lanes, true, planner_data->lanelet_query_cache);
     if (extended_lanes.size() == pre_extension_size) break;
     if (have_front_lanes(extended_lanes)) {
       current_lanes = extended_lanes;
@@ -1370,11 +1371,13 @@ lanelet::ConstLanelets getCurrentLanesFromPath(
 
 lanelet::ConstLanelets extendNextLane(
   const std::shared_ptr<RouteHandler> route_handler, const lanelet::ConstLanelets & lanes,
-  const bool only_in_route)
+  const bool only_in_route, const std::shared_ptr<LaneletQueryCache> & lanelet_query_cache)
 {
   if (lanes.empty()) return lanes;
 
-  const auto next_lanes = route_handler->getNextLanelets(lanes.back());
+  const auto next_lanes =
+    lanelet_query_cache ? lanelet_query_cache->getNextLanelets(*route_handler, lanes.back())
+                        : route_handler->getNextLanelets(lanes.back());
   if (next_lanes.empty()) return lanes;
 
   // Add next lane
@@ -1399,11 +1402,13 @@ lanelet::ConstLanelets extendNextLane(
 
 lanelet::ConstLanelets extendPrevLane(
   const std::shared_ptr<RouteHandler> route_handler, const lanelet::ConstLanelets & lanes,
-  const bool only_in_route)
+  const bool only_in_route, const std::shared_ptr<LaneletQueryCache> & lanelet_query_cache)
 {
   if (lanes.empty()) return lanes;
 
-  const auto prev_lanes = route_handler->getPreviousLanelets(lanes.front());
+  const auto prev_lanes =
+    lanelet_query_cache ? lanelet_query_cache->getPreviousLanelets(*route_handler, lanes.front())
+                        : route_handler->getPreviousLanelets(lanes.front());
   if (prev_lanes.empty()) return lanes;
 
   // Add previous lane
@@ -1427,10 +1432,11 @@ lanelet::ConstLanelets extendPrevLane(
 }
 
 lanelet::ConstLanelets extendLanes(
-  const std::shared_ptr<RouteHandler> route_handler, const lanelet::ConstLanelets & lanes)
+  const std::shared_ptr<RouteHandler> route_handler, const lanelet::ConstLanelets & lanes,
+  const std::shared_ptr<LaneletQueryCache> & lanelet_query_cache)
 {
-  auto extended_lanes = extendNextLane(route_handler, lanes);
-  extended_lanes = extendPrevLane(route_handler, extended_lanes);
+  auto extended_lanes = extendNextLane(route_handler, lanes, false, lanelet_query_cache);
+  extended_lanes = extendPrevLane(route_handler, extended_lanes, false, lanelet_query_cache);
 
   return extended_lanes;
 }
@@ -1447,7 +1453,8 @@ lanelet::ConstLanelets getExtendedCurrentLanes(
   double backward_length_sum = 0.0;
 
   while (backward_length_sum < backward_length) {
-    auto extended_lanes = extendPrevLane(planner_data->route_handler, lanes);
+    auto extended_lanes = extendPrevLane(
+      planner_data->route_handler, lanes, false, planner_data->lanelet_query_cache);
     if (extended_lanes.empty()) {
       return lanes;
     }
@@ -1459,7 +1466,8 @@ lanelet::ConstLanelets getExtendedCurrentLanes(
     }
 
     if (extended_lanes.size() > lanes.size()) {
-      backward_length_sum += lanelet::geometry::length2d(extended_lanes.front());
+      backward_length_sum += planner_data->lanelet_query_cache->getLaneletLength2d(
+        *planner_data->route_handler, extended_lanes.front());
     } else {
       break;  // no more previous lanes to add
     }
@@ -1467,7 +1475,8 @@ lanelet::ConstLanelets getExtendedCurrentLanes(
   }
 
   while (forward_length_sum < forward_length) {
-    auto extended_lanes = extendNextLane(planner_data->route_handler, lanes);
+    auto extended_lanes = extendNextLane(
+      planner_data->route_handler, lanes, false, planner_data->lanelet_query_cache);
     if (extended_lanes.empty()) {
       return lanes;
     }
@@ -1479,7 +1488,8 @@ lanelet::ConstLanelets getExtendedCurrentLanes(
     }
 
     if (extended_lanes.size() > lanes.size()) {
-      forward_length_sum += lanelet::geometry::length2d(extended_lanes.back());
+      forward_length_sum += planner_data->lanelet_query_cache->getLaneletLength2d(
+        *planner_data->route_handler, extended_lanes.back());
     } else {
       break;  // no more next lanes to add
     }
@@ -1502,7 +1512,8 @@ lanelet::ConstLanelets getExtendedCurrentLanes(
 lanelet::ConstLanelets getExtendedCurrentLanes(
   const std::shared_ptr<const PlannerData> & planner_data)
 {
-  return extendLanes(planner_data->route_handler, getCurrentLanes(planner_data));
+  return extendLanes(
+    planner_data->route_handler, getCurrentLanes(planner_data), planner_data->lanelet_query_cache);
 }
 
 lanelet::ConstLanelets getExtendedCurrentLanesFromPath(
@@ -1517,7 +1528,8 @@ lanelet::ConstLanelets getExtendedCurrentLanesFromPath(
   double backward_length_sum = 0.0;
 
   while (backward_length_sum < backward_length) {
-    auto extended_lanes = extendPrevLane(planner_data->route_handler, lanes);
+    auto extended_lanes = extendPrevLane(
+      planner_data->route_handler, lanes, false, planner_data->lanelet_query_cache);
     if (extended_lanes.empty()) {
       return lanes;
     }
@@ -1529,7 +1541,8 @@ lanelet::ConstLanelets getExtendedCurrentLanesFromPath(
     }
 
     if (extended_lanes.size() > lanes.size()) {
-      backward_length_sum += lanelet::geometry::length2d(extended_lanes.front());
+      backward_length_sum += planner_data->lanelet_query_cache->getLaneletLength2d(
+        *planner_data->route_handler, extended_lanes.front());
     } else {
       break;  // no more previous lanes to add
     }
@@ -1537,7 +1550,8 @@ lanelet::ConstLanelets getExtendedCurrentLanesFromPath(
   }
 
   while (forward_length_sum < forward_length) {
-    auto extended_lanes = extendNextLane(planner_data->route_handler, lanes);
+    auto extended_lanes = extendNextLane(
+      planner_data->route_handler, lanes, false, planner_data->lanelet_query_cache);
     if (extended_lanes.empty()) {
       return lanes;
     }
@@ -1549,7 +1563,8 @@ lanelet::ConstLanelets getExtendedCurrentLanesFromPath(
     }
 
     if (extended_lanes.size() > lanes.size()) {
-      forward_length_sum += lanelet::geometry::length2d(extended_lanes.back());
+      forward_length_sum += planner_data->lanelet_query_cache->getLaneletLength2d(
+        *planner_data->route_handler, extended_lanes.back());
     } else {
       break;  // no more next lanes to add
     }
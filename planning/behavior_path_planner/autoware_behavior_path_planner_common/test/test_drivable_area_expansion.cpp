@@ -14,6 +14,7 @@
 
 #include "autoware/behavior_path_planner_common/data_manager.hpp"
 #include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/drivable_area_expansion.hpp"
+#include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/map_utils.hpp"
 #include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/path_projection.hpp"
 #include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/types.hpp"
 
@@ -23,6 +24,9 @@
 #include <lanelet2_core/LaneletMap.h>
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 using autoware::behavior_path_planner::drivable_area_expansion::LineString2d;
 using autoware::behavior_path_planner::drivable_area_expansion::Point2d;
@@ -275,3 +279,53 @@ TEST(DrivableAreaExpansionProjection, expand_drivable_area)
     EXPECT_LT(p.y, -1.0);
   }
 }
+
+TEST(DrivableAreaExpansion, extract_uncrossable_segments_with_shared_cache)
+{
+  using autoware::behavior_path_planner::drivable_area_expansion::extract_uncrossable_segments;
+  using autoware::behavior_path_planner::drivable_area_expansion::Point;
+
+  // uncrossable road border at y = 3 and a crossable line at y = -3, along x = [0, 100]
+  lanelet::LaneletMapPtr lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
+  lanelet::Id id = 1;
+  for (const auto & [type, y] :
+       std::vector<std::pair<std::string, double>>{{"road_border", 3.0}, {"line_thin", -3.0}}) {
+    lanelet::Points3d points;
+    for (auto x = 0.0; x <= 100.0; x += 1.0) points.emplace_back(id++, x, y, 0.0);
+    lanelet_map_ptr->add(
+      lanelet::LineString3d(id++, points, lanelet::AttributeMap{{"type", type}}));
+  }
+
+  autoware::behavior_path_planner::drivable_area_expansion::DrivableAreaExpansionParameters params;
+  params.avoid_linestring_types = {
+    autoware::behavior_path_planner::drivable_area_expansion::DrivableAreaExpansionParameters::
+      LinestringType("road_border")};
+  params.max_path_arc_length = 10.0;
+
+  // the copies of the planner data share the cache
+  const autoware::behavior_path_planner::PlannerData planner_data;
+  const auto planner_data_copy = planner_data;
+  ASSERT_EQ(
+    planner_data_copy.drivable_area_expansion_cache, planner_data.drivable_area_expansion_cache);
+  auto & cache = *planner_data_copy.drivable_area_expansion_cache;
+
+  std::shared_ptr<const autoware::behavior_path_planner::drivable_area_expansion::SegmentRtree>
+    map_uncrossable_segments;
+  for (auto ego_x = 0.0; ego_x < 100.0; ego_x += 5.3) {
+    Point ego_point;
+    ego_point.x = ego_x;
+    const auto segments = extract_uncrossable_segments(cache, lanelet_map_ptr, ego_point, params);
+    const auto expected_segments =
+      extract_uncrossable_segments(*lanelet_map_ptr, ego_point, params);
+    ASSERT_EQ(segments.size(), expected_segments.size());
+    EXPECT_GT(segments.size(), 0ul);
+    for (const auto & segment : expected_segments) {
+      EXPECT_EQ(segments.count(segment), 1ul);
+    }
+    // the segments of the whole map are only extracted once
+    if (!map_uncrossable_segments) {
+      map_uncrossable_segments = cache.map_uncrossable_segments;
+    }
+    EXPECT_EQ(cache.map_uncrossable_segments, map_uncrossable_segments);
+  }
+}
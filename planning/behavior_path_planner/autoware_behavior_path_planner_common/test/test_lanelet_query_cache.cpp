@@ -0,0 +1,178 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_path_planner_common/utils/lanelet_query_cache.hpp"
+
+#include <autoware_test_utils/autoware_test_utils.hpp>
+#include <autoware_test_utils/mock_data_parser.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/Forward.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using autoware::behavior_path_planner::utils::LaneletQueryCache;
+using autoware::route_handler::RouteHandler;
+using autoware_planning_msgs::msg::LaneletRoute;
+
+class LaneletQueryCacheTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const auto test_data_file =
+      ament_index_cpp::get_package_share_directory("autoware_behavior_path_planner_common") +
+      "/test_data/test_traffic_light.yaml";
+    const auto config = YAML::LoadFile(test_data_file);
+    route_ = autoware::test_utils::parse<LaneletRoute>(config["route"]);
+    map_ = autoware::test_utils::make_map_bin_msg(
+      autoware::test_utils::get_absolute_path_to_lanelet_map(
+        "autoware_test_utils", "intersection/lanelet2_map.osm"));
+
+    route_handler_ = std::make_shared<RouteHandler>();
+    route_handler_->setMap(map_);
+    route_handler_->setRoute(route_);
+    for (const auto & segment : route_.segments) {
+      lanelets_.push_back(route_handler_->getLaneletsFromId(segment.preferred_primitive.id));
+    }
+  }
+
+  static lanelet::Ids toIds(const lanelet::ConstLanelets & lanelets)
+  {
+    lanelet::Ids ids;
+    for (const auto & lanelet : lanelets) {
+      ids.push_back(lanelet.id());
+    }
+    return ids;
+  }
+
+  static std::vector<bool> toDirections(const lanelet::ConstLanelets & lanelets)
+  {
+    std::vector<bool> inverted;
+    for (const auto & lanelet : lanelets) {
+      inverted.push_back(lanelet.inverted());
+    }
+    return inverted;
+  }
+
+  autoware_map_msgs::msg::LaneletMapBin map_;
+  LaneletRoute route_;
+  std::shared_ptr<RouteHandler> route_handler_;
+  lanelet::ConstLanelets lanelets_;
+};
+
+TEST_F(LaneletQueryCacheTest, sameResultAsRouteHandler)
+{
+  LaneletQueryCache cache;
+  ASSERT_FALSE(lanelets_.empty());
+
+  // the second pass is answered from the cache and must return the same results
+  for (size_t pass = 0; pass < 2; ++pass) {
+    for (const auto & lanelet : lanelets_) {
+      EXPECT_EQ(
+        toIds(cache.getNextLanelets(*route_handler_, lanelet)),
+        toIds(route_handler_->getNextLanelets(lanelet)));
+      EXPECT_EQ(
+        toIds(cache.getPreviousLanelets(*route_handler_, lanelet)),
+        toIds(route_handler_->getPreviousLanelets(lanelet)));
+
+      const auto left = cache.getLeftLanelet(*route_handler_, lanelet, false);
+      const auto expected_left = route_handler_->getLeftLanelet(lanelet, false, false);
+      ASSERT_EQ(left.has_value(), expected_left.has_value());
+      if (left) {
+        EXPECT_EQ(left->id(), expected_left->id());
+      }
+      const auto right = cache.getRightLanelet(*route_handler_, lanelet, false);
+      const auto expected_right = route_handler_->getRightLanelet(lanelet, false, false);
+      ASSERT_EQ(right.has_value(), expected_right.has_value());
+      if (right) {
+        EXPECT_EQ(right->id(), expected_right->id());
+      }
+
+      EXPECT_DOUBLE_EQ(
+        cache.getLaneletLength2d(*route_handler_, lanelet), lanelet::geometry::length2d(lanelet));
+      EXPECT_DOUBLE_EQ(
+        cache.getLaneletLength3d(*route_handler_, lanelet), lanelet::geometry::length3d(lanelet));
+    }
+  }
+
+  const auto statistics = cache.getStatistics();
+  EXPECT_EQ(statistics.misses, lanelets_.size() * 6);
+  EXPECT_EQ(statistics.hits, lanelets_.size() * 6);
+  EXPECT_DOUBLE_EQ(statistics.hit_rate(), 0.5);
+}
+
+TEST_F(LaneletQueryCacheTest, invalidation)
+{
+  LaneletQueryCache cache;
+  ASSERT_FALSE(lanelets_.empty());
+  const auto & lanelet = lanelets_.front();
+
+  cache.getNextLanelets(*route_handler_, lanelet);
+  cache.getNextLanelets(*route_handler_, lanelet);
+  EXPECT_EQ(cache.getStatistics().misses, 1u);
+  EXPECT_EQ(cache.getStatistics().hits, 1u);
+
+  // explicit clear
+  cache.clear();
+  cache.getNextLanelets(*route_handler_, lanelet);
+  EXPECT_EQ(cache.getStatistics().misses, 2u);
+
+  // a new map is detected without clearing the cache
+  route_handler_->setMap(map_);
+  const auto next_lanelets = cache.getNextLanelets(*route_handler_, lanelet);
+  EXPECT_EQ(cache.getStatistics().misses, 3u);
+  EXPECT_EQ(toIds(next_lanelets), toIds(route_handler_->getNextLanelets(lanelet)));
+}
+
+TEST_F(LaneletQueryCacheTest, invertedLanelets)
+{
+  LaneletQueryCache cache;
+  ASSERT_FALSE(lanelets_.empty());
+
+  // the lanelet and its inverted copy share the same id, the results of the one queried first
+  // must not be returned for the other
+  for (const auto & lanelet : lanelets_) {
+    for (const auto & query : {lanelet, lanelet.invert()}) {
+      const auto next_lanelets = cache.getNextLanelets(*route_handler_, query);
+      const auto expected_next_lanelets = route_handler_->getNextLanelets(query);
+      EXPECT_EQ(toIds(next_lanelets), toIds(expected_next_lanelets));
+      EXPECT_EQ(toDirections(next_lanelets), toDirections(expected_next_lanelets));
+      const auto previous_lanelets = cache.getPreviousLanelets(*route_handler_, query);
+      const auto expected_previous_lanelets = route_handler_->getPreviousLanelets(query);
+      EXPECT_EQ(toIds(previous_lanelets), toIds(expected_previous_lanelets));
+      EXPECT_EQ(toDirections(previous_lanelets), toDirections(expected_previous_lanelets));
+
+      const auto left = cache.getLeftLanelet(*route_handler_, query, false);
+      const auto expected_left = route_handler_->getLeftLanelet(query, false, false);
+      ASSERT_EQ(left.has_value(), expected_left.has_value());
+      if (left) {
+        EXPECT_EQ(left->id(), expected_left->id());
+        EXPECT_EQ(left->inverted(), expected_left->inverted());
+      }
+      const auto right = cache.getRightLanelet(*route_handler_, query, false);
+      const auto expected_right = route_handler_->getRightLanelet(query, false, false);
+      ASSERT_EQ(right.has_value(), expected_right.has_value());
+      if (right) {
+        EXPECT_EQ(right->id(), expected_right->id());
+        EXPECT_EQ(right->inverted(), expected_right->inverted());
+      }
+    }
+  }
+  EXPECT_EQ(cache.getStatistics().misses, lanelets_.size() * 8);
+  EXPECT_EQ(cache.getStatistics().hits, 0u);
+}
@@ -0,0 +1,67 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../test/object_path_footprint_index_scenario.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+using autoware::behavior_velocity_planner::ObjectPathFootprintIndex;
+using autoware::behavior_velocity_planner::footprint_index_scenario::calcOverlapsWithIndex;
+using autoware::behavior_velocity_planner::footprint_index_scenario::calcOverlapsWithoutIndex;
+using autoware::behavior_velocity_planner::footprint_index_scenario::createAttentionAreas;
+using autoware::behavior_velocity_planner::footprint_index_scenario::createPedestrians;
+
+int main()
+{
+  try {
+    constexpr auto nb_iterations = 10;
+    const auto attention_areas = createAttentionAreas();
+    std::printf("nb_crosswalks, nb_pedestrians, without_index_ns, with_index_ns, same_overlaps\n");
+    for (const auto nb_pedestrians : {25lu, 50lu, 100lu, 200lu}) {
+      const auto objects = createPedestrians(nb_pedestrians);
+      std::chrono::nanoseconds without_index_time{0};
+      std::chrono::nanoseconds with_index_time{0};
+      auto same_overlaps = true;
+      for (auto i = 0; i < nb_iterations; ++i) {
+        const auto without_index_start = std::chrono::steady_clock::now();
+        const auto expected = calcOverlapsWithoutIndex(*objects, attention_areas);
+        const auto without_index_end = std::chrono::steady_clock::now();
+        // a new index for each iteration, as the objects change at every planning cycle
+        ObjectPathFootprintIndex index;
+        const auto with_index_start = std::chrono::steady_clock::now();
+        const auto overlaps = calcOverlapsWithIndex(objects, attention_areas, index);
+        const auto with_index_end = std::chrono::steady_clock::now();
+        without_index_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+          without_index_end - without_index_start);
+        with_index_time +=
+          std::chrono::duration_cast<std::chrono::nanoseconds>(with_index_end - with_index_start);
+        same_overlaps &= overlaps == expected;
+      }
+      std::printf(
+        "%lu, %lu, %ld, %ld, %d\n", attention_areas.size(), nb_pedestrians,
+        without_index_time.count() / nb_iterations, with_index_time.count() / nb_iterations,
+        same_overlaps);
+    }
+  } catch (const std::exception & e) {
+    std::cerr << "Exception in main(): " << e.what() << std::endl;
+    return {};
+  } catch (...) {
+    std::cerr << "Unknown exception in main()" << std::endl;
+    return {};
+  }
+  return 0;
+}
@@ -0,0 +1,145 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__BEHAVIOR_VELOCITY_CROSSWALK_MODULE__OBJECT_PATH_FOOTPRINT_INDEX_HPP_
+#define AUTOWARE__BEHAVIOR_VELOCITY_CROSSWALK_MODULE__OBJECT_PATH_FOOTPRINT_INDEX_HPP_
+
+#include <autoware_utils/geometry/boost_geometry.hpp>
+#include <autoware_utils/geometry/geometry.hpp>
+
+#include <autoware_perception_msgs/msg/predicted_object.hpp>
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <geometry_msgs/msg/polygon.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+
+#include <lanelet2_core/primitives/Polygon.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+using autoware_utils::Box2d;
+using autoware_utils::Polygon2d;
+
+/**
+ * @brief Polygon with its precomputed envelope, to skip the exact geometry operations with the
+ * polygons that are far from it.
+ */
+struct PreparedPolygon
+{
+  PreparedPolygon() = default;
+  explicit PreparedPolygon(const Polygon2d & polygon);
+
+  Polygon2d polygon;
+  Box2d envelope;
+};
+
+/**
+ * @brief Footprints of an object along its predicted paths.
+ */
+struct ObjectPathFootprints
+{
+  struct Path
+  {
+    // footprint of the object at each point of the predicted path, same order as the path
+    std::vector<Polygon2d> polygons;
+    std::vector<Box2d> envelopes;
+    Box2d envelope;
+  };
+
+  std::vector<Path> paths;
+  // envelope of all the footprints of all the paths
+  Box2d envelope;
+};
+
+/**
+ * @brief Footprints of the predicted objects along their paths, shared by the crosswalk modules.
+ *
+ * The footprints only depend on the predicted objects, so they are computed once per object and
+ * reused by all the crosswalk modules until a new predicted objects message is set.
+ */
+class ObjectPathFootprintIndex
+{
+public:
+  /**
+   * @brief Clear the footprints if the objects are not the ones of the previous call.
+   */
+  void update(const autoware_perception_msgs::msg::PredictedObjects::ConstSharedPtr & objects);
+
+  /**
+   * @brief Return the footprints of the object, computed with the given object polygon (in the
+   * object frame) the first time the object is queried.
+   */
+  const ObjectPathFootprints & getFootprints(
+    const autoware_perception_msgs::msg::PredictedObject & object,
+    const geometry_msgs::msg::Polygon & object_polygon);
+
+private:
+  autoware_perception_msgs::msg::PredictedObjects::ConstSharedPtr objects_;
+  std::unordered_map<std::string, ObjectPathFootprints> footprints_;
+};
+
+/**
+ * @brief Create the footprint of the object polygon at the given pose.
+ */
+Polygon2d createFootprint(
+  const geometry_msgs::msg::Pose & pose, const geometry_msgs::msg::Polygon & object_polygon);
+
+/**
+ * @brief Append the points of the polygon placed at the given pose to the offset polygon.
+ */
+void offsetPolygon2d(
+  const geometry_msgs::msg::Pose & origin_point, const geometry_msgs::msg::Polygon & polygon,
+  Polygon2d & offset_polygon);
+
+/**
+ * @brief Create the convex hull of the polygon placed at the path points from start_idx to
+ * end_idx (included).
+ */
+template <class T>
+Polygon2d createMultiStepPolygon(
+  const T & obj_path_points, const geometry_msgs::msg::Polygon & polygon, const size_t start_idx,
+  const size_t end_idx)
+{
+  Polygon2d multi_step_polygon{};
+  for (size_t i = start_idx; i <= end_idx; ++i) {
+    offsetPolygon2d(autoware_utils::get_pose(obj_path_points.at(i)), polygon, multi_step_polygon);
+  }
+
+  Polygon2d hull_multi_step_polygon{};
+  boost::geometry::convex_hull(multi_step_polygon, hull_multi_step_polygon);
+  boost::geometry::correct(hull_multi_step_polygon);
+
+  return hull_multi_step_polygon;
+}
+
+/**
+ * @brief Calculate the axis-aligned bounding box of the lanelet polygon.
+ */
+Box2d calcEnvelope(const lanelet::BasicPolygon2d & polygon);
+
+/**
+ * @brief Return true if the polygons overlap, same as !bg::intersection(polygon, prepared).empty()
+ * but the intersection is only computed when the envelopes overlap.
+ */
+bool hasOverlap(
+  const Polygon2d & polygon, const Box2d & envelope, const PreparedPolygon & prepared);
+}  // namespace autoware::behavior_velocity_planner
+
+#endif  // AUTOWARE__BEHAVIOR_VELOCITY_CROSSWALK_MODULE__OBJECT_PATH_FOOTPRINT_INDEX_HPP_
@@ -219,7 +219,7 @@ void CrosswalkModuleManager::launchNewModules(const PathWithLaneId & path)
     registerModule(
       std::make_shared<CrosswalkModule>(
         node_, road_lanelet_id, crosswalk_lanelet_id, reg_elem_id, lanelet_map_ptr, p, logger,
-        clock_, time_keeper_, planning_factor_interface_));
+        clock_, time_keeper_, planning_factor_interface_, object_path_footprint_index_));
     generate_uuid(crosswalk_lanelet_id);
     const auto crosswalk_ll = lanelet_map_ptr->laneletLayer.get(crosswalk_lanelet_id);
     std::optional<bool> override_rtc_auto_mode;
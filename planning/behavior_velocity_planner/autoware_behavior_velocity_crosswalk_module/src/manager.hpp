@@ -55,6 +55,10 @@ public:
 private:
   CrosswalkModule::PlannerParam crosswalk_planner_param_{};
 
+  // footprints of the predicted objects, shared by all the crosswalk modules
+  std::shared_ptr<ObjectPathFootprintIndex> object_path_footprint_index_{
+    std::make_shared<ObjectPathFootprintIndex>()};
+
   void launchNewModules(const PathWithLaneId & path) override;
 
   std::function<bool(const std::shared_ptr<SceneModuleInterfaceWithRTC> &)>
@@ -0,0 +1,122 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_velocity_crosswalk_module/object_path_footprint_index.hpp"
+
+#include <autoware_utils/geometry/geometry.hpp>
+#include <autoware_utils_uuid/uuid_helper.hpp>
+
+#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+namespace bg = boost::geometry;
+
+PreparedPolygon::PreparedPolygon(const Polygon2d & polygon)
+: polygon(polygon), envelope(bg::return_envelope<Box2d>(polygon))
+{
+}
+
+void ObjectPathFootprintIndex::update(
+  const autoware_perception_msgs::msg::PredictedObjects::ConstSharedPtr & objects)
+{
+  if (objects == objects_) {
+    return;
+  }
+  objects_ = objects;
+  footprints_.clear();
+}
+
+const ObjectPathFootprints & ObjectPathFootprintIndex::getFootprints(
+  const autoware_perception_msgs::msg::PredictedObject & object,
+  const geometry_msgs::msg::Polygon & object_polygon)
+{
+  const auto [itr, inserted] =
+    footprints_.try_emplace(autoware_utils_uuid::to_hex_string(object.object_id));
+  auto & footprints = itr->second;
+  if (!inserted) {
+    return footprints;
+  }
+
+  bg::assign_inverse(footprints.envelope);
+  for (const auto & predicted_path : object.kinematics.predicted_paths) {
+    auto & path = footprints.paths.emplace_back();
+    bg::assign_inverse(path.envelope);
+    path.polygons.reserve(predicted_path.path.size());
+    path.envelopes.reserve(predicted_path.path.size());
+    for (const auto & pose : predicted_path.path) {
+      path.polygons.push_back(createFootprint(pose, object_polygon));
+      path.envelopes.push_back(bg::return_envelope<Box2d>(path.polygons.back()));
+      bg::expand(path.envelope, path.envelopes.back());
+    }
+    bg::expand(footprints.envelope, path.envelope);
+  }
+  return footprints;
+}
+
+Polygon2d createFootprint(
+  const geometry_msgs::msg::Pose & pose, const geometry_msgs::msg::Polygon & object_polygon)
+{
+  Polygon2d polygon;
+  for (const auto & polygon_point : object_polygon.points) {
+    const auto offset_pos =
+      autoware_utils::calc_offset_pose(pose, polygon_point.x, polygon_point.y, 0.0).position;
+    polygon.outer().emplace_back(offset_pos.x, offset_pos.y);
+  }
+
+  Polygon2d footprint;
+  bg::convex_hull(polygon, footprint);
+  bg::correct(footprint);
+  return footprint;
+}
+
+void offsetPolygon2d(
+  const geometry_msgs::msg::Pose & origin_point, const geometry_msgs::msg::Polygon & polygon,
+  Polygon2d & offset_polygon)
+{
+  for (const auto & polygon_point : polygon.points) {
+    const auto offset_pos =
+      autoware_utils::calc_offset_pose(origin_point, polygon_point.x, polygon_point.y, 0.0)
+        .position;
+    offset_polygon.outer().emplace_back(offset_pos.x, offset_pos.y);
+  }
+}
+
+Box2d calcEnvelope(const lanelet::BasicPolygon2d & polygon)
+{
+  Box2d envelope;
+  bg::assign_inverse(envelope);
+  for (const auto & p : polygon) {
+    bg::expand(envelope, autoware_utils::Point2d{p.x(), p.y()});
+  }
+  return envelope;
+}
+
+bool hasOverlap(const Polygon2d & polygon, const Box2d & envelope, const PreparedPolygon & prepared)
+{
+  if (bg::disjoint(envelope, prepared.envelope)) {
+    return false;
+  }
+  std::vector<Polygon2d> intersection_polygons;
+  bg::intersection(polygon, prepared.polygon, intersection_polygons);
+  return !intersection_polygons.empty();
+}
+}  // namespace autoware::behavior_velocity_planner
@@ -102,35 +102,6 @@ std::vector<geometry_msgs::msg::Point> toGeometryPointVector(
   return points;
 }
 
-void offsetPolygon2d(
-  const geometry_msgs::msg::Pose & origin_point, const geometry_msgs::msg::Polygon & polygon,
-  Polygon2d & offset_polygon)
-{
-  for (const auto & polygon_point : polygon.points) {
-    const auto offset_pos =
-      autoware_utils::calc_offset_pose(origin_point, polygon_point.x, polygon_point.y, 0.0)
-        .position;
-    offset_polygon.outer().emplace_back(offset_pos.x, offset_pos.y);
-  }
-}
-
-template <class T>
-Polygon2d createMultiStepPolygon(
-  const T & obj_path_points, const geometry_msgs::msg::Polygon & polygon, const size_t start_idx,
-  const size_t end_idx)
-{
-  Polygon2d multi_step_polygon{};
-  for (size_t i = start_idx; i <= end_idx; ++i) {
-    offsetPolygon2d(autoware_utils::get_pose(obj_path_points.at(i)), polygon, multi_step_polygon);
-  }
-
-  Polygon2d hull_multi_step_polygon{};
-  bg::convex_hull(multi_step_polygon, hull_multi_step_polygon);
-  bg::correct(hull_multi_step_polygon);
-
-  return hull_multi_step_polygon;
-}
-
 void sortCrosswalksByDistance(
   const PathWithLaneId & ego_path, const geometry_msgs::msg::Point & ego_pos,
   lanelet::ConstLanelets & crosswalks)
@@ -190,9 +161,11 @@ CrosswalkModule::CrosswalkModule(
   const rclcpp::Clock::SharedPtr clock,
   const std::shared_ptr<autoware_utils::TimeKeeper> time_keeper,
   const std::shared_ptr<planning_factor_interface::PlanningFactorInterface>
-    planning_factor_interface)
+    planning_factor_interface,
+  const std::shared_ptr<ObjectPathFootprintIndex> & object_path_footprint_index)
 : SceneModuleInterfaceWithRTC(module_id, logger, clock, time_keeper, planning_factor_interface),
   module_id_(module_id),
+  object_path_footprint_index_(object_path_footprint_index),
   planner_param_(planner_param),
   use_regulatory_element_(reg_elem_id)
 {
@@ -213,6 +186,9 @@ CrosswalkModule::CrosswalkModule(
 
   road_ = lanelet_map_ptr->laneletLayer.get(lane_id);
 
+  crosswalk_polygon_ = crosswalk_.polygon2d().basicPolygon();
+  crosswalk_envelope_ = calcEnvelope(crosswalk_polygon_);
+
   collision_info_pub_ = node.create_publisher<autoware_internal_debug_msgs::msg::StringStamped>(
     "~/debug/collision_info", 1);
 }
@@ -234,14 +210,14 @@ bool CrosswalkModule::modifyPathVelocity(PathWithLaneId * path)
 
   // Initialize debug data
   debug_data_ = DebugData(planner_data_);
-  for (const auto & p : crosswalk_.polygon2d().basicPolygon()) {
+  for (const auto & p : crosswalk_polygon_) {
     debug_data_.crosswalk_polygon.push_back(create_point(p.x(), p.y(), ego_pos.z));
   }
   recordTime(1);
 
   // Calculate intersection between path and crosswalks
   const auto path_end_points_on_crosswalk =
-    getPathEndPointsOnCrosswalk(*path, crosswalk_.polygon2d().basicPolygon(), ego_pos);
+    getPathEndPointsOnCrosswalk(*path, crosswalk_polygon_, ego_pos);
   if (!path_end_points_on_crosswalk) {
     return {};
   }
@@ -773,7 +749,8 @@ std::optional<double> CrosswalkModule::findObjectPassageDirectionAlongVehicleLan
 
 std::optional<CollisionPoint> CrosswalkModule::getCollisionPoint(
   const PathWithLaneId & ego_path, const PredictedObject & object,
-  const std::pair<double, double> & crosswalk_attention_range, const Polygon2d & attention_area)
+  const std::pair<double, double> & crosswalk_attention_range,
+  const PreparedPolygon & attention_area)
 {
   stop_watch_.tic(__func__);
 
@@ -784,18 +761,29 @@ std::optional<CollisionPoint> CrosswalkModule::getCollisionPoint(
 
   const auto obj_polygon =
     createObjectPolygon(object.shape.dimensions.x, object.shape.dimensions.y);
+  const auto & obj_footprints = object_path_footprint_index_->getFootprints(object, obj_polygon);
+  // No footprint of the object can overlap the attention area
+  if (bg::disjoint(obj_footprints.envelope, attention_area.envelope)) {
+    return std::nullopt;
+  }
 
   double minimum_stop_dist = std::numeric_limits<double>::max();
   std::optional<CollisionPoint> nearest_collision_point{std::nullopt};
-  for (const auto & obj_path : object.kinematics.predicted_paths) {
+  for (size_t path_idx = 0; path_idx < object.kinematics.predicted_paths.size(); ++path_idx) {
+    const auto & obj_path = object.kinematics.predicted_paths.at(path_idx);
+    const auto & obj_path_footprints = obj_footprints.paths.at(path_idx);
+    // No footprint of the path can overlap the attention area
+    if (bg::disjoint(obj_path_footprints.envelope, attention_area.envelope)) {
+      continue;
+    }
+
     size_t start_idx{0};
     bool is_start_idx_initialized{false};
     for (size_t i = 0; i < obj_path.path.size(); ++i) {
       // For effective computation, the point and polygon intersection is calculated first.
-      const auto obj_one_step_polygon = createMultiStepPolygon(obj_path.path, obj_polygon, i, i);
-      const auto one_step_intersection_polygons =
-        calcOverlappingPoints(obj_one_step_polygon, attention_area);
-      if (!one_step_intersection_polygons.empty()) {
+      if (hasOverlap(
+            obj_path_footprints.polygons.at(i), obj_path_footprints.envelopes.at(i),
+            attention_area)) {
         if (!is_start_idx_initialized) {
           start_idx = i;
           is_start_idx_initialized = true;
@@ -822,7 +810,7 @@ std::optional<CollisionPoint> CrosswalkModule::getCollisionPoint(
 
       // Calculate intersection points between object and attention area
       const auto multi_step_intersection_polygons =
-        calcOverlappingPoints(obj_multi_step_polygon, attention_area);
+        calcOverlappingPoints(obj_multi_step_polygon, attention_area.polygon);
       if (multi_step_intersection_polygons.empty()) {
         continue;
       }
@@ -1336,6 +1324,11 @@ void CrosswalkModule::updateObjectState(
   const auto is_red_signal_for_pedestrians = isRedSignalForPedestrians();
   auto ignore_crosswalk = is_red_signal_for_pedestrians;
 
+  // The footprints of the objects are shared with the other crosswalk modules, and the envelope
+  // of the attention area is used to skip the objects far from it.
+  object_path_footprint_index_->update(objects_ptr);
+  const PreparedPolygon prepared_attention_area(attention_area);
+
   // Update object state
   object_info_manager_.init();
   for (const auto & object : objects_ptr->objects) {
@@ -1345,8 +1338,10 @@ void CrosswalkModule::updateObjectState(
 
     auto ignore_obj = is_red_signal_for_pedestrians;
     if (p.consider_obj_on_crosswalk_on_red_light && is_red_signal_for_pedestrians) {
+      const auto object_polygon = autoware_utils::to_polygon2d(object);
       const auto is_object_on_crosswalk =
-        bg::intersects(autoware_utils::to_polygon2d(object), crosswalk_.polygon2d().basicPolygon());
+        !bg::disjoint(bg::return_envelope<Box2d>(object_polygon), crosswalk_envelope_) &&
+        bg::intersects(object_polygon, crosswalk_polygon_);
 
       if (is_object_on_crosswalk) {
         ignore_obj = false;
@@ -1364,13 +1359,14 @@ void CrosswalkModule::updateObjectState(
 
     // calculate collision point and state
     const auto collision_point =
-      getCollisionPoint(sparse_resample_path, object, crosswalk_attention_range, attention_area);
+      getCollisionPoint(
+        sparse_resample_path, object, crosswalk_attention_range, prepared_attention_area);
     const std::optional<double> ego_crosswalk_passage_direction =
       findEgoPassageDirectionAlongPath(sparse_resample_path);
     object_info_manager_.update(
       obj_uuid, obj_pos, std::hypot(obj_vel.x, obj_vel.y), objects_ptr->header.stamp,
       is_ego_yielding, has_traffic_light, collision_point, object.classification.front().label, p,
-      crosswalk_.polygon2d().basicPolygon(), attention_area, ego_crosswalk_passage_direction);
+      crosswalk_polygon_, attention_area, ego_crosswalk_passage_direction);
 
     const auto collision_state = object_info_manager_.getCollisionState(obj_uuid);
     if (collision_point) {
@@ -15,6 +15,7 @@
 #ifndef SCENE_CROSSWALK_HPP_
 #define SCENE_CROSSWALK_HPP_
 
+#include "autoware/behavior_velocity_crosswalk_module/object_path_footprint_index.hpp"
 #include "autoware/behavior_velocity_crosswalk_module/util.hpp"
 
 #include <autoware/behavior_velocity_rtc_interface/scene_module_interface_with_rtc.hpp>
@@ -385,7 +386,8 @@ public:
     const rclcpp::Clock::SharedPtr clock,
     const std::shared_ptr<autoware_utils::TimeKeeper> time_keeper,
     const std::shared_ptr<planning_factor_interface::PlanningFactorInterface>
-      planning_factor_interface);
+      planning_factor_interface,
+    const std::shared_ptr<ObjectPathFootprintIndex> & object_path_footprint_index);
 
   bool modifyPathVelocity(PathWithLaneId * path) override;
 
@@ -440,7 +442,8 @@ private:
 
   std::optional<CollisionPoint> getCollisionPoint(
     const PathWithLaneId & ego_path, const PredictedObject & object,
-    const std::pair<double, double> & crosswalk_attention_range, const Polygon2d & attention_area);
+    const std::pair<double, double> & crosswalk_attention_range,
+    const PreparedPolygon & attention_area);
 
   std::pair<std::optional<StopPoseWithObjectUuids>, std::string> getNearestStopFactorAndReason(
     const PathWithLaneId & ego_path,
@@ -537,6 +540,13 @@ private:
 
   lanelet::ConstLanelet crosswalk_;
 
+  // crosswalk polygon and its envelope, computed once since the lanelet conversion is not free
+  lanelet::BasicPolygon2d crosswalk_polygon_;
+  Box2d crosswalk_envelope_;
+
+  // footprints of the predicted objects, shared with the other crosswalk modules
+  std::shared_ptr<ObjectPathFootprintIndex> object_path_footprint_index_;
+
   lanelet::ConstLanelet road_;
 
   lanelet::ConstLineStrings3d stop_lines_;
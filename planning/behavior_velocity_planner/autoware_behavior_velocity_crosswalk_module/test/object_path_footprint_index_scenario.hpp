@@ -0,0 +1,156 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBJECT_PATH_FOOTPRINT_INDEX_SCENARIO_HPP_
+#define OBJECT_PATH_FOOTPRINT_INDEX_SCENARIO_HPP_
+
+#include "autoware/behavior_velocity_crosswalk_module/object_path_footprint_index.hpp"
+
+#include <autoware_utils/geometry/geometry.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+// junction scenario shared by the tests and the benchmark of the object path footprint index
+namespace autoware::behavior_velocity_planner::footprint_index_scenario
+{
+using autoware_perception_msgs::msg::PredictedObject;
+using autoware_perception_msgs::msg::PredictedObjects;
+
+inline geometry_msgs::msg::Polygon createObjectPolygon(const double width, const double length)
+{
+  geometry_msgs::msg::Polygon polygon;
+  for (const auto & [x, y] : std::vector<std::pair<double, double>>{
+         {length / 2.0, -width / 2.0},
+         {length / 2.0, width / 2.0},
+         {-length / 2.0, width / 2.0},
+         {-length / 2.0, -width / 2.0}}) {
+    geometry_msgs::msg::Point32 p;
+    p.x = static_cast<float>(x);
+    p.y = static_cast<float>(y);
+    polygon.points.push_back(p);
+  }
+  return polygon;
+}
+
+// attention areas of the 6 crosswalks of a junction: one on each of the 4 legs, and 2 diagonal ones
+inline std::vector<PreparedPolygon> createAttentionAreas()
+{
+  const auto create_rectangle = [](
+                                  const double x, const double y, const double yaw,
+                                  const double length, const double width) {
+    Polygon2d polygon;
+    for (const auto & [dx, dy] : std::vector<std::pair<double, double>>{
+           {length / 2.0, width / 2.0},
+           {-length / 2.0, width / 2.0},
+           {-length / 2.0, -width / 2.0},
+           {length / 2.0, -width / 2.0}}) {
+      polygon.outer().emplace_back(
+        x + dx * std::cos(yaw) - dy * std::sin(yaw), y + dx * std::sin(yaw) + dy * std::cos(yaw));
+    }
+    boost::geometry::correct(polygon);
+    return PreparedPolygon(polygon);
+  };
+  return {
+    create_rectangle(15.0, 0.0, M_PI_2, 14.0, 4.0), create_rectangle(-15.0, 0.0, M_PI_2, 14.0, 4.0),
+    create_rectangle(0.0, 15.0, 0.0, 14.0, 4.0),    create_rectangle(0.0, -15.0, 0.0, 14.0, 4.0),
+    create_rectangle(0.0, 0.0, M_PI_4, 20.0, 4.0),  create_rectangle(0.0, 0.0, -M_PI_4, 20.0, 4.0)};
+}
+
+// pedestrians walking around the junction with 3 predicted paths each
+inline PredictedObjects::ConstSharedPtr createPedestrians(const size_t num_objects)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> position_distribution(-40.0, 40.0);
+  std::uniform_real_distribution<double> yaw_distribution(-M_PI, M_PI);
+
+  auto objects = std::make_shared<PredictedObjects>();
+  for (size_t i = 0; i < num_objects; ++i) {
+    PredictedObject object;
+    for (size_t j = 0; j < object.object_id.uuid.size(); ++j) {
+      object.object_id.uuid.at(j) = static_cast<uint8_t>((i >> (8 * (j % 8))) & 0xff);
+    }
+    object.shape.dimensions.x = 0.6;
+    object.shape.dimensions.y = 0.6;
+    const double x = position_distribution(engine);
+    const double y = position_distribution(engine);
+    for (size_t path_idx = 0; path_idx < 3; ++path_idx) {
+      geometry_msgs::msg::Pose origin;
+      origin.position.x = x;
+      origin.position.y = y;
+      origin.orientation = autoware_utils::create_quaternion_from_yaw(yaw_distribution(engine));
+      autoware_perception_msgs::msg::PredictedPath predicted_path;
+      for (size_t k = 0; k < 40; ++k) {
+        predicted_path.path.push_back(
+          autoware_utils::calc_offset_pose(origin, 0.2 * static_cast<double>(k), 0.0, 0.0));
+      }
+      object.kinematics.predicted_paths.push_back(predicted_path);
+    }
+    objects->objects.push_back(object);
+  }
+  return objects;
+}
+
+// overlap of each footprint with the attention area as computed before the index
+inline std::vector<bool> calcOverlapsWithoutIndex(
+  const PredictedObjects & objects, const std::vector<PreparedPolygon> & attention_areas)
+{
+  std::vector<bool> overlaps;
+  for (const auto & attention_area : attention_areas) {
+    for (const auto & object : objects.objects) {
+      const auto object_polygon =
+        createObjectPolygon(object.shape.dimensions.x, object.shape.dimensions.y);
+      for (const auto & predicted_path : object.kinematics.predicted_paths) {
+        for (size_t i = 0; i < predicted_path.path.size(); ++i) {
+          std::vector<Polygon2d> intersection_polygons;
+          boost::geometry::intersection(
+            createMultiStepPolygon(predicted_path.path, object_polygon, i, i),
+            attention_area.polygon, intersection_polygons);
+          overlaps.push_back(!intersection_polygons.empty());
+        }
+      }
+    }
+  }
+  return overlaps;
+}
+
+inline std::vector<bool> calcOverlapsWithIndex(
+  const PredictedObjects::ConstSharedPtr & objects,
+  const std::vector<PreparedPolygon> & attention_areas, ObjectPathFootprintIndex & index)
+{
+  std::vector<bool> overlaps;
+  for (const auto & attention_area : attention_areas) {
+    index.update(objects);
+    for (const auto & object : objects->objects) {
+      const auto & footprints = index.getFootprints(
+        object, createObjectPolygon(object.shape.dimensions.x, object.shape.dimensions.y));
+      for (const auto & path : footprints.paths) {
+        for (size_t i = 0; i < path.polygons.size(); ++i) {
+          overlaps.push_back(hasOverlap(path.polygons.at(i), path.envelopes.at(i), attention_area));
+        }
+      }
+    }
+  }
+  return overlaps;
+}
+}  // namespace autoware::behavior_velocity_planner::footprint_index_scenario
+
+#endif  // OBJECT_PATH_FOOTPRINT_INDEX_SCENARIO_HPP_
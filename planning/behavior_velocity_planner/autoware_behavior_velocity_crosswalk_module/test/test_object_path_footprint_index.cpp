@@ -0,0 +1,95 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "object_path_footprint_index_scenario.hpp"
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+
+using autoware::behavior_velocity_planner::Box2d;
+using autoware::behavior_velocity_planner::createMultiStepPolygon;
+using autoware::behavior_velocity_planner::ObjectPathFootprintIndex;
+using autoware::behavior_velocity_planner::footprint_index_scenario::calcOverlapsWithIndex;
+using autoware::behavior_velocity_planner::footprint_index_scenario::calcOverlapsWithoutIndex;
+using autoware::behavior_velocity_planner::footprint_index_scenario::createAttentionAreas;
+using autoware::behavior_velocity_planner::footprint_index_scenario::createObjectPolygon;
+using autoware::behavior_velocity_planner::footprint_index_scenario::createPedestrians;
+using autoware_perception_msgs::msg::PredictedObjects;
+
+TEST(ObjectPathFootprintIndex, sameFootprintsAsPredictedPaths)
+{
+  const auto objects = createPedestrians(10);
+  ObjectPathFootprintIndex index;
+  index.update(objects);
+
+  for (const auto & object : objects->objects) {
+    const auto object_polygon = createObjectPolygon(0.6, 0.6);
+    const auto & footprints = index.getFootprints(object, object_polygon);
+    ASSERT_EQ(footprints.paths.size(), object.kinematics.predicted_paths.size());
+    for (size_t path_idx = 0; path_idx < footprints.paths.size(); ++path_idx) {
+      const auto & path = footprints.paths.at(path_idx);
+      const auto & predicted_path = object.kinematics.predicted_paths.at(path_idx);
+      ASSERT_EQ(path.polygons.size(), predicted_path.path.size());
+      for (size_t i = 0; i < path.polygons.size(); ++i) {
+        // same footprint as the one step polygon used by the crosswalk module before the index
+        EXPECT_TRUE(boost::geometry::equals(
+          path.polygons.at(i), createMultiStepPolygon(predicted_path.path, object_polygon, i, i)));
+        EXPECT_TRUE(boost::geometry::equals(
+          path.envelopes.at(i), boost::geometry::return_envelope<Box2d>(path.polygons.at(i))));
+        EXPECT_TRUE(boost::geometry::covered_by(path.envelopes.at(i), path.envelope));
+      }
+      EXPECT_TRUE(boost::geometry::covered_by(path.envelope, footprints.envelope));
+    }
+    // the second query returns the same footprints
+    EXPECT_EQ(&index.getFootprints(object, object_polygon), &footprints);
+  }
+
+  // the footprints are recomputed for a new objects message
+  const auto & object = objects->objects.front();
+  const auto area = boost::geometry::area(
+    index.getFootprints(object, createObjectPolygon(0.6, 0.6)).paths.front().polygons.front());
+  index.update(objects);
+  EXPECT_DOUBLE_EQ(
+    boost::geometry::area(
+      index.getFootprints(object, createObjectPolygon(2.0, 2.0)).paths.front().polygons.front()),
+    area);
+  index.update(std::make_shared<PredictedObjects>(*objects));
+  EXPECT_NEAR(
+    boost::geometry::area(
+      index.getFootprints(object, createObjectPolygon(2.0, 2.0)).paths.front().polygons.front()),
+    4.0, 1e-6);
+}
+
+TEST(ObjectPathFootprintIndex, sameOverlapsAtJunctionWithSixCrosswalks)
+{
+  const auto attention_areas = createAttentionAreas();
+  const auto objects = createPedestrians(100);
+
+  const auto expected = calcOverlapsWithoutIndex(*objects, attention_areas);
+
+  ObjectPathFootprintIndex index;
+  const auto overlaps = calcOverlapsWithIndex(objects, attention_areas, index);
+
+  EXPECT_EQ(overlaps, expected);
+  // both results are checked
+  EXPECT_GT(std::count(expected.begin(), expected.end(), true), 100);
+  EXPECT_GT(std::count(expected.begin(), expected.end(), false), 100);
+}
@@ -0,0 +1,74 @@
+// Copyright 2026 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__BEHAVIOR_VELOCITY_INTERSECTION_MODULE__OCCLUSION_ATTENTION_MASK_HPP_
+#define AUTOWARE__BEHAVIOR_VELOCITY_INTERSECTION_MODULE__OCCLUSION_ATTENTION_MASK_HPP_
+
+#include <opencv2/core.hpp>
+
+#include <geometry_msgs/msg/point.hpp>
+#include <nav_msgs/msg/map_meta_data.hpp>
+
+#include <lanelet2_core/Forward.h>
+#include <lanelet2_core/primitives/CompoundPolygon.h>
+
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+
+/**
+ * @brief cache of the occlusion attention area mask, in which the attention area is 255 and the
+ * adjacent lanelets and the other cells are 0
+ *
+ * the attention area is static for an intersection lane, so it is rasterized once over its bounding
+ * box. if the occupancy grid origin moves by whole cells, the mask of the grid is copied from the
+ * shifted window of the raster. the raster is rebuilt only if the lanelets, the resolution or the
+ * sub-cell offset of the grid origin change
+ */
+class OcclusionAttentionMask
+{
+public:
+  /**
+   * @brief write the attention mask of the occupancy grid to `mask`
+   * @param mask output of height x width, CV_8UC1, with the same row order as the occlusion
+   * detection (the row of the cell (x, y) is height - 1 - y)
+   * @return the bounding box of the attention area in `mask`, which is empty if the attention area
+   * is outside of the grid
+   */
+  cv::Rect update(
+    const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+    const lanelet::ConstLanelets & adjacent_lanelets, const nav_msgs::msg::MapMetaData & grid_info,
+    cv::Mat & mask);
+
+private:
+  //! ids of the attention areas and the adjacent lanelets used for the raster
+  std::vector<lanelet::Id> lanelet_ids_;
+  double resolution_{0.0};
+  //! grid origin when the raster was built, the cell indices are relative to this origin
+  geometry_msgs::msg::Point anchor_;
+  //! cell index of the left-bottom cell of the raster
+  int min_cell_x_{0};
+  int min_cell_y_{0};
+  //! the row of the cell y is (min_cell_y_ + raster_.rows - 1 - y)
+  cv::Mat raster_;
+
+  void build(
+    const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+    const lanelet::ConstLanelets & adjacent_lanelets, const nav_msgs::msg::MapMetaData & grid_info);
+};
+
+}  // namespace autoware::behavior_velocity_planner
+
+#endif  // AUTOWARE__BEHAVIOR_VELOCITY_INTERSECTION_MODULE__OCCLUSION_ATTENTION_MASK_HPP_
@@ -20,6 +20,7 @@
 #include "intersection_lanelets.hpp"
 #include "intersection_stoplines.hpp"
 #include "object_manager.hpp"
+#include "occlusion_attention_mask.hpp"
 #include "result.hpp"
 
 #include <autoware/behavior_velocity_planner_common/utilization/state_machine.hpp>
@@ -395,6 +396,9 @@ private:
 
   //! save the time when ego observed green traffic light before entering the intersection
   std::optional<rclcpp::Time> initial_green_light_observed_time_{std::nullopt};
+
+  //! cache the mask of the occlusion attention area on the occupancy grid
+  mutable OcclusionAttentionMask occlusion_attention_mask_;
   /** @}*/
 
 private:
@@ -0,0 +1,159 @@
+// Copyright 2026 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_velocity_intersection_module/occlusion_attention_mask.hpp"
+
+#include <opencv2/imgproc.hpp>
+
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+namespace
+{
+//! tolerance of the grid origin offset to be regarded as whole cells, relative to the resolution
+constexpr double cell_offset_tolerance = 1e-3;
+
+std::vector<lanelet::Id> collectLaneletIds(
+  const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+  const lanelet::ConstLanelets & adjacent_lanelets)
+{
+  std::vector<lanelet::Id> ids;
+  for (const auto & attention_area : attention_areas) {
+    const auto area_ids = attention_area.ids();
+    ids.insert(ids.end(), area_ids.begin(), area_ids.end());
+  }
+  ids.push_back(lanelet::InvalId);
+  for (const auto & adjacent_lanelet : adjacent_lanelets) {
+    ids.push_back(adjacent_lanelet.id());
+  }
+  return ids;
+}
+}  // namespace
+
+cv::Rect OcclusionAttentionMask::update(
+  const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+  const lanelet::ConstLanelets & adjacent_lanelets, const nav_msgs::msg::MapMetaData & grid_info,
+  cv::Mat & mask)
+{
+  const int width = grid_info.width;
+  const int height = grid_info.height;
+  const double resolution = grid_info.resolution;
+  const auto & origin = grid_info.origin.position;
+
+  // check if the raster can be reused by shifting it by whole cells
+  auto lanelet_ids = collectLaneletIds(attention_areas, adjacent_lanelets);
+  const double offset_x = (origin.x - anchor_.x) / resolution;
+  const double offset_y = (origin.y - anchor_.y) / resolution;
+  const bool is_cell_aligned =
+    std::abs(offset_x - std::round(offset_x)) < cell_offset_tolerance &&
+    std::abs(offset_y - std::round(offset_y)) < cell_offset_tolerance;
+  if (lanelet_ids != lanelet_ids_ || resolution != resolution_ || !is_cell_aligned) {
+    lanelet_ids_ = std::move(lanelet_ids);
+    build(attention_areas, adjacent_lanelets, grid_info);
+  }
+  // the cell x of the grid is the cell x + shift_x of the raster
+  const int shift_x = static_cast<int>(std::round((origin.x - anchor_.x) / resolution));
+  const int shift_y = static_cast<int>(std::round((origin.y - anchor_.y) / resolution));
+
+  mask.create(height, width, CV_8UC1);
+  mask.setTo(cv::Scalar(0));
+  if (raster_.empty()) {
+    return cv::Rect{};
+  }
+
+  // overlap of the raster and the grid in the cell indices of the grid
+  const int max_cell_y = min_cell_y_ + raster_.rows - 1;
+  const int begin_x = std::max(0, min_cell_x_ - shift_x);
+  const int end_x = std::min(width - 1, min_cell_x_ + raster_.cols - 1 - shift_x);
+  const int begin_y = std::max(0, min_cell_y_ - shift_y);
+  const int end_y = std::min(height - 1, max_cell_y - shift_y);
+  if (begin_x > end_x || begin_y > end_y) {
+    return cv::Rect{};
+  }
+
+  const cv::Size size(end_x - begin_x + 1, end_y - begin_y + 1);
+  const cv::Rect raster_window(
+    cv::Point(begin_x + shift_x - min_cell_x_, max_cell_y - (end_y + shift_y)), size);
+  const cv::Rect grid_window(cv::Point(begin_x, height - 1 - end_y), size);
+  raster_(raster_window).copyTo(mask(grid_window));
+  return grid_window;
+}
+
+void OcclusionAttentionMask::build(
+  const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+  const lanelet::ConstLanelets & adjacent_lanelets, const nav_msgs::msg::MapMetaData & grid_info)
+{
+  resolution_ = grid_info.resolution;
+  anchor_ = grid_info.origin.position;
+  raster_.release();
+
+  auto toCellX = [&](const double x) {
+    return static_cast<int>(std::floor((x - anchor_.x) / resolution_));
+  };
+  auto toCellY = [&](const double y) {
+    return static_cast<int>(std::floor((y - anchor_.y) / resolution_));
+  };
+
+  // bounding box of the attention area with a margin for the anti-aliased boundary
+  int min_x = std::numeric_limits<int>::max();
+  int min_y = std::numeric_limits<int>::max();
+  int max_x = std::numeric_limits<int>::lowest();
+  int max_y = std::numeric_limits<int>::lowest();
+  for (const auto & attention_area : attention_areas) {
+    for (const auto & p : attention_area) {
+      min_x = std::min(min_x, toCellX(p.x()));
+      min_y = std::min(min_y, toCellY(p.y()));
+      max_x = std::max(max_x, toCellX(p.x()));
+      max_y = std::max(max_y, toCellY(p.y()));
+    }
+  }
+  if (min_x > max_x || min_y > max_y) {
+    return;
+  }
+  constexpr int margin = 1;
+  min_cell_x_ = min_x - margin;
+  min_cell_y_ = min_y - margin;
+  const int max_cell_y = max_y + margin;
+  raster_ = cv::Mat(max_cell_y - min_cell_y_ + 1, max_x + margin - min_cell_x_ + 1, CV_8UC1);
+  raster_.setTo(cv::Scalar(0));
+
+  auto toCvPolygon = [&](const auto & polygon) {
+    std::vector<cv::Point> cv_polygon;
+    cv_polygon.reserve(polygon.size());
+    for (const auto & p : polygon) {
+      cv_polygon.emplace_back(toCellX(p.x()) - min_cell_x_, max_cell_y - toCellY(p.y()));
+    }
+    return cv_polygon;
+  };
+
+  // attention: 255
+  // non-attention: 0
+  for (const auto & attention_area : attention_areas) {
+    cv::fillPoly(raster_, toCvPolygon(attention_area), cv::Scalar(255), cv::LINE_AA);
+  }
+  // reset adjacent_lanelets area to 0
+  for (const auto & adjacent_lanelet : adjacent_lanelets) {
+    const auto area2d = adjacent_lanelet.polygon2d().basicPolygon();
+    cv::fillPoly(raster_, toCvPolygon(area2d), cv::Scalar(0), cv::LINE_AA);
+  }
+}
+
+}  // namespace autoware::behavior_velocity_planner
@@ -178,49 +178,52 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     }
   };
 
+  const auto & blocking_attention_objects = object_info_manager_.parkedObjects();
+  for (const auto & blocking_attention_object_info : blocking_attention_objects) {
+    debug_data_.parked_targets.objects.push_back(
+      blocking_attention_object_info->predicted_object());
+  }
+
   // (1) prepare detection area mask
   // attention: 255
   // non-attention: 0
   // NOTE: interesting area is set to 255 for later masking
-  cv::Mat attention_mask(width, height, CV_8UC1, cv::Scalar(0));
-  std::vector<std::vector<cv::Point>> attention_area_cv_polygons;
-  for (const auto & attention_area : attention_areas) {
-    const auto area2d = lanelet::utils::to2D(attention_area);
-    findCommonCvPolygons(area2d, attention_area_cv_polygons);
-  }
-  for (const auto & poly : attention_area_cv_polygons) {
-    cv::fillPoly(attention_mask, poly, cv::Scalar(255), cv::LINE_AA);
-  }
-  // (1.1)
-  // reset adjacent_lanelets area to 0 on attention_mask
-  std::vector<std::vector<cv::Point>> adjacent_lane_cv_polygons;
-  for (const auto & adjacent_lanelet : adjacent_lanelets) {
-    const auto area2d = adjacent_lanelet.polygon2d().basicPolygon();
-    findCommonCvPolygons(area2d, adjacent_lane_cv_polygons);
-  }
-  for (const auto & poly : adjacent_lane_cv_polygons) {
-    cv::fillPoly(attention_mask, poly, cv::Scalar(0), cv::LINE_AA);
+  // NOTE: the attention area and the adjacent lanelets are static, so the mask is cached
+  cv::Mat attention_mask;
+  const cv::Rect attention_roi = occlusion_attention_mask_.update(
+    attention_areas, adjacent_lanelets, occ_grid.info, attention_mask);
+  if (attention_roi.empty()) {
+    return NotOccluded{std::numeric_limits<double>::infinity()};
   }
 
   // (2) prepare unknown mask
   // In OpenCV the pixel at (X=x, Y=y) (with left-upper origin) is accessed by img[y, x]
   // unknown: 255
   // not-unknown: 0
-  cv::Mat unknown_mask_raw(width, height, CV_8UC1, cv::Scalar(0));
-  cv::Mat unknown_mask(width, height, CV_8UC1, cv::Scalar(0));
-  for (int x = 0; x < width; x++) {
-    for (int y = 0; y < height; y++) {
-      const int idx = y * width + x;
-      const unsigned char intensity = occ_grid.data.at(idx);
+  // NOTE: the cells outside of the attention area are masked out later, so only the attention area
+  // and the margin which affects the result of morphologyEx in it are processed
+  const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
+  const cv::Rect unknown_roi =
+    cv::Rect(
+      attention_roi.x - morph_size, attention_roi.y - morph_size,
+      attention_roi.width + 2 * morph_size, attention_roi.height + 2 * morph_size) &
+    cv::Rect(0, 0, width, height);
+  cv::Mat unknown_mask_raw(unknown_roi.size(), CV_8UC1, cv::Scalar(0));
+  for (int row = 0; row < unknown_roi.height; row++) {
+    const int y = height - 1 - (unknown_roi.y + row);
+    auto * unknown_row = unknown_mask_raw.ptr<unsigned char>(row);
+    for (int col = 0; col < unknown_roi.width; col++) {
+      const int idx = y * width + unknown_roi.x + col;
+      const unsigned char intensity = occ_grid.data[idx];
       if (
         planner_param_.occlusion.free_space_max <= intensity &&
         intensity < planner_param_.occlusion.occupied_min) {
-        unknown_mask_raw.at<unsigned char>(height - 1 - y, x) = 255;
+        unknown_row[col] = 255;
       }
     }
   }
   // (2.1) apply morphologyEx
-  const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
+  cv::Mat unknown_mask;
   cv::morphologyEx(
     unknown_mask_raw, unknown_mask, cv::MORPH_OPEN,
     cv::getStructuringElement(cv::MORPH_RECT, cv::Size(morph_size, morph_size)));
@@ -228,16 +231,14 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   // (3) occlusion mask
   static constexpr unsigned char OCCLUDED = 255;
   static constexpr unsigned char BLOCKED = 127;
-  cv::Mat occlusion_mask(width, height, CV_8UC1, cv::Scalar(0));
-  cv::bitwise_and(attention_mask, unknown_mask, occlusion_mask);
+  cv::Mat occlusion_mask(height, width, CV_8UC1, cv::Scalar(0));
+  const cv::Rect unknown_attention_roi(attention_roi.tl() - unknown_roi.tl(), attention_roi.size());
+  cv::bitwise_and(
+    attention_mask(attention_roi), unknown_mask(unknown_attention_roi),
+    occlusion_mask(attention_roi));
   // re-use attention_mask
-  attention_mask = cv::Mat(width, height, CV_8UC1, cv::Scalar(0));
+  attention_mask.setTo(cv::Scalar(0));
   // (3.1) draw all cells on attention_mask behind blocking vehicles as not occluded
-  const auto & blocking_attention_objects = object_info_manager_.parkedObjects();
-  for (const auto & blocking_attention_object_info : blocking_attention_objects) {
-    debug_data_.parked_targets.objects.push_back(
-      blocking_attention_object_info->predicted_object());
-  }
   std::vector<std::vector<cv::Point>> blocking_polygons;
   for (const auto & blocking_attention_object_info : blocking_attention_objects) {
     const Polygon2d obj_poly =
@@ -268,8 +269,11 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   const double possible_object_bbox_x = possible_object_bbox.at(0) / resolution;
   const double possible_object_bbox_y = possible_object_bbox.at(1) / resolution;
   const double possible_object_area = possible_object_bbox_x * possible_object_bbox_y;
+  // NOTE: the occluded cells are only in the attention area
   std::vector<std::vector<cv::Point>> contours;
-  cv::findContours(occlusion_mask, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE);
+  cv::findContours(
+    occlusion_mask(attention_roi), contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE,
+    attention_roi.tl());
   std::vector<std::vector<cv::Point>> valid_contours;
   for (const auto & contour : contours) {
     if (contour.size() <= 2) {
@@ -305,7 +309,7 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     debug_data_.occlusion_polygons.push_back(polygon_msg);
   }
   // (4.1) re-draw occluded cells using valid_contours
-  occlusion_mask = cv::Mat(width, height, CV_8UC1, cv::Scalar(0));
+  occlusion_mask.setTo(cv::Scalar(0));
   for (const auto & valid_contour : valid_contours) {
     // NOTE: drawContour does not work well
     cv::fillPoly(occlusion_mask, valid_contour, cv::Scalar(OCCLUDED), cv::LINE_AA);
@@ -0,0 +1,119 @@
+// Copyright 2026 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_velocity_intersection_module/occlusion_attention_mask.hpp"
+
+#include <opencv2/core.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/utility/Utilities.h>
+
+#include <utility>
+#include <vector>
+
+using autoware::behavior_velocity_planner::OcclusionAttentionMask;
+
+namespace
+{
+lanelet::Lanelet createLanelet(const double x0, const double x1, const double y0, const double y1)
+{
+  const lanelet::LineString3d left(
+    lanelet::utils::getId(), {lanelet::Point3d(lanelet::utils::getId(), x0, y1, 0.0),
+                              lanelet::Point3d(lanelet::utils::getId(), x1, y1, 0.0)});
+  const lanelet::LineString3d right(
+    lanelet::utils::getId(), {lanelet::Point3d(lanelet::utils::getId(), x0, y0, 0.0),
+                              lanelet::Point3d(lanelet::utils::getId(), x1, y0, 0.0)});
+  return lanelet::Lanelet(lanelet::utils::getId(), left, right);
+}
+
+nav_msgs::msg::MapMetaData createGridInfo(const double origin_x, const double origin_y)
+{
+  nav_msgs::msg::MapMetaData grid_info;
+  grid_info.width = 100;
+  grid_info.height = 80;
+  grid_info.resolution = 0.5;
+  grid_info.origin.position.x = origin_x;
+  grid_info.origin.position.y = origin_y;
+  return grid_info;
+}
+
+// the value of the cell including the point (x, y)
+unsigned char getCell(
+  const cv::Mat & mask, const nav_msgs::msg::MapMetaData & grid_info, const double x,
+  const double y)
+{
+  const auto & origin = grid_info.origin.position;
+  const int idx_x = static_cast<int>((x - origin.x) / grid_info.resolution);
+  const int idx_y = static_cast<int>((y - origin.y) / grid_info.resolution);
+  return mask.at<unsigned char>(grid_info.height - 1 - idx_y, idx_x);
+}
+}  // namespace
+
+TEST(OcclusionAttentionMask, maskAttentionAreaWithoutAdjacentLanelets)
+{
+  const auto attention_lanelet = createLanelet(0.0, 20.0, 0.0, 8.0);
+  const std::vector<lanelet::CompoundPolygon3d> attention_areas{attention_lanelet.polygon3d()};
+  const lanelet::ConstLanelets adjacent_lanelets{createLanelet(0.0, 20.0, 0.0, 3.0)};
+
+  OcclusionAttentionMask attention_mask;
+  const auto grid_info = createGridInfo(-10.0, -10.0);
+  cv::Mat mask;
+  const auto roi = attention_mask.update(attention_areas, adjacent_lanelets, grid_info, mask);
+
+  EXPECT_EQ(mask.rows, 80);
+  EXPECT_EQ(mask.cols, 100);
+  EXPECT_FALSE(roi.empty());
+  EXPECT_EQ(getCell(mask, grid_info, 10.0, 6.0), 255);
+  EXPECT_EQ(getCell(mask, grid_info, 10.0, 1.5), 0);
+  EXPECT_EQ(getCell(mask, grid_info, -5.0, 6.0), 0);
+  // all the attention cells are in the returned bounding box
+  EXPECT_EQ(cv::countNonZero(mask), cv::countNonZero(mask(roi)));
+}
+
+TEST(OcclusionAttentionMask, reuseRasterForShiftedGrid)
+{
+  const auto attention_lanelet = createLanelet(0.0, 20.0, 0.0, 8.0);
+  const std::vector<lanelet::CompoundPolygon3d> attention_areas{attention_lanelet.polygon3d()};
+  const lanelet::ConstLanelets adjacent_lanelets{createLanelet(5.0, 12.0, 0.0, 3.0)};
+
+  OcclusionAttentionMask cached_attention_mask;
+  cv::Mat cached_mask;
+  cached_attention_mask.update(
+    attention_areas, adjacent_lanelets, createGridInfo(-10.0, -10.0), cached_mask);
+
+  // the grid origin moves by whole cells, including the cases where the attention area is partly
+  // outside of the grid
+  for (const auto & [origin_x, origin_y] :
+       std::vector<std::pair<double, double>>{{-9.0, -10.5}, {-35.0, -2.0}, {4.0, 3.5}}) {
+    const auto grid_info = createGridInfo(origin_x, origin_y);
+    const auto cached_roi =
+      cached_attention_mask.update(attention_areas, adjacent_lanelets, grid_info, cached_mask);
+
+    OcclusionAttentionMask new_attention_mask;
+    cv::Mat new_mask;
+    const auto new_roi =
+      new_attention_mask.update(attention_areas, adjacent_lanelets, grid_info, new_mask);
+
+    EXPECT_EQ(cached_roi, new_roi);
+    EXPECT_EQ(cv::countNonZero(cached_mask != new_mask), 0);
+    EXPECT_GT(cv::countNonZero(cached_mask), 0);
+  }
+
+  // the attention area is outside of the grid
+  const auto roi = cached_attention_mask.update(
+    attention_areas, adjacent_lanelets, createGridInfo(100.0, 100.0), cached_mask);
+  EXPECT_TRUE(roi.empty());
+  EXPECT_EQ(cv::countNonZero(cached_mask), 0);
+}
@@ -0,0 +1,126 @@
+// Copyright 2026 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__MOTION_VELOCITY_OBJECT_FOOTPRINT_CACHE__OBJECT_FOOTPRINT_CACHE_HPP_
+#define AUTOWARE__MOTION_VELOCITY_OBJECT_FOOTPRINT_CACHE__OBJECT_FOOTPRINT_CACHE_HPP_
+
+#include <autoware/motion_velocity_planner_common/planner_data.hpp>
+#include <autoware_utils_geometry/boost_geometry.hpp>
+#include <rclcpp/node.hpp>
+
+#include <autoware_perception_msgs/msg/predicted_object.hpp>
+#include <autoware_perception_msgs/msg/predicted_path.hpp>
+#include <autoware_perception_msgs/msg/shape.hpp>
+#include <builtin_interfaces/msg/time.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <unique_identifier_msgs/msg/uuid.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::motion_velocity_planner::object_footprint_cache
+{
+using SegmentNode = std::pair<autoware_utils_geometry::Segment2d, size_t>;  // segment, time index
+using SegmentRtree = boost::geometry::index::rtree<SegmentNode, boost::geometry::index::rstar<16>>;
+
+/// @brief footprints of an object along one of its predicted paths
+class PredictedPathFootprints
+{
+public:
+  PredictedPathFootprints(
+    const autoware_perception_msgs::msg::PredictedPath & path,
+    const autoware_perception_msgs::msg::Shape & shape);
+
+  double time_step{};  // [s] time between two consecutive footprints
+  std::vector<autoware_utils_geometry::Polygon2d> footprints;  // footprint at time index*time_step
+
+  /// @brief get the rtree of the footprint segments, built on the first call
+  [[nodiscard]] const SegmentRtree & segments_rtree() const;
+
+  /// @brief return true if the given path is a (possibly cut) copy of the path of these footprints
+  [[nodiscard]] bool is_footprint_of(
+    const autoware_perception_msgs::msg::PredictedPath & path) const;
+
+private:
+  std::vector<geometry_msgs::msg::Pose> poses_;
+  mutable std::once_flag segments_rtree_flag_;
+  mutable SegmentRtree segments_rtree_;
+};
+
+/// @brief footprints of an object at its current pose and along each of its predicted paths
+class ObjectFootprints
+{
+public:
+  /// @param [in] object predicted object, kept alive until the footprints of its paths are built
+  /// @param [in] extra_width [m] width added to the shape of the object
+  ObjectFootprints(
+    std::shared_ptr<const autoware_perception_msgs::msg::PredictedObject> object,
+    const double extra_width);
+
+  autoware_utils_geometry::Polygon2d current_footprint;
+
+  /// @brief get the footprints along each predicted path, built on the first call
+  /// @return footprints in the same order as the predicted paths of the object
+  [[nodiscard]] const std::vector<std::shared_ptr<const PredictedPathFootprints>> &
+  predicted_paths() const;
+
+  /// @brief find the footprints matching the given predicted path
+  /// @return footprints of the path, or nullptr if the path was modified (e.g., resampled)
+  [[nodiscard]] std::shared_ptr<const PredictedPathFootprints> find(
+    const autoware_perception_msgs::msg::PredictedPath & path) const;
+
+private:
+  std::shared_ptr<const autoware_perception_msgs::msg::PredictedObject> object_;
+  autoware_perception_msgs::msg::Shape shape_;
+  mutable std::once_flag predicted_paths_flag_;
+  mutable std::vector<std::shared_ptr<const PredictedPathFootprints>> predicted_paths_;
+};
+
+/// @brief cache of the object footprints of one planning iteration
+/// @details footprints are calculated on the first request and reused by all later requests until
+/// the planner data holds objects of a different message
+class ObjectFootprintCache
+{
+public:
+  /// @brief clear the cache if the planner data holds objects of a different message
+  void update(const PlannerData & planner_data);
+
+  /// @brief get the footprints of an object of the planner data, calculated on the first request
+  /// @param [in] uuid identifier of the object
+  /// @param [in] extra_width [m] width added to the shape of the object
+  /// @return footprints of the object, or nullptr if the object is not in the planner data
+  std::shared_ptr<const ObjectFootprints> get(
+    const unique_identifier_msgs::msg::UUID & uuid, const double extra_width = 0.0);
+
+private:
+  std::mutex mutex_;
+  std::optional<builtin_interfaces::msg::Time> objects_stamp_;
+  std::map<std::string, std::shared_ptr<PlannerData::Object>> objects_;
+  std::map<std::pair<std::string, double>, std::shared_ptr<const ObjectFootprints>> footprints_;
+};
+
+/// @brief get the cache shared by the modules of the given node
+/// @details the cache is destroyed once no module of the node holds it anymore
+std::shared_ptr<ObjectFootprintCache> get_node_cache(const rclcpp::Node & node);
+}  // namespace autoware::motion_velocity_planner::object_footprint_cache
+
+#endif  // AUTOWARE__MOTION_VELOCITY_OBJECT_FOOTPRINT_CACHE__OBJECT_FOOTPRINT_CACHE_HPP_
@@ -0,0 +1,143 @@
+// Copyright 2026 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_velocity_object_footprint_cache/object_footprint_cache.hpp"
+
+#include <autoware_utils_geometry/boost_polygon_utils.hpp>
+#include <autoware_utils_uuid/uuid_helper.hpp>
+#include <rclcpp/duration.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::motion_velocity_planner::object_footprint_cache
+{
+namespace
+{
+bool is_same_pose(const geometry_msgs::msg::Pose & p1, const geometry_msgs::msg::Pose & p2)
+{
+  return p1.position.x == p2.position.x && p1.position.y == p2.position.y &&
+         p1.orientation.z == p2.orientation.z && p1.orientation.w == p2.orientation.w;
+}
+}  // namespace
+
+PredictedPathFootprints::PredictedPathFootprints(
+  const autoware_perception_msgs::msg::PredictedPath & path,
+  const autoware_perception_msgs::msg::Shape & shape)
+: time_step(rclcpp::Duration(path.time_step).seconds()), poses_(path.path)
+{
+  footprints.reserve(poses_.size());
+  for (const auto & pose : poses_)
+    footprints.push_back(autoware_utils_geometry::to_polygon2d(pose, shape));
+}
+
+const SegmentRtree & PredictedPathFootprints::segments_rtree() const
+{
+  std::call_once(segments_rtree_flag_, [&]() {
+    std::vector<SegmentNode> nodes;
+    for (auto i = 0UL; i < footprints.size(); ++i) {
+      const auto & ring = footprints[i].outer();
+      for (auto j = 0UL; j + 1 < ring.size(); ++j)
+        nodes.emplace_back(autoware_utils_geometry::Segment2d{ring[j], ring[j + 1]}, i);
+    }
+    segments_rtree_ = SegmentRtree(nodes);
+  });
+  return segments_rtree_;
+}
+
+bool PredictedPathFootprints::is_footprint_of(
+  const autoware_perception_msgs::msg::PredictedPath & path) const
+{
+  if (path.path.empty() || path.path.size() > poses_.size()) return false;
+  if (rclcpp::Duration(path.time_step).seconds() != time_step) return false;
+  // every pose is compared since a module may modify the middle of a path with the same endpoints
+  for (auto i = 0UL; i < path.path.size(); ++i)
+    if (!is_same_pose(path.path[i], poses_[i])) return false;
+  return true;
+}
+
+ObjectFootprints::ObjectFootprints(
+  std::shared_ptr<const autoware_perception_msgs::msg::PredictedObject> object,
+  const double extra_width)
+: object_(std::move(object)), shape_(object_->shape)
+{
+  shape_.dimensions.y += extra_width;
+  current_footprint = autoware_utils_geometry::to_polygon2d(
+    object_->kinematics.initial_pose_with_covariance.pose, shape_);
+}
+
+const std::vector<std::shared_ptr<const PredictedPathFootprints>> &
+ObjectFootprints::predicted_paths() const
+{
+  std::call_once(predicted_paths_flag_, [&]() {
+    predicted_paths_.reserve(object_->kinematics.predicted_paths.size());
+    for (const auto & path : object_->kinematics.predicted_paths)
+      predicted_paths_.push_back(std::make_shared<PredictedPathFootprints>(path, shape_));
+  });
+  return predicted_paths_;
+}
+
+std::shared_ptr<const PredictedPathFootprints> ObjectFootprints::find(
+  const autoware_perception_msgs::msg::PredictedPath & path) const
+{
+  for (const auto & footprints : predicted_paths())
+    if (footprints->is_footprint_of(path)) return footprints;
+  return nullptr;
+}
+
+void ObjectFootprintCache::update(const PlannerData & planner_data)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto & stamp = planner_data.predicted_objects_header.stamp;
+  if (objects_stamp_ == stamp) return;
+  objects_stamp_ = stamp;
+  objects_.clear();
+  footprints_.clear();
+  for (const auto & object : planner_data.objects)
+    objects_[autoware_utils_uuid::to_hex_string(object->predicted_object.object_id)] = object;
+}
+
+std::shared_ptr<const ObjectFootprints> ObjectFootprintCache::get(
+  const unique_identifier_msgs::msg::UUID & uuid, const double extra_width)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto uuid_str = autoware_utils_uuid::to_hex_string(uuid);
+  const auto key = std::make_pair(uuid_str, extra_width);
+  if (const auto it = footprints_.find(key); it != footprints_.end()) return it->second;
+  const auto object_it = objects_.find(uuid_str);
+  if (object_it == objects_.end()) return nullptr;
+  // the predicted object is aliased to keep the planner data object alive
+  const std::shared_ptr<const autoware_perception_msgs::msg::PredictedObject> predicted_object(
+    object_it->second, &object_it->second->predicted_object);
+  auto footprints = std::make_shared<const ObjectFootprints>(predicted_object, extra_width);
+  footprints_[key] = footprints;
+  return footprints;
+}
+
+std::shared_ptr<ObjectFootprintCache> get_node_cache(const rclcpp::Node & node)
+{
+  static std::mutex mutex;
+  static std::map<std::string, std::weak_ptr<ObjectFootprintCache>> caches;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto & cache = caches[node.get_fully_qualified_name()];
+  if (auto shared_cache = cache.lock()) return shared_cache;
+  auto shared_cache = std::make_shared<ObjectFootprintCache>();
+  cache = shared_cache;
+  return shared_cache;
+}
+}  // namespace autoware::motion_velocity_planner::object_footprint_cache
@@ -0,0 +1,123 @@
+// Copyright 2026 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_velocity_object_footprint_cache/object_footprint_cache.hpp"
+
+#include <autoware_perception_msgs/msg/predicted_object.hpp>
+#include <autoware_perception_msgs/msg/predicted_path.hpp>
+#include <autoware_perception_msgs/msg/shape.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/index/predicates.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+autoware_perception_msgs::msg::PredictedPath make_path()
+{
+  autoware_perception_msgs::msg::PredictedPath path;
+  path.time_step.sec = 1;
+  for (auto x = 0.0; x < 5.0; x += 1.0) {
+    geometry_msgs::msg::Pose pose;
+    pose.position.x = x;
+    pose.orientation.w = 1.0;
+    path.path.push_back(pose);
+  }
+  return path;
+}
+
+autoware_perception_msgs::msg::Shape make_shape()
+{
+  autoware_perception_msgs::msg::Shape shape;
+  shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+  shape.dimensions.x = 2.0;
+  shape.dimensions.y = 1.0;
+  return shape;
+}
+}  // namespace
+
+TEST(TestObjectFootprintCache, PredictedPathFootprints)
+{
+  using autoware::motion_velocity_planner::object_footprint_cache::PredictedPathFootprints;
+  using autoware::motion_velocity_planner::object_footprint_cache::SegmentNode;
+
+  const auto path = make_path();
+  const PredictedPathFootprints footprints(path, make_shape());
+  EXPECT_DOUBLE_EQ(footprints.time_step, 1.0);
+  ASSERT_EQ(footprints.footprints.size(), path.path.size());
+  for (const auto & footprint : footprints.footprints) EXPECT_EQ(footprint.outer().size(), 5UL);
+
+  // 4 segments per footprint
+  EXPECT_EQ(footprints.segments_rtree().size(), 4 * path.path.size());
+  std::vector<SegmentNode> results;
+  footprints.segments_rtree().query(
+    boost::geometry::index::intersects(autoware_utils_geometry::Point2d(4.9, 0.5)),
+    std::back_inserter(results));
+  ASSERT_FALSE(results.empty());
+  for (const auto & [_, time_index] : results) EXPECT_GE(time_index, 4UL);
+}
+
+TEST(TestObjectFootprintCache, FindPath)
+{
+  using autoware::motion_velocity_planner::object_footprint_cache::ObjectFootprints;
+  using autoware::motion_velocity_planner::object_footprint_cache::PredictedPathFootprints;
+
+  const auto path = make_path();
+  auto object = std::make_shared<autoware_perception_msgs::msg::PredictedObject>();
+  object->shape = make_shape();
+  object->kinematics.initial_pose_with_covariance.pose = path.path.front();
+  object->kinematics.predicted_paths.push_back(path);
+  const ObjectFootprints object_footprints(object, 0.0);
+  ASSERT_EQ(object_footprints.predicted_paths().size(), 1UL);
+  EXPECT_EQ(object_footprints.predicted_paths().front()->footprints.size(), path.path.size());
+
+  EXPECT_EQ(object_footprints.find(path), object_footprints.predicted_paths().front());
+  // cut path: prefix of the cached path
+  auto cut_path = path;
+  cut_path.path.resize(2);
+  EXPECT_EQ(object_footprints.find(cut_path), object_footprints.predicted_paths().front());
+  // resampled path
+  auto resampled_path = path;
+  resampled_path.time_step.sec = 0;
+  resampled_path.time_step.nanosec = 500000000;
+  EXPECT_EQ(object_footprints.find(resampled_path), nullptr);
+  // modified path
+  auto modified_path = path;
+  modified_path.path.back().position.y = 1.0;
+  EXPECT_EQ(object_footprints.find(modified_path), nullptr);
+  // path modified in the middle, with the same endpoints
+  ASSERT_GT(path.path.size(), 2UL);
+  auto modified_middle_path = path;
+  modified_middle_path.path[1].position.y = 1.0;
+  EXPECT_EQ(object_footprints.find(modified_middle_path), nullptr);
+}
+
+TEST(TestObjectFootprintCache, ExtraWidth)
+{
+  using autoware::motion_velocity_planner::object_footprint_cache::ObjectFootprints;
+
+  auto object = std::make_shared<autoware_perception_msgs::msg::PredictedObject>();
+  object->shape = make_shape();
+  object->kinematics.initial_pose_with_covariance.pose.orientation.w = 1.0;
+  object->kinematics.predicted_paths.push_back(make_path());
+  const ObjectFootprints object_footprints(object, 1.0);
+  // 2m x (1m + 1m)
+  EXPECT_DOUBLE_EQ(boost::geometry::area(object_footprints.current_footprint), 4.0);
+  for (const auto & footprint : object_footprints.predicted_paths().front()->footprints)
+    EXPECT_DOUBLE_EQ(boost::geometry::area(footprint), 4.0);
+}
@@ -177,6 +177,7 @@ void ObstacleSlowDownModule::init(rclcpp::Node & node, const std::string & modul
   common_param_ = CommonParam(node);
   slow_down_planning_param_ = SlowDownPlanningParam(node);
   obstacle_filtering_param_ = ObstacleFilteringParam(node);
+  footprint_cache_ = object_footprint_cache::get_node_cache(node);
 
   objects_of_interest_marker_interface_ = std::make_unique<
     autoware::objects_of_interest_marker_interface::ObjectsOfInterestMarkerInterface>(
@@ -321,12 +322,13 @@ VelocityPlanningResult ObstacleSlowDownModule::plan(
     tp.time_to_convergence, tp.decimate_trajectory_step_length);
   debug_data_ptr_->decimated_traj_polys = decimated_traj_polys_with_lat_margin;
 
+  footprint_cache_->update(*planner_data);
   auto slow_down_obstacles_for_predicted_object = filter_slow_down_obstacle_for_predicted_object(
     planner_data->current_odometry, planner_data->ego_nearest_dist_threshold,
     planner_data->ego_nearest_yaw_threshold, decimated_traj_polys_with_lat_margin,
     raw_trajectory_points, planner_data->objects,
     rclcpp::Time(planner_data->predicted_objects_header.stamp), planner_data->vehicle_info_,
-    planner_data->trajectory_polygon_collision_check);
+    planner_data->trajectory_polygon_collision_check, *footprint_cache_);
 
   auto slow_down_obstacles_for_point_cloud = filter_slow_down_obstacle_for_point_cloud(
     raw_trajectory_points, decimated_traj_polys_with_lat_margin, planner_data->no_ground_pointcloud,
@@ -372,7 +374,8 @@ ObstacleSlowDownModule::filter_slow_down_obstacle_for_predicted_object(
   const std::vector<TrajectoryPoint> & traj_points,
   const std::vector<std::shared_ptr<PlannerData::Object>> & objects,
   const rclcpp::Time & predicted_objects_stamp, const VehicleInfo & vehicle_info,
-  const TrajectoryPolygonCollisionCheck & trajectory_polygon_collision_check)
+  const TrajectoryPolygonCollisionCheck & trajectory_polygon_collision_check,
+  object_footprint_cache::ObjectFootprintCache & footprint_cache)
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
 
@@ -407,7 +410,7 @@ ObstacleSlowDownModule::filter_slow_down_obstacle_for_predicted_object(
       utils::calc_dist_to_traj_poly(object->predicted_object, traj_polys_for_lat_dist);
     const auto slow_down_obstacle = create_slow_down_obstacle_for_predicted_object(
       traj_points, decimated_traj_polys_with_lat_margin, object, predicted_objects_stamp,
-      dist_from_obj_poly_to_traj_poly);
+      dist_from_obj_poly_to_traj_poly, footprint_cache);
     if (slow_down_obstacle) {
       slow_down_obstacles.push_back(*slow_down_obstacle);
       continue;
@@ -478,7 +481,8 @@ ObstacleSlowDownModule::create_slow_down_obstacle_for_predicted_object(
   const std::vector<TrajectoryPoint> & traj_points,
   const std::vector<Polygon2d> & decimated_traj_polys_with_lat_margin,
   const std::shared_ptr<PlannerData::Object> object, const rclcpp::Time & predicted_objects_stamp,
-  const double dist_from_obj_poly_to_traj_poly)
+  const double dist_from_obj_poly_to_traj_poly,
+  object_footprint_cache::ObjectFootprintCache & footprint_cache)
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
 
@@ -504,9 +508,11 @@ ObstacleSlowDownModule::create_slow_down_obstacle_for_predicted_object(
     return std::nullopt;
   }
 
-  const auto obstacle_poly = autoware_utils::to_polygon2d(
-    object->predicted_object.kinematics.initial_pose_with_covariance.pose,
-    object->predicted_object.shape);
+  const auto object_footprints = footprint_cache.get(object->predicted_object.object_id);
+  const auto & initial_pose = object->predicted_object.kinematics.initial_pose_with_covariance.pose;
+  const auto obstacle_poly =
+    object_footprints ? object_footprints->current_footprint
+                      : autoware_utils::to_polygon2d(initial_pose, object->predicted_object.shape);
 
   // Create linestring from trajectory points
   const auto traj_line = [&]() {
@@ -23,6 +23,7 @@
 #include "type_alias.hpp"
 #include "types.hpp"
 
+#include <autoware/motion_velocity_object_footprint_cache/object_footprint_cache.hpp>
 #include <autoware/motion_velocity_planner_common/plugin_module_interface.hpp>
 #include <autoware/motion_velocity_planner_common/velocity_planning_result.hpp>
 #include <autoware/objects_of_interest_marker_interface/objects_of_interest_marker_interface.hpp>
@@ -93,6 +94,7 @@ private:
   mutable std::shared_ptr<DebugData> debug_data_ptr_;
   bool need_to_clear_velocity_limit_{false};
   mutable std::shared_ptr<autoware_utils::TimeKeeper> time_keeper_;
+  std::shared_ptr<object_footprint_cache::ObjectFootprintCache> footprint_cache_;
   mutable std::unordered_map<double, std::vector<Polygon2d>>
     trajectory_polygon_for_lateral_dist_map_{};
 
@@ -108,7 +110,8 @@ private:
     const std::vector<TrajectoryPoint> & traj_points,
     const std::vector<std::shared_ptr<PlannerData::Object>> & objects,
     const rclcpp::Time & predicted_objects_stamp, const VehicleInfo & vehicle_info,
-    const TrajectoryPolygonCollisionCheck & trajectory_polygon_collision_check);
+    const TrajectoryPolygonCollisionCheck & trajectory_polygon_collision_check,
+    object_footprint_cache::ObjectFootprintCache & footprint_cache);
   std::vector<SlowDownObstacle> filter_slow_down_obstacle_for_point_cloud(
     const std::vector<TrajectoryPoint> & traj_points,
     const std::vector<Polygon2d> & decimated_traj_polys_with_lat_margin,
@@ -117,7 +120,8 @@ private:
     const std::vector<TrajectoryPoint> & traj_points,
     const std::vector<Polygon2d> & decimated_traj_polys_with_lat_margin,
     const std::shared_ptr<PlannerData::Object> object, const rclcpp::Time & predicted_objects_stamp,
-    const double dist_from_obj_poly_to_traj_poly);
+    const double dist_from_obj_poly_to_traj_poly,
+    object_footprint_cache::ObjectFootprintCache & footprint_cache);
   SlowDownObstacle create_slow_down_obstacle_for_point_cloud(
     const rclcpp::Time & stamp, const geometry_msgs::msg::Point & front_collision_point,
     const geometry_msgs::msg::Point & back_collision_point, const double lat_dist_to_traj,
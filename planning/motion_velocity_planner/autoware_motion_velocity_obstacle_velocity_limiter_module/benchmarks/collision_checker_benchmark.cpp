@@ -57,6 +57,10 @@ polygon_t random_polygon()
 int main()
 {
   try {
+    constexpr auto grid_resolution = 0.5;
+    std::printf(
+      "nb_lines, nb_points, rtree_construction_ns, rtree_check_ns, naive_construction_ns, "
+      "naive_check_ns, grid_construction_ns, grid_check_ns\n");
     Obstacles obstacles;
     std::vector<polygon_t> polygons;
     polygons.reserve(100);
@@ -74,6 +78,9 @@ int main()
         const auto naive_constr_start = std::chrono::system_clock::now();
         CollisionChecker naive_collision_checker(obstacles, nb_points + 1, nb_lines * 100);
         const auto naive_constr_end = std::chrono::system_clock::now();
+        const auto grid_constr_start = std::chrono::system_clock::now();
+        CollisionChecker grid_collision_checker(obstacles, grid_resolution);
+        const auto grid_constr_end = std::chrono::system_clock::now();
         const auto rtt_check_start = std::chrono::system_clock::now();
         for (const auto & polygon : polygons)
           const auto rtree_result = rtree_collision_checker.intersections(polygon);
@@ -82,6 +89,10 @@ int main()
         for (const auto & polygon : polygons)
           const auto naive_result = naive_collision_checker.intersections(polygon);
         const auto naive_check_end = std::chrono::system_clock::now();
+        const auto grid_check_start = std::chrono::system_clock::now();
+        for (const auto & polygon : polygons)
+          const auto grid_result = grid_collision_checker.intersections(polygon);
+        const auto grid_check_end = std::chrono::system_clock::now();
         const auto rtt_constr_time =
           std::chrono::duration_cast<std::chrono::nanoseconds>(rtt_constr_end - rtt_constr_start);
         const auto naive_constr_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
@@ -90,9 +101,14 @@ int main()
           std::chrono::duration_cast<std::chrono::nanoseconds>(rtt_check_end - rtt_check_start);
         const auto naive_check_time =
           std::chrono::duration_cast<std::chrono::nanoseconds>(naive_check_end - naive_check_start);
+        const auto grid_constr_time =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(grid_constr_end - grid_constr_start);
+        const auto grid_check_time =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(grid_check_end - grid_check_start);
         std::printf(
-          "%lu, %lu, %ld, %ld, %ld, %ld\n", nb_lines, nb_points, rtt_constr_time.count(),
-          rtt_check_time.count(), naive_constr_time.count(), naive_check_time.count());
+          "%lu, %lu, %ld, %ld, %ld, %ld, %ld, %ld\n", nb_lines, nb_points, rtt_constr_time.count(),
+          rtt_check_time.count(), naive_constr_time.count(), naive_check_time.count(),
+          grid_constr_time.count(), grid_check_time.count());
       }
     }
   } catch (const std::exception & e) {
@@ -0,0 +1,194 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "obstacle_grid.hpp"
+
+#include "obstacles.hpp"
+
+#include <boost/geometry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace autoware::motion_velocity_planner::obstacle_velocity_limiter
+{
+ObstacleGrid::ObstacleGrid(
+  const multipoint_t & points, const multi_linestring_t & lines, const double resolution)
+: resolution_(resolution)
+{
+  for (const auto & line : lines)
+    for (size_t i = 0; i + 1 < line.size(); ++i) segments_.emplace_back(line[i], line[i + 1]);
+  auto min_x = std::numeric_limits<double>::max();
+  auto min_y = std::numeric_limits<double>::max();
+  auto max_x = std::numeric_limits<double>::lowest();
+  auto max_y = std::numeric_limits<double>::lowest();
+  const auto update_bounds = [&](const point_t & p) {
+    min_x = std::min(min_x, p.x());
+    min_y = std::min(min_y, p.y());
+    max_x = std::max(max_x, p.x());
+    max_y = std::max(max_y, p.y());
+  };
+  for (const auto & p : points) update_bounds(p);
+  for (const auto & s : segments_) {
+    update_bounds(s.first);
+    update_bounds(s.second);
+  }
+  if (points.empty() && segments_.empty()) return;
+
+  origin_x_ = min_x;
+  origin_y_ = min_y;
+  const auto calculate_size = [&]() {
+    width_ = static_cast<size_t>(std::floor((max_x - origin_x_) / resolution_)) + 1;
+    height_ = static_cast<size_t>(std::floor((max_y - origin_y_) / resolution_)) + 1;
+  };
+  calculate_size();
+  while (width_ * height_ > max_cells) {
+    resolution_ *= 2.0;
+    calculate_size();
+  }
+  const auto nb_cells = width_ * height_;
+
+  // counting sort of the points by cell
+  const auto point_cell = [&](const point_t & p) {
+    const auto col = std::min(
+      static_cast<size_t>(std::floor((p.x() - origin_x_) / resolution_)), width_ - 1);
+    const auto row = std::min(
+      static_cast<size_t>(std::floor((p.y() - origin_y_) / resolution_)), height_ - 1);
+    return cell_index(col, row);
+  };
+  point_offsets_.assign(nb_cells + 1, 0);
+  for (const auto & p : points) ++point_offsets_[point_cell(p) + 1];
+  for (auto i = 1lu; i < point_offsets_.size(); ++i) point_offsets_[i] += point_offsets_[i - 1];
+  points_.resize(points.size());
+  {
+    auto insert_positions = point_offsets_;
+    for (const auto & p : points) points_[insert_positions[point_cell(p)]++] = p;
+  }
+
+  // counting sort of the segments by the cells they cross
+  segment_offsets_.assign(nb_cells + 1, 0);
+  for (const auto & s : segments_) {
+    for_each_row_span(s.first, s.second, [&](const size_t row, const size_t from, const size_t to) {
+      for (auto col = from; col <= to; ++col) ++segment_offsets_[cell_index(col, row) + 1];
+    });
+  }
+  for (auto i = 1lu; i < segment_offsets_.size(); ++i)
+    segment_offsets_[i] += segment_offsets_[i - 1];
+  segment_indexes_.resize(segment_offsets_.back());
+  {
+    auto insert_positions = segment_offsets_;
+    for (auto i = 0u; i < segments_.size(); ++i) {
+      const auto & s = segments_[i];
+      for_each_row_span(
+        s.first, s.second, [&](const size_t row, const size_t from, const size_t to) {
+          for (auto col = from; col <= to; ++col)
+            segment_indexes_[insert_positions[cell_index(col, row)]++] = i;
+        });
+    }
+  }
+
+  // distance transform along the rows
+  skip_.resize(nb_cells);
+  for (auto row = 0lu; row < height_; ++row) {
+    uint32_t skip = 0;
+    for (auto col = width_; col-- > 0;) {
+      const auto idx = cell_index(col, row);
+      const auto is_occupied = point_offsets_[idx] != point_offsets_[idx + 1] ||
+                               segment_offsets_[idx] != segment_offsets_[idx + 1];
+      skip = is_occupied ? 0 : skip + 1;
+      skip_[idx] = skip;
+    }
+  }
+}
+
+template <class Function>
+void ObstacleGrid::for_each_row_span(const point_t & a, const point_t & b, Function && f) const
+{
+  const auto min_y = std::min(a.y(), b.y());
+  const auto max_y = std::max(a.y(), b.y());
+  const auto first_row = std::floor((min_y - origin_y_) / resolution_);
+  const auto last_row = std::floor((max_y - origin_y_) / resolution_);
+  if (last_row < 0.0 || first_row >= static_cast<double>(height_)) return;
+  const auto from_row = static_cast<size_t>(std::max(first_row, 0.0));
+  const auto to_row = std::min(static_cast<size_t>(last_row), height_ - 1);
+  for (auto row = from_row; row <= to_row; ++row) {
+    // x range of the segment clipped to the band of the row
+    const auto band_min_y = origin_y_ + static_cast<double>(row) * resolution_;
+    const auto band_max_y = band_min_y + resolution_;
+    auto min_x = std::min(a.x(), b.x());
+    auto max_x = std::max(a.x(), b.x());
+    if (a.y() != b.y()) {
+      const auto x_at = [&](const double y) {
+        const auto t = std::clamp((y - a.y()) / (b.y() - a.y()), 0.0, 1.0);
+        return a.x() + t * (b.x() - a.x());
+      };
+      const auto x1 = x_at(band_min_y);
+      const auto x2 = x_at(band_max_y);
+      min_x = std::min(x1, x2);
+      max_x = std::max(x1, x2);
+    }
+    // clamp to the grid such that polygons partially outside of it are still swept correctly
+    const auto to_col_index = [&](const double x) {
+      const auto col = std::floor((x - origin_x_) / resolution_);
+      return static_cast<size_t>(std::clamp(col, 0.0, static_cast<double>(width_ - 1)));
+    };
+    const auto from_col = to_col_index(min_x);
+    const auto to_col = to_col_index(max_x);
+    f(row, from_col, to_col);
+  }
+}
+
+std::vector<point_t> ObstacleGrid::intersections(const polygon_t & polygon) const
+{
+  std::vector<point_t> result;
+  if (width_ == 0 || height_ == 0 || polygon.outer().empty()) return result;
+  // x range of the polygon in each row overlapped by its boundary
+  std::vector<std::pair<size_t, size_t>> row_spans(
+    height_, {std::numeric_limits<size_t>::max(), 0lu});
+  const auto & ring = polygon.outer();
+  for (size_t i = 0; i < ring.size(); ++i) {
+    const auto & a = ring[i];
+    const auto & b = ring[(i + 1) % ring.size()];
+    for_each_row_span(a, b, [&](const size_t row, const size_t from, const size_t to) {
+      row_spans[row].first = std::min(row_spans[row].first, from);
+      row_spans[row].second = std::max(row_spans[row].second, to);
+    });
+  }
+  std::vector<uint32_t> candidate_segments;
+  for (auto row = 0lu; row < height_; ++row) {
+    const auto [from, to] = row_spans[row];
+    for (auto col = from; col <= to;) {
+      const auto idx = cell_index(col, row);
+      if (skip_[idx] > 0) {
+        col += skip_[idx];
+        continue;
+      }
+      for (auto i = point_offsets_[idx]; i < point_offsets_[idx + 1]; ++i)
+        if (boost::geometry::covered_by(points_[i], polygon)) result.push_back(points_[i]);
+      candidate_segments.insert(
+        candidate_segments.end(), segment_indexes_.begin() + segment_offsets_[idx],
+        segment_indexes_.begin() + segment_offsets_[idx + 1]);
+      ++col;
+    }
+  }
+  std::sort(candidate_segments.begin(), candidate_segments.end());
+  candidate_segments.erase(
+    std::unique(candidate_segments.begin(), candidate_segments.end()), candidate_segments.end());
+  for (const auto i : candidate_segments) addSegmentIntersections(segments_[i], polygon, result);
+  return result;
+}
+}  // namespace autoware::motion_velocity_planner::obstacle_velocity_limiter
@@ -0,0 +1,74 @@
+// Copyright 2026 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBSTACLE_GRID_HPP_
+#define OBSTACLE_GRID_HPP_
+
+#include "types.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace autoware::motion_velocity_planner::obstacle_velocity_limiter
+{
+/// @brief obstacles rasterized once into a uniform grid
+/// @details each cell stores the obstacle points it contains and the obstacle segments crossing it
+/// (compressed row storage). A distance transform along the x axis stores for each cell the number
+/// of cells to skip to reach the next occupied cell of the same row, such that a footprint query
+/// sweeps its rows and only visits occupied cells.
+class ObstacleGrid
+{
+public:
+  /// @brief maximum number of cells, the resolution is coarsened if the obstacles require more
+  static constexpr auto max_cells = 4'000'000lu;
+
+  /// @brief rasterize the given obstacles
+  /// @param [in] points obstacle points
+  /// @param [in] lines obstacle linestrings
+  /// @param [in] resolution [m] size of a cell
+  ObstacleGrid(const multipoint_t & points, const multi_linestring_t & lines, double resolution);
+
+  /// @brief get the obstacle points (points and intersections with segments) inside a polygon
+  /// @param [in] polygon query polygon
+  /// @return obstacle points inside the polygon
+  [[nodiscard]] std::vector<point_t> intersections(const polygon_t & polygon) const;
+
+  [[nodiscard]] double resolution() const { return resolution_; }
+  [[nodiscard]] size_t width() const { return width_; }
+  [[nodiscard]] size_t height() const { return height_; }
+
+private:
+  /// @brief call the given function for each row of the grid overlapped by segment (a, b)
+  /// @details the function is called with the row index and the range of overlapped column indexes
+  template <class Function>
+  void for_each_row_span(const point_t & a, const point_t & b, Function && f) const;
+  [[nodiscard]] size_t cell_index(const size_t col, const size_t row) const
+  {
+    return row * width_ + col;
+  }
+
+  double resolution_{};
+  double origin_x_{};
+  double origin_y_{};
+  size_t width_{};
+  size_t height_{};
+  std::vector<point_t> points_;  // obstacle points sorted by cell
+  std::vector<uint32_t> point_offsets_;
+  std::vector<segment_t> segments_;
+  std::vector<uint32_t> segment_indexes_;  // indexes of the segments sorted by cell
+  std::vector<uint32_t> segment_offsets_;
+  std::vector<uint32_t> skip_;  // number of cells to the next occupied cell of the same row
+};
+}  // namespace autoware::motion_velocity_planner::obstacle_velocity_limiter
+#endif  // OBSTACLE_GRID_HPP_
@@ -118,6 +118,10 @@ void ObstacleVelocityLimiterModule::update_parameters(
       obstacle_params_.updateRtreeMinPoints(logger_, static_cast<int>(parameter.as_int()));
     } else if (parameter.get_name() == ObstacleParameters::RTREE_SEGMENTS_PARAM) {
       obstacle_params_.updateRtreeMinSegments(logger_, static_cast<int>(parameter.as_int()));
+    } else if (parameter.get_name() == ObstacleParameters::BACKEND_PARAM) {
+      obstacle_params_.updateBackend(logger_, parameter.as_string());
+    } else if (parameter.get_name() == ObstacleParameters::GRID_RESOLUTION_PARAM) {
+      obstacle_params_.updateGridResolution(logger_, parameter.as_double());
       // Projection parameters
     } else if (parameter.get_name() == ProjectionParameters::MODEL_PARAM) {
       projection_params_.updateModel(logger_, parameter.as_string());
@@ -198,8 +202,7 @@ VelocityPlanningResult ObstacleVelocityLimiterModule::plan(
   stopwatch.tic("slowdowns");
   result.slowdown_intervals = obstacle_velocity_limiter::calculate_slowdown_intervals(
     downsampled_traj_points,
-    obstacle_velocity_limiter::CollisionChecker(
-      obstacles, obstacle_params_.rtree_min_points, obstacle_params_.rtree_min_segments),
+    obstacle_velocity_limiter::CollisionChecker::create(obstacles, obstacle_params_),
     projected_linestrings, footprint_polygons, projection_params_, velocity_params_, virtual_walls);
   const auto slowdowns_us = stopwatch.toc("slowdowns");
 
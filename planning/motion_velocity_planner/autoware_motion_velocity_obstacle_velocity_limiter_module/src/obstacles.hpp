@@ -15,6 +15,7 @@
 #ifndef OBSTACLES_HPP_
 #define OBSTACLES_HPP_
 
+#include "obstacle_grid.hpp"
 #include "parameters.hpp"
 #include "types.hpp"
 
@@ -46,6 +47,29 @@ struct Obstacles
 };
 
 namespace bgi = boost::geometry::index;
+
+/// @brief add the points of a segment that are inside a polygon
+/// @param [in] segment obstacle segment
+/// @param [in] polygon query polygon
+/// @param [inout] result vector where the intersection points are added
+inline void addSegmentIntersections(
+  const segment_t & segment, const polygon_t & polygon, std::vector<point_t> & result)
+{
+  // need conversion to a linestring to use the 'intersection' and 'within' functions
+  const auto ls = linestring_t{segment.first, segment.second};
+  std::vector<point_t> intersection_points;
+  boost::geometry::intersection(ls, polygon, intersection_points);
+  if (intersection_points.empty()) {
+    // No intersection with the polygon: segment is outside or inside of the polygon
+    if (boost::geometry::within(ls, polygon)) {
+      result.push_back(segment.first);
+      result.push_back(segment.second);
+    }
+  } else {
+    result.insert(result.end(), intersection_points.begin(), intersection_points.end());
+  }
+}
+
 template <class T>
 struct ObstacleTree
 {
@@ -91,22 +115,7 @@ struct ObstacleTree<multi_linestring_t>
     // Query the segments
     std::vector<segment_t> candidates;
     segments_rtree.query(bgi::intersects(polygon), std::back_inserter(candidates));
-    std::vector<point_t> intersection_points;
-    for (const auto & candidate : candidates) {
-      // need conversion to a linestring to use the 'intersection' and 'within' functions
-      const auto ls = linestring_t{candidate.first, candidate.second};
-      intersection_points.clear();
-      boost::geometry::intersection(ls, polygon, intersection_points);
-      if (intersection_points.empty()) {
-        // No intersection with the polygon: segment is outside or inside of the polygon
-        if (boost::geometry::within(ls, polygon)) {
-          result.push_back(candidate.first);
-          result.push_back(candidate.second);
-        }
-      } else {
-        result.insert(result.end(), intersection_points.begin(), intersection_points.end());
-      }
-    }
+    for (const auto & candidate : candidates) addSegmentIntersections(candidate, polygon, result);
     return result;
   }
 };
@@ -116,6 +125,7 @@ struct CollisionChecker
   const Obstacles obstacles;
   std::unique_ptr<ObstacleTree<multipoint_t>> point_obstacle_tree_ptr;
   std::unique_ptr<ObstacleTree<multi_linestring_t>> line_obstacle_tree_ptr;
+  std::unique_ptr<ObstacleGrid> obstacle_grid_ptr;
 
   explicit CollisionChecker(
     Obstacles obs, const size_t rtree_min_points, const size_t rtree_min_segments)
@@ -130,8 +140,28 @@ struct CollisionChecker
       point_obstacle_tree_ptr = std::make_unique<ObstacleTree<multipoint_t>>(obstacles.points);
   }
 
+  /// @brief construct a collision checker using the grid backend
+  /// @param [in] obs obstacles to check for collisions
+  /// @param [in] grid_resolution [m] resolution of the obstacle grid
+  CollisionChecker(Obstacles obs, const double grid_resolution) : obstacles(std::move(obs))
+  {
+    obstacle_grid_ptr =
+      std::make_unique<ObstacleGrid>(obstacles.points, obstacles.lines, grid_resolution);
+  }
+
+  /// @brief construct a collision checker with the backend selected by the parameters
+  /// @param [in] obs obstacles to check for collisions
+  /// @param [in] params obstacle parameters
+  static CollisionChecker create(Obstacles obs, const ObstacleParameters & params)
+  {
+    if (params.collision_checker_backend == ObstacleParameters::GRID)
+      return CollisionChecker(std::move(obs), params.grid_resolution);
+    return CollisionChecker(std::move(obs), params.rtree_min_points, params.rtree_min_segments);
+  }
+
   [[nodiscard]] std::vector<point_t> intersections(const polygon_t & polygon) const
   {
+    if (obstacle_grid_ptr) return obstacle_grid_ptr->intersections(polygon);
     std::vector<point_t> result;
     if (line_obstacle_tree_ptr) {
       result = line_obstacle_tree_ptr->intersections(polygon);
@@ -40,8 +40,11 @@ struct ObstacleParameters
   static constexpr auto IGNORE_DIST_PARAM = "obstacles.ignore_extra_distance";
   static constexpr auto RTREE_SEGMENTS_PARAM = "obstacles.rtree_min_segments";
   static constexpr auto RTREE_POINTS_PARAM = "obstacles.rtree_min_points";
+  static constexpr auto BACKEND_PARAM = "obstacles.collision_checker_backend";
+  static constexpr auto GRID_RESOLUTION_PARAM = "obstacles.grid_resolution";
 
   enum { POINTCLOUD, OCCUPANCY_GRID, STATIC_ONLY } dynamic_source = OCCUPANCY_GRID;
+  enum { RTREE, GRID } collision_checker_backend = RTREE;
   int8_t occupancy_grid_threshold{};
   double dynamic_obstacles_buffer{};
   double dynamic_obstacles_min_vel{};
@@ -51,6 +54,7 @@ struct ObstacleParameters
   double ignore_extra_distance{};
   size_t rtree_min_points{};
   size_t rtree_min_segments{};
+  double grid_resolution = 0.5;
 
   ObstacleParameters() = default;
   explicit ObstacleParameters(rclcpp::Node & node)
@@ -68,6 +72,8 @@ struct ObstacleParameters
       node.get_logger(), static_cast<int>(node.declare_parameter<int>(RTREE_POINTS_PARAM)));
     updateRtreeMinSegments(
       node.get_logger(), static_cast<int>(node.declare_parameter<int>(RTREE_SEGMENTS_PARAM)));
+    updateBackend(node.get_logger(), node.declare_parameter<std::string>(BACKEND_PARAM));
+    updateGridResolution(node.get_logger(), node.declare_parameter<double>(GRID_RESOLUTION_PARAM));
   }
 
   // cppcheck-suppress functionStatic
@@ -108,6 +114,33 @@ struct ObstacleParameters
     rtree_min_segments = static_cast<size_t>(size);
     return true;
   }
+
+  // cppcheck-suppress functionStatic
+  bool updateBackend(const rclcpp::Logger & logger, const std::string & backend)
+  {
+    if (backend == "rtree") {
+      collision_checker_backend = RTREE;
+    } else if (backend == "grid") {
+      collision_checker_backend = GRID;
+    } else {
+      RCLCPP_WARN(
+        logger, "Unknown '%s' value: '%s'. Using default 'rtree'.", BACKEND_PARAM,
+        backend.c_str());
+      collision_checker_backend = RTREE;
+      return false;
+    }
+    return true;
+  }
+
+  bool updateGridResolution(const rclcpp::Logger & logger, const double resolution)
+  {
+    if (resolution <= 0.0) {
+      RCLCPP_WARN(logger, "Grid resolution must be positive. %f was given.", resolution);
+      return false;
+    }
+    grid_resolution = resolution;
+    return true;
+  }
 };
 
 struct ProjectionParameters
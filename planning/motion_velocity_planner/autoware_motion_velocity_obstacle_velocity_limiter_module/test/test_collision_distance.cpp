@@ -258,6 +258,57 @@ TEST(TestCollisionDistance, distanceToClosestCollisionApproximation)
   EXPECT_NEAR(*result, 2.23, EPS);
 }
 
+TEST(TestCollisionDistance, distanceToClosestCollisionGridBackend)
+{
+  using autoware::motion_velocity_planner::obstacle_velocity_limiter::CollisionChecker;
+  using autoware::motion_velocity_planner::obstacle_velocity_limiter::distanceToClosestCollision;
+  using autoware::motion_velocity_planner::obstacle_velocity_limiter::linestring_t;
+  using autoware::motion_velocity_planner::obstacle_velocity_limiter::polygon_t;
+
+  autoware::motion_velocity_planner::obstacle_velocity_limiter::ProjectionParameters params;
+  params.model =
+    autoware::motion_velocity_planner::obstacle_velocity_limiter::ProjectionParameters::PARTICLE;
+  params.heading = 0.0;
+  linestring_t vector = {{0.0, 0.0}, {5.0, 0.0}};
+  polygon_t footprint;
+  footprint.outer() = {{0.0, 1.0}, {5.0, 1.0}, {5.0, -1.0}, {0.0, -1.0}};
+  boost::geometry::correct(footprint);  // avoid bugs with malformed polygon
+  autoware::motion_velocity_planner::obstacle_velocity_limiter::Obstacles obstacles;
+
+  std::optional<double> result =
+    distanceToClosestCollision(vector, footprint, CollisionChecker(obstacles, 0.5), params);
+  ASSERT_FALSE(result.has_value());
+
+  obstacles.points.emplace_back(-1.0, 0.0);
+  obstacles.points.emplace_back(1.0, 2.0);
+  result = distanceToClosestCollision(vector, footprint, CollisionChecker(obstacles, 0.5), params);
+  ASSERT_FALSE(result.has_value());
+
+  obstacles.points.emplace_back(4.0, 0.0);
+  obstacles.points.emplace_back(3.0, 0.5);
+  result = distanceToClosestCollision(vector, footprint, CollisionChecker(obstacles, 0.5), params);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_DOUBLE_EQ(*result, 3.0);
+
+  // segment crossing the footprint with no endpoint inside
+  obstacles.lines.push_back({{2.5, 5.0}, {2.5, -5.0}});
+  result = distanceToClosestCollision(vector, footprint, CollisionChecker(obstacles, 0.5), params);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_DOUBLE_EQ(*result, 2.5);
+
+  // same results as the rtree backend with a footprint partially outside of the grid
+  obstacles.lines.push_back({{1.5, 0.5}, {2.0, 0.0}, {1.5, -0.5}});
+  footprint.outer() = {{-10.0, 10.0}, {10.0, 10.0}, {10.0, -10.0}, {-10.0, -10.0}};
+  boost::geometry::correct(footprint);
+  const auto grid_result =
+    distanceToClosestCollision(vector, footprint, CollisionChecker(obstacles, 0.1), params);
+  const auto rtree_result =
+    distanceToClosestCollision(vector, footprint, CollisionChecker(obstacles, 0lu, 0lu), params);
+  ASSERT_TRUE(grid_result.has_value());
+  ASSERT_TRUE(rtree_result.has_value());
+  EXPECT_DOUBLE_EQ(*grid_result, *rtree_result);
+}
+
 TEST(TestCollisionDistance, distanceToClosestCollisionBicycleModel)
 {
   using autoware::motion_velocity_planner::obstacle_velocity_limiter::CollisionChecker;
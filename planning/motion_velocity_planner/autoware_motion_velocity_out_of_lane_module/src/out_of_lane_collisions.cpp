@@ -197,7 +197,8 @@ void calculate_object_path_time_collisions(
   OutOfLaneData & out_of_lane_data, const size_t & object_path_id,
   const autoware_perception_msgs::msg::PredictedObject & object,
   const route_handler::RouteHandler & route_handler,
-  const bool validate_predicted_paths_on_lanelets)
+  const bool validate_predicted_paths_on_lanelets,
+  const object_footprint_cache::PredictedPathFootprints * cached_footprints)
 {
   const auto & object_path = object.kinematics.predicted_paths[object_path_id];
   const auto time_step = rclcpp::Duration(object_path.time_step).seconds();
@@ -207,8 +208,12 @@ void calculate_object_path_time_collisions(
   collision_time.collision_time = 0.0;
   std::optional<lanelet::Ids>
     object_path_lanelet_ids;  // calculated only once for the 1st collision found
-  for (const auto & object_pose : object_path.path) {
-    const auto object_footprint = autoware_utils::to_polygon2d(object_pose, object.shape);
+  autoware_utils::Polygon2d calculated_footprint;
+  for (auto i = 0UL; i < object_path.path.size(); ++i) {
+    const auto & object_footprint =
+      cached_footprints
+        ? cached_footprints->footprints[i]
+        : (calculated_footprint = autoware_utils::to_polygon2d(object_path.path[i], object.shape));
     std::vector<OutAreaNode> query_results;
     out_of_lane_data.outside_areas_rtree.query(
       boost::geometry::index::intersects(object_footprint.outer()),
@@ -232,14 +237,20 @@ void calculate_object_path_time_collisions(
 void calculate_objects_time_collisions(
   OutOfLaneData & out_of_lane_data,
   const std::vector<autoware_perception_msgs::msg::PredictedObject> & objects,
-  const route_handler::RouteHandler & route_handler, const PlannerParam & params)
+  const route_handler::RouteHandler & route_handler, const PlannerParam & params,
+  object_footprint_cache::ObjectFootprintCache & footprint_cache)
 {
+  const auto extra_width = params.objects_extra_width * 0.5;
   for (auto object : objects) {
-    object.shape.dimensions.y += params.objects_extra_width * 0.5;
+    object.shape.dimensions.y += extra_width;
+    const auto object_footprints = footprint_cache.get(object.object_id, extra_width);
     for (auto path_id = 0UL; path_id < object.kinematics.predicted_paths.size(); ++path_id) {
+      const auto cached_footprints =
+        object_footprints ? object_footprints->find(object.kinematics.predicted_paths[path_id])
+                          : nullptr;
       calculate_object_path_time_collisions(
         out_of_lane_data, path_id, object, route_handler,
-        params.validate_predicted_paths_on_lanelets);
+        params.validate_predicted_paths_on_lanelets, cached_footprints.get());
     }
   }
 }
@@ -17,6 +17,7 @@
 
 #include "types.hpp"
 
+#include <autoware/motion_velocity_object_footprint_cache/object_footprint_cache.hpp>
 #include <autoware/motion_velocity_planner_common/collision_checker.hpp>
 #include <autoware/route_handler/route_handler.hpp>
 
@@ -30,17 +31,21 @@ namespace autoware::motion_velocity_planner::out_of_lane
 
 /// @brief calculate the times and points where ego collides with an object's path outside of its
 /// lane
+/// @param cached_footprints footprints of the object path, calculated here if nullptr
 void calculate_object_path_time_collisions(
   OutOfLaneData & out_of_lane_data, const size_t & object_path_id,
   const autoware_perception_msgs::msg::PredictedObject & object,
   const route_handler::RouteHandler & route_handler,
-  const bool validate_predicted_paths_on_lanelets);
+  const bool validate_predicted_paths_on_lanelets,
+  const object_footprint_cache::PredictedPathFootprints * cached_footprints = nullptr);
 
 /// @brief calculate the times and points where ego collides with an object outside of its lane
+/// @details the object footprints are retrieved from the given cache when their paths are unchanged
 void calculate_objects_time_collisions(
   OutOfLaneData & out_of_lane_data,
   const std::vector<autoware_perception_msgs::msg::PredictedObject> & objects,
-  const route_handler::RouteHandler & route_handler, const PlannerParam & params);
+  const route_handler::RouteHandler & route_handler, const PlannerParam & params,
+  object_footprint_cache::ObjectFootprintCache & footprint_cache);
 
 /// @brief calculate the collisions to avoid
 /// @details either uses the time to collision or just the time when the object will arrive at the
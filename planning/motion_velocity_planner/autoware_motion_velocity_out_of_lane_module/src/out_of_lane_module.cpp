@@ -68,6 +68,7 @@ void OutOfLaneModule::init(rclcpp::Node & node, const std::string & module_name)
   logger_ = node.get_logger().get_child(module_name_);
   clock_ = node.get_clock();
   init_parameters(node);
+  footprint_cache_ = object_footprint_cache::get_node_cache(node);
 
   planning_factor_interface_ =
     std::make_unique<autoware::planning_factor_interface::PlanningFactorInterface>(
@@ -458,8 +459,9 @@ VelocityPlanningResult OutOfLaneModule::plan(
   const auto filter_predicted_objects_us = stopwatch.toc("filter_predicted_objects");
 
   stopwatch.tic("calculate_time_collisions");
+  footprint_cache_->update(*planner_data);
   out_of_lane::calculate_objects_time_collisions(
-    out_of_lane_data, objects.objects, *planner_data->route_handler, params_);
+    out_of_lane_data, objects.objects, *planner_data->route_handler, params_, *footprint_cache_);
   const auto calculate_time_collisions_us = stopwatch.toc("calculate_time_collisions");
 
   stopwatch.tic("calculate_times");
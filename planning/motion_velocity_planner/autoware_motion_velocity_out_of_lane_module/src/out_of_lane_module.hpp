@@ -18,6 +18,7 @@
 #include "types.hpp"
 
 #include <autoware/motion_utils/marker/virtual_wall_marker_creator.hpp>
+#include <autoware/motion_velocity_object_footprint_cache/object_footprint_cache.hpp>
 #include <autoware/motion_velocity_planner_common/plugin_module_interface.hpp>
 #include <autoware/motion_velocity_planner_common/velocity_planning_result.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -79,6 +80,7 @@ private:
   rclcpp::Clock::SharedPtr clock_{nullptr};
   std::optional<geometry_msgs::msg::Pose> previous_slowdown_pose_{std::nullopt};
   std::vector<out_of_lane::SlowdownPose> slowdown_pose_buffer_;
+  std::shared_ptr<object_footprint_cache::ObjectFootprintCache> footprint_cache_;
 
 protected:
   // Debug
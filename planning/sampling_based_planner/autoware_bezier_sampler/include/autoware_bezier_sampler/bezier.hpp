@@ -38,6 +38,40 @@ const Eigen::Matrix<double, 4, 6> quintic_bezier_acceleration_coefficients(
    quintic_bezier_velocity_coefficients.row(4) * 4)
     .finished());
 
+/// @brief Quintic Bezier basis functions and their derivatives precomputed for a fixed set of
+/// parameters t, to evaluate many curves sampled with the same resolution
+class BezierBasis
+{
+  std::vector<double> parameters_;
+  Eigen::Matrix<double, Eigen::Dynamic, 6> position_;
+  Eigen::Matrix<double, Eigen::Dynamic, 6> velocity_;
+  Eigen::Matrix<double, Eigen::Dynamic, 6> acceleration_;
+
+public:
+  /// @brief constructor with the desired number of points between t=0 and t=1 (both included)
+  explicit BezierBasis(const int nb_points);
+  /// @brief constructor with the desired resolution of the parameter t, starting from t=0
+  explicit BezierBasis(const double resolution);
+  /// @brief constructor from the parameters t
+  explicit BezierBasis(std::vector<double> parameters);
+  /// @brief return the parameters t of each row of the basis
+  [[nodiscard]] const std::vector<double> & getParameters() const;
+  /// @brief return the basis of the position (multiply by the control points to get the values)
+  [[nodiscard]] const Eigen::Matrix<double, Eigen::Dynamic, 6> & position() const;
+  /// @brief return the basis of the 1st derivative
+  [[nodiscard]] const Eigen::Matrix<double, Eigen::Dynamic, 6> & velocity() const;
+  /// @brief return the basis of the 2nd derivative
+  [[nodiscard]] const Eigen::Matrix<double, Eigen::Dynamic, 6> & acceleration() const;
+};
+
+/// @brief values of a curve at each parameter of a BezierBasis
+struct BezierPoints
+{
+  Eigen::Matrix<double, Eigen::Dynamic, 2> points;
+  Eigen::VectorXd headings;
+  Eigen::VectorXd curvatures;
+};
+
 /// @brief Quintic Bezier curve
 class Bezier
 {
@@ -57,6 +91,10 @@ public:
   /// @brief return the curve in cartesian frame (including angle) with the desired number of
   /// points
   [[nodiscard]] std::vector<Eigen::Vector3d> cartesianWithHeading(const int nb_points) const;
+  /// @brief return the curve in cartesian frame (including angle) at the parameters of the basis
+  [[nodiscard]] std::vector<Eigen::Vector3d> cartesianWithHeading(const BezierBasis & basis) const;
+  /// @brief calculate the points, headings, and curvatures at the parameters of the basis
+  [[nodiscard]] BezierPoints evaluate(const BezierBasis & basis) const;
   /// @brief calculate the curve value for the given parameter t
   [[nodiscard]] Eigen::Vector2d value(const double t) const;
   /// @brief calculate the curve value for the given parameter t (using matrix formulation)
@@ -70,6 +108,18 @@ public:
   /// @brief calculate the curvature for the given parameter t
   [[nodiscard]] double curvature(const double t) const;
 };
+
+/// @brief calculate the points, headings, and curvatures of many curves at the parameters of the
+/// basis
+/// @details the control points of all curves are stacked to evaluate them with one matrix product
+[[nodiscard]] std::vector<BezierPoints> evaluate(
+  const std::vector<Bezier> & curves, const BezierBasis & basis);
+
+/// @brief calculate the curvatures from the 1st and 2nd derivatives (one point per row)
+/// @details the curvature is infinite where the 1st derivative is zero
+[[nodiscard]] Eigen::VectorXd curvatures(
+  const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, 2>> & velocities,
+  const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, 2>> & accelerations);
 }  // namespace autoware::bezier_sampler
 
 #endif  // AUTOWARE_BEZIER_SAMPLER__BEZIER_HPP_
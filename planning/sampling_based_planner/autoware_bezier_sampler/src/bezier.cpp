@@ -14,6 +14,8 @@
 
 #include <autoware_bezier_sampler/bezier.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <limits>
 #include <utility>
@@ -21,6 +23,75 @@
 
 namespace autoware::bezier_sampler
 {
+namespace
+{
+std::vector<double> parametersFromNbPoints(const int nb_points)
+{
+  std::vector<double> parameters;
+  if (nb_points <= 0) return parameters;
+  if (nb_points == 1) return {0.0};
+  parameters.reserve(nb_points);
+  const double step = 1.0 / (nb_points - 1);
+  for (int i = 0; i + 1 < nb_points; ++i) parameters.push_back(i * step);
+  parameters.push_back(1.0);
+  return parameters;
+}
+
+std::vector<double> parametersFromResolution(const double resolution)
+{
+  if (!(resolution > 0.0)) return {0.0};
+  // the epsilon keeps t=1 when 1/resolution is an integer subject to rounding errors
+  const auto nb_points = static_cast<int>(std::floor(1.0 / resolution + 1e-9)) + 1;
+  std::vector<double> parameters;
+  parameters.reserve(nb_points);
+  for (int i = 0; i < nb_points; ++i) parameters.push_back(std::min(1.0, i * resolution));
+  return parameters;
+}
+}  // namespace
+
+BezierBasis::BezierBasis(const int nb_points) : BezierBasis(parametersFromNbPoints(nb_points))
+{
+}
+
+BezierBasis::BezierBasis(const double resolution)
+: BezierBasis(parametersFromResolution(resolution))
+{
+}
+
+BezierBasis::BezierBasis(std::vector<double> parameters) : parameters_(std::move(parameters))
+{
+  const auto nb_points = static_cast<Eigen::Index>(parameters_.size());
+  Eigen::Matrix<double, Eigen::Dynamic, 6> ts(nb_points, 6);
+  for (Eigen::Index i = 0; i < nb_points; ++i) {
+    const double t = parameters_[i];
+    ts(i, 0) = 1.0;
+    for (Eigen::Index j = 1; j < 6; ++j) ts(i, j) = ts(i, j - 1) * t;
+  }
+  position_ = ts * quintic_bezier_coefficients;
+  velocity_ = ts.leftCols<5>() * quintic_bezier_velocity_coefficients;
+  acceleration_ = ts.leftCols<4>() * quintic_bezier_acceleration_coefficients;
+}
+
+const std::vector<double> & BezierBasis::getParameters() const
+{
+  return parameters_;
+}
+
+const Eigen::Matrix<double, Eigen::Dynamic, 6> & BezierBasis::position() const
+{
+  return position_;
+}
+
+const Eigen::Matrix<double, Eigen::Dynamic, 6> & BezierBasis::velocity() const
+{
+  return velocity_;
+}
+
+const Eigen::Matrix<double, Eigen::Dynamic, 6> & BezierBasis::acceleration() const
+{
+  return acceleration_;
+}
+
 Bezier::Bezier(Eigen::Matrix<double, 6, 2> control_points)
 : control_points_(std::move(control_points))
 {
@@ -63,33 +134,55 @@ Eigen::Vector2d Bezier::valueM(const double t) const
 
 std::vector<Eigen::Vector2d> Bezier::cartesian(const int nb_points) const
 {
+  const BezierBasis basis(nb_points);
+  const Eigen::Matrix<double, Eigen::Dynamic, 2> values = basis.position() * control_points_;
   std::vector<Eigen::Vector2d> points;
-  points.reserve(nb_points);
-  const double step = 1.0 / (nb_points - 1);
-  for (double t = 0.0; t <= 1.0; t += step) points.push_back(valueM(t));
+  points.reserve(values.rows());
+  for (Eigen::Index i = 0; i < values.rows(); ++i) points.emplace_back(values.row(i));
   return points;
 }
 
 std::vector<Eigen::Vector2d> Bezier::cartesian(const double resolution) const
 {
+  const BezierBasis basis(resolution);
+  const Eigen::Matrix<double, Eigen::Dynamic, 2> values = basis.position() * control_points_;
   std::vector<Eigen::Vector2d> points;
-  points.reserve(static_cast<int>(1 / resolution));
-  for (double t = 0.0; t <= 1.0; t += resolution) points.push_back(valueM(t));
+  points.reserve(values.rows());
+  for (Eigen::Index i = 0; i < values.rows(); ++i) points.emplace_back(values.row(i));
   return points;
 }
 
 std::vector<Eigen::Vector3d> Bezier::cartesianWithHeading(const int nb_points) const
 {
+  return cartesianWithHeading(BezierBasis(nb_points));
+}
+
+std::vector<Eigen::Vector3d> Bezier::cartesianWithHeading(const BezierBasis & basis) const
+{
+  const Eigen::Matrix<double, Eigen::Dynamic, 2> values = basis.position() * control_points_;
+  const Eigen::Matrix<double, Eigen::Dynamic, 2> velocities = basis.velocity() * control_points_;
   std::vector<Eigen::Vector3d> points;
-  points.reserve(nb_points);
-  const double step = 1.0 / (nb_points - 1);
-  for (double t = 0.0; t <= 1.0; t += step) {
-    Eigen::Vector2d point = valueM(t);
-    points.emplace_back(point.x(), point.y(), heading(t));
+  points.reserve(values.rows());
+  for (Eigen::Index i = 0; i < values.rows(); ++i) {
+    points.emplace_back(
+      values(i, 0), values(i, 1), std::atan2(velocities(i, 1), velocities(i, 0)));
   }
   return points;
 }
 
+BezierPoints Bezier::evaluate(const BezierBasis & basis) const
+{
+  BezierPoints result;
+  result.points = basis.position() * control_points_;
+  const Eigen::Matrix<double, Eigen::Dynamic, 2> velocities = basis.velocity() * control_points_;
+  const Eigen::Matrix<double, Eigen::Dynamic, 2> accelerations =
+    basis.acceleration() * control_points_;
+  result.headings = velocities.col(1).binaryExpr(
+    velocities.col(0), [](const double y, const double x) { return std::atan2(y, x); });
+  result.curvatures = curvatures(velocities, accelerations);
+  return result;
+}
+
 Eigen::Vector2d Bezier::velocity(const double t) const
 {
   Eigen::Matrix<double, 1, 5> ts;
@@ -120,4 +213,38 @@ double Bezier::heading(const double t) const
   return std::atan2(vel.y(), vel.x());
 }
 
+std::vector<BezierPoints> evaluate(const std::vector<Bezier> & curves, const BezierBasis & basis)
+{
+  const auto nb_curves = static_cast<Eigen::Index>(curves.size());
+  Eigen::Matrix<double, 6, Eigen::Dynamic> control_points(6, 2 * nb_curves);
+  for (Eigen::Index i = 0; i < nb_curves; ++i) {
+    control_points.middleCols<2>(2 * i) = curves[i].getControlPoints();
+  }
+  const Eigen::MatrixXd values = basis.position() * control_points;
+  const Eigen::MatrixXd velocities = basis.velocity() * control_points;
+  const Eigen::MatrixXd accelerations = basis.acceleration() * control_points;
+
+  std::vector<BezierPoints> results(curves.size());
+  for (Eigen::Index i = 0; i < nb_curves; ++i) {
+    auto & result = results[i];
+    result.points = values.middleCols<2>(2 * i);
+    result.headings = velocities.col(2 * i + 1).binaryExpr(
+      velocities.col(2 * i), [](const double y, const double x) { return std::atan2(y, x); });
+    result.curvatures =
+      curvatures(velocities.middleCols<2>(2 * i), accelerations.middleCols<2>(2 * i));
+  }
+  return results;
+}
+
+Eigen::VectorXd curvatures(
+  const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, 2>> & velocities,
+  const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, 2>> & accelerations)
+{
+  const Eigen::ArrayXd cross = velocities.col(0).array() * accelerations.col(1).array() -
+                               accelerations.col(0).array() * velocities.col(1).array();
+  const Eigen::ArrayXd denominator = velocities.rowwise().squaredNorm().array().pow(3.0 / 2.0);
+  return (denominator != 0.0)
+    .select(cross / denominator, std::numeric_limits<double>::infinity())
+    .matrix();
+}
 }  // namespace autoware::bezier_sampler
@@ -46,6 +46,9 @@ Path generateCandidate(
 Trajectory generateCandidate(
   const FrenetState & initial_state, const FrenetState & target_state, const double duration,
   const double time_resolution);
+Trajectory generateCandidate(
+  const Polynomial & longitudinal_polynomial, const Polynomial & lateral_polynomial,
+  const double duration, const double time_resolution);
 /// @brief calculate the cartesian frame of the given path
 void calculateCartesian(
   const autoware::sampler_common::transform::Spline2D & reference, Path & path);
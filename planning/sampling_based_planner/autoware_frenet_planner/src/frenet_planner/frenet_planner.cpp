@@ -27,21 +27,47 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <iostream>
+#include <map>
 #include <vector>
 
 namespace autoware::frenet_planner
 {
+namespace
+{
+/// @brief boundary conditions of a polynomial from the common initial state
+using PolynomialEndpoint = std::array<double, 4>;
+}  // namespace
+
 std::vector<Trajectory> generateTrajectories(
   const autoware::sampler_common::transform::Spline2D & reference_spline,
   const FrenetState & initial_state, const SamplingParameters & sampling_parameters)
 {
+  // the samples usually combine a few longitudinal and lateral targets, so the polynomials of the
+  // samples with the same target are shared
+  std::map<PolynomialEndpoint, Polynomial> longitudinal_polynomials;
+  std::map<PolynomialEndpoint, Polynomial> lateral_polynomials;
   std::vector<Trajectory> trajectories;
   trajectories.reserve(sampling_parameters.parameters.size());
   for (const auto & parameter : sampling_parameters.parameters) {
+    const auto & target_state = parameter.target_state;
+    const auto duration = parameter.target_duration;
+    const auto longitudinal_it = longitudinal_polynomials.try_emplace(
+      {target_state.position.s, target_state.longitudinal_velocity,
+       target_state.longitudinal_acceleration, duration},
+      initial_state.position.s, initial_state.longitudinal_velocity,
+      initial_state.longitudinal_acceleration, target_state.position.s,
+      target_state.longitudinal_velocity, target_state.longitudinal_acceleration, duration);
+    const auto lateral_it = lateral_polynomials.try_emplace(
+      {target_state.position.d, target_state.lateral_velocity, target_state.lateral_acceleration,
+       duration},
+      initial_state.position.d, initial_state.lateral_velocity, initial_state.lateral_acceleration,
+      target_state.position.d, target_state.lateral_velocity, target_state.lateral_acceleration,
+      duration);
     auto trajectory = generateCandidate(
-      initial_state, parameter.target_state, parameter.target_duration,
+      longitudinal_it.first->second, lateral_it.first->second, duration,
       sampling_parameters.resolution);
     trajectory.sampling_parameter = parameter;
     calculateCartesian(reference_spline, trajectory);
@@ -57,9 +83,21 @@ std::vector<Path> generatePaths(
   const autoware::sampler_common::transform::Spline2D & reference_spline,
   const FrenetState & initial_state, const SamplingParameters & sampling_parameters)
 {
+  // samples with the same target give the same path, which is only calculated once
+  std::map<PolynomialEndpoint, size_t> candidate_indexes;
   std::vector<Path> candidates;
   candidates.reserve(sampling_parameters.parameters.size());
-  for (const auto parameter : sampling_parameters.parameters) {
+  for (const auto & parameter : sampling_parameters.parameters) {
+    const auto & target_state = parameter.target_state;
+    const auto [it, inserted] = candidate_indexes.emplace(
+      PolynomialEndpoint{
+        target_state.position.s, target_state.position.d, target_state.lateral_velocity,
+        target_state.lateral_acceleration},
+      candidates.size());
+    if (!inserted) {
+      candidates.push_back(candidates[it->second]);
+      continue;
+    }
     auto candidate =
       generateCandidate(initial_state, parameter.target_state, sampling_parameters.resolution);
     calculateCartesian(reference_spline, candidate);
@@ -71,16 +109,26 @@ std::vector<Path> generatePaths(
 Trajectory generateCandidate(
   const FrenetState & initial_state, const FrenetState & target_state, const double duration,
   const double time_resolution)
+{
+  return generateCandidate(
+    Polynomial(
+      initial_state.position.s, initial_state.longitudinal_velocity,
+      initial_state.longitudinal_acceleration, target_state.position.s,
+      target_state.longitudinal_velocity, target_state.longitudinal_acceleration, duration),
+    Polynomial(
+      initial_state.position.d, initial_state.lateral_velocity, initial_state.lateral_acceleration,
+      target_state.position.d, target_state.lateral_velocity, target_state.lateral_acceleration,
+      duration),
+    duration, time_resolution);
+}
+
+Trajectory generateCandidate(
+  const Polynomial & longitudinal_polynomial, const Polynomial & lateral_polynomial,
+  const double duration, const double time_resolution)
 {
   Trajectory trajectory;
-  trajectory.longitudinal_polynomial = Polynomial(
-    initial_state.position.s, initial_state.longitudinal_velocity,
-    initial_state.longitudinal_acceleration, target_state.position.s,
-    target_state.longitudinal_velocity, target_state.longitudinal_acceleration, duration);
-  trajectory.lateral_polynomial = Polynomial(
-    initial_state.position.d, initial_state.lateral_velocity, initial_state.lateral_acceleration,
-    target_state.position.d, target_state.lateral_velocity, target_state.lateral_acceleration,
-    duration);
+  trajectory.longitudinal_polynomial = longitudinal_polynomial;
+  trajectory.lateral_polynomial = lateral_polynomial;
   for (double t = 0.0; t <= duration; t += time_resolution) {
     trajectory.times.push_back(t);
     trajectory.frenet_points.emplace_back(
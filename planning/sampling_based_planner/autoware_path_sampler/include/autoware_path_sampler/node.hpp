@@ -49,6 +49,7 @@ protected:  // for the static_centerline_generator package
   EgoNearestParam ego_nearest_param_{};
   Parameters params_;
   size_t debug_id_ = 0;
+  int num_threads_ = 1;
 
   // variables for subscribers
   Odometry::SharedPtr ego_state_ptr_;
@@ -133,6 +133,9 @@ PathSampler::PathSampler(const rclcpp::NodeOptions & node_options)
       declare_parameter<bool>("debug.enable_calculation_time_info");
     debug_id_ = static_cast<size_t>(declare_parameter<int>("debug.id"));
 
+    // parameter for the evaluation of the candidates
+    num_threads_ = std::max(1, static_cast<int>(declare_parameter<int>("num_threads", 4)));
+
     // parameters for ego nearest search
     ego_nearest_param_ = EgoNearestParam(this);
 
@@ -481,12 +484,17 @@ autoware::sampler_common::Path PathSampler::generatePath(const PlannerData & pla
     generateCandidatesFromPreviousPath(planner_data, path_spline);
   candidate_paths.insert(
     candidate_paths.end(), candidates_from_prev_path.begin(), candidates_from_prev_path.end());
-  debug_data_.footprints.clear();
-  for (auto & path : candidate_paths) {
-    const auto footprint =
+  // the candidates are independent so they are checked in parallel, and the cost is only calculated
+  // for the valid ones since the others cannot be selected
+  debug_data_.footprints.assign(candidate_paths.size(), {});
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads_)
+  for (size_t i = 0; i < candidate_paths.size(); ++i) {
+    auto & path = candidate_paths[i];
+    debug_data_.footprints[i] =
       autoware::sampler_common::constraints::checkHardConstraints(path, params_.constraints);
-    debug_data_.footprints.push_back(footprint);
-    autoware::sampler_common::constraints::calculateCost(path, params_.constraints, path_spline);
+    if (path.constraint_results.isValid()) {
+      autoware::sampler_common::constraints::calculateCost(path, params_.constraints, path_spline);
+    }
   }
   const auto best_path_idx = [](const auto & paths) {
     auto min_cost = std::numeric_limits<double>::max();
@@ -71,16 +71,20 @@ std::vector<autoware::sampler_common::Path> generateBezierPaths(
     const auto bezier_samples =
       autoware::bezier_sampler::sample(initial_state, target_state, params.sampling.bezier);
 
-    const auto step = std::min(0.1, params.sampling.resolution / target_length);
-    for (const auto & bezier : bezier_samples) {
+    // all samples of a target share the same resolution and are evaluated together
+    const autoware::bezier_sampler::BezierBasis basis(
+      std::min(0.1, params.sampling.resolution / target_length));
+    const auto bezier_points = autoware::bezier_sampler::evaluate(bezier_samples, basis);
+    for (const auto & bezier : bezier_points) {
       autoware::sampler_common::Path path;
       path.lengths.push_back(0.0);
-      for (double t = 0.0; t <= 1.0; t += step) {
-        const auto x_y = bezier.valueM(t);
-        path.points.emplace_back(x_y[0], x_y[1]);
-        path.yaws.emplace_back(bezier.heading(t));
-        path.curvatures.push_back(bezier.curvature(t));
+      path.points.reserve(bezier.points.rows());
+      for (Eigen::Index i = 0; i < bezier.points.rows(); ++i) {
+        path.points.emplace_back(bezier.points(i, 0), bezier.points(i, 1));
       }
+      path.yaws.assign(bezier.headings.data(), bezier.headings.data() + bezier.headings.size());
+      path.curvatures.assign(
+        bezier.curvatures.data(), bezier.curvatures.data() + bezier.curvatures.size());
       for (size_t i = 0; i + 1 < path.points.size(); ++i) {
         path.lengths.push_back(
           path.lengths.back() + std::hypot(
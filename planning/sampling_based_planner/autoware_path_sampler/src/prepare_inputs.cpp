@@ -16,6 +16,7 @@
 
 #include "autoware_frenet_planner/structures.hpp"
 #include "autoware_path_sampler/utils/geometry_utils.hpp"
+#include "autoware_sampler_common/constraints/drivable_area_grid.hpp"
 #include "autoware_sampler_common/structures.hpp"
 #include "autoware_sampler_common/transform/spline_transform.hpp"
 #include "autoware_utils/geometry/boost_polygon_utils.hpp"
@@ -51,6 +52,11 @@ void prepareConstraints(
     drivable_area_polygon.outer().emplace_back(it->x, it->y);
   drivable_area_polygon.outer().push_back(drivable_area_polygon.outer().front());
   constraints.drivable_polygons = {drivable_area_polygon};
+  // the grid only speeds up the footprint checks, their result does not depend on its resolution
+  constexpr auto drivable_area_grid_resolution = 0.5;  // [m]
+  constraints.drivable_area_grid =
+    std::make_shared<autoware::sampler_common::constraints::DrivableAreaGrid>(
+      constraints.drivable_polygons, drivable_area_grid_resolution);
 }
 
 autoware::frenet_planner::SamplingParameters prepareSamplingParameters(
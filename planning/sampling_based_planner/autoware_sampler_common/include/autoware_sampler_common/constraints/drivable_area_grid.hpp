@@ -0,0 +1,62 @@
+// Copyright 2026 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_SAMPLER_COMMON__CONSTRAINTS__DRIVABLE_AREA_GRID_HPP_
+#define AUTOWARE_SAMPLER_COMMON__CONSTRAINTS__DRIVABLE_AREA_GRID_HPP_
+
+#include "autoware_sampler_common/structures.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace autoware::sampler_common::constraints
+{
+/// @brief raster of the drivable polygons to check many footprints against them
+/// @details each cell is either fully inside, fully outside, or crossed by the boundary of the
+/// polygons. Only the points in the boundary cells are checked, against the polygon segments of
+/// their row, so the result is the same as boost::geometry::within(footprint, polygons).
+class DrivableAreaGrid
+{
+public:
+  /// @brief rasterize the given polygons
+  /// @param [in] polygons drivable polygons
+  /// @param [in] resolution [m] size of the grid cells
+  DrivableAreaGrid(const MultiPolygon2d & polygons, const double resolution);
+
+  /// @brief return true if the footprint is within the drivable polygons
+  [[nodiscard]] bool within(const MultiPoint2d & footprint) const;
+
+private:
+  enum class Cell : uint8_t { Outside, Inside, Boundary };
+  using Segment = std::pair<Point2d, Point2d>;
+
+  void addSegment(const Point2d & p1, const Point2d & p2);
+  void fillInside();
+  /// @brief even-odd test of a point in the given row
+  /// @return 1 if inside, 0 if on the boundary, -1 if outside of the polygons
+  [[nodiscard]] int locate(const Point2d & p, const int row) const;
+
+  double resolution_;
+  double min_x_ = 0.0;
+  double min_y_ = 0.0;
+  int width_ = 0;
+  int height_ = 0;
+  std::vector<Cell> cells_;
+  // segments of the polygons overlapping each row
+  std::vector<std::vector<Segment>> row_segments_;
+};
+}  // namespace autoware::sampler_common::constraints
+
+#endif  // AUTOWARE_SAMPLER_COMMON__CONSTRAINTS__DRIVABLE_AREA_GRID_HPP_
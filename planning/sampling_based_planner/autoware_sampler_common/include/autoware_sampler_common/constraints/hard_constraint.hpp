@@ -20,7 +20,11 @@
 #include <vector>
 namespace autoware::sampler_common::constraints
 {
-/// @brief Check if the path satisfies the hard constraints
+/// @brief check the hard constraints of the path, the constraints after the first violated one are
+/// not checked
+/// @details the results of the constraints that are not checked are left to true in
+/// path.constraint_results, such that only the first violated constraint is reported as false
+/// @return footprint of the path
 MultiPoint2d checkHardConstraints(Path & path, const Constraints & constraints);
 bool has_collision(
   const MultiPoint2d & footprint, const MultiPolygon2d & obstacles,
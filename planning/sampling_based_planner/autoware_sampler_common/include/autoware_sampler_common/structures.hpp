@@ -340,6 +340,11 @@ struct DynamicObstacle
   double time_step;  // [s] time step between each footprint
 };
 
+namespace constraints
+{
+class DrivableAreaGrid;
+}  // namespace constraints
+
 struct Constraints
 {
   struct
@@ -361,6 +366,8 @@ struct Constraints
   double ego_length;
   MultiPolygon2d obstacle_polygons;
   MultiPolygon2d drivable_polygons;
+  // optional raster of the drivable_polygons used to speed up the drivable area check
+  std::shared_ptr<const constraints::DrivableAreaGrid> drivable_area_grid;
   std::vector<DynamicObstacle> dynamic_obstacles;
   Rtree rtree;
 };
@@ -0,0 +1,138 @@
+// Copyright 2026 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_sampler_common/constraints/drivable_area_grid.hpp"
+
+#include <boost/geometry/algorithms/envelope.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace autoware::sampler_common::constraints
+{
+DrivableAreaGrid::DrivableAreaGrid(const MultiPolygon2d & polygons, const double resolution)
+: resolution_(resolution)
+{
+  if (polygons.empty() || resolution_ <= 0.0) return;
+  autoware_utils::Box2d envelope;
+  boost::geometry::envelope(polygons, envelope);
+  min_x_ = envelope.min_corner().x();
+  min_y_ = envelope.min_corner().y();
+  width_ = static_cast<int>((envelope.max_corner().x() - min_x_) / resolution_) + 1;
+  height_ = static_cast<int>((envelope.max_corner().y() - min_y_) / resolution_) + 1;
+  cells_.assign(static_cast<size_t>(width_) * static_cast<size_t>(height_), Cell::Outside);
+  row_segments_.resize(static_cast<size_t>(height_));
+
+  const auto add_ring = [&](const auto & ring) {
+    for (size_t i = 0; i + 1 < ring.size(); ++i) addSegment(ring[i], ring[i + 1]);
+  };
+  for (const auto & polygon : polygons) {
+    add_ring(polygon.outer());
+    for (const auto & inner : polygon.inners()) add_ring(inner);
+  }
+  fillInside();
+}
+
+void DrivableAreaGrid::addSegment(const Point2d & p1, const Point2d & p2)
+{
+  // the cells of the bounding box of the segment are marked, with a margin so that a segment on
+  // the border between two cells marks both of them
+  const double margin = 1e-6 * resolution_;
+  const auto to_index = [&](const double value, const double min, const int size) {
+    return std::clamp(static_cast<int>(std::floor((value - min) / resolution_)), 0, size - 1);
+  };
+  const auto min_ix = to_index(std::min(p1.x(), p2.x()) - margin, min_x_, width_);
+  const auto max_ix = to_index(std::max(p1.x(), p2.x()) + margin, min_x_, width_);
+  const auto min_iy = to_index(std::min(p1.y(), p2.y()) - margin, min_y_, height_);
+  const auto max_iy = to_index(std::max(p1.y(), p2.y()) + margin, min_y_, height_);
+  for (auto iy = min_iy; iy <= max_iy; ++iy) {
+    row_segments_[static_cast<size_t>(iy)].emplace_back(p1, p2);
+    for (auto ix = min_ix; ix <= max_ix; ++ix) {
+      cells_[static_cast<size_t>(iy) * static_cast<size_t>(width_) + static_cast<size_t>(ix)] =
+        Cell::Boundary;
+    }
+  }
+}
+
+void DrivableAreaGrid::fillInside()
+{
+  // a cell without boundary is entirely inside or outside, which is decided at its center with the
+  // even-odd rule along the row
+  std::vector<double> crossings;
+  for (auto iy = 0; iy < height_; ++iy) {
+    const double y = min_y_ + (iy + 0.5) * resolution_;
+    crossings.clear();
+    for (const auto & [p1, p2] : row_segments_[static_cast<size_t>(iy)]) {
+      if ((p1.y() > y) != (p2.y() > y)) {
+        crossings.push_back(p1.x() + (y - p1.y()) * (p2.x() - p1.x()) / (p2.y() - p1.y()));
+      }
+    }
+    std::sort(crossings.begin(), crossings.end());
+    for (size_t i = 0; i + 1 < crossings.size(); i += 2) {
+      const auto first_ix =
+        std::max(0, static_cast<int>(std::ceil((crossings[i] - min_x_) / resolution_ - 0.5)));
+      const auto last_ix = std::min(
+        width_ - 1, static_cast<int>(std::floor((crossings[i + 1] - min_x_) / resolution_ - 0.5)));
+      for (auto ix = first_ix; ix <= last_ix; ++ix) {
+        auto & cell =
+          cells_[static_cast<size_t>(iy) * static_cast<size_t>(width_) + static_cast<size_t>(ix)];
+        if (cell != Cell::Boundary) cell = Cell::Inside;
+      }
+    }
+  }
+}
+
+int DrivableAreaGrid::locate(const Point2d & p, const int row) const
+{
+  bool inside = false;
+  for (const auto & [p1, p2] : row_segments_[static_cast<size_t>(row)]) {
+    const double cross =
+      (p2.x() - p1.x()) * (p.y() - p1.y()) - (p2.y() - p1.y()) * (p.x() - p1.x());
+    if (
+      cross == 0.0 && std::min(p1.x(), p2.x()) <= p.x() && p.x() <= std::max(p1.x(), p2.x()) &&
+      std::min(p1.y(), p2.y()) <= p.y() && p.y() <= std::max(p1.y(), p2.y())) {
+      return 0;
+    }
+    if ((p1.y() > p.y()) != (p2.y() > p.y())) {
+      const double x = p1.x() + (p.y() - p1.y()) * (p2.x() - p1.x()) / (p2.y() - p1.y());
+      if (p.x() < x) inside = !inside;
+    }
+  }
+  return inside ? 1 : -1;
+}
+
+bool DrivableAreaGrid::within(const MultiPoint2d & footprint) const
+{
+  // same definition as boost::geometry::within: no point is outside of the polygons and at least
+  // one point is inside of their interior
+  bool has_interior_point = false;
+  for (const auto & p : footprint) {
+    const auto ix = static_cast<int>(std::floor((p.x() - min_x_) / resolution_));
+    const auto iy = static_cast<int>(std::floor((p.y() - min_y_) / resolution_));
+    if (ix < 0 || iy < 0 || ix >= width_ || iy >= height_) return false;
+    const auto cell =
+      cells_[static_cast<size_t>(iy) * static_cast<size_t>(width_) + static_cast<size_t>(ix)];
+    if (cell == Cell::Outside) return false;
+    if (cell == Cell::Inside) {
+      has_interior_point = true;
+      continue;
+    }
+    const auto location = locate(p, iy);
+    if (location < 0) return false;
+    if (location > 0) has_interior_point = true;
+  }
+  return has_interior_point;
+}
+}  // namespace autoware::sampler_common::constraints
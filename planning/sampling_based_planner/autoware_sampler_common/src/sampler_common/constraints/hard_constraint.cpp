@@ -14,6 +14,7 @@
 
 #include "autoware_sampler_common/constraints/hard_constraint.hpp"
 
+#include "autoware_sampler_common/constraints/drivable_area_grid.hpp"
 #include "autoware_sampler_common/constraints/footprint.hpp"
 
 #include <boost/geometry.hpp>
@@ -35,25 +36,39 @@ bool has_collision(
   const MultiPoint2d & footprint, const MultiPolygon2d & obstacles, const double min_distance)
 {
   if (footprint.empty()) return false;
-  for (const auto & o : obstacles)
+  // the obstacles farther than min_distance from the envelope of the footprint are skipped
+  autoware_utils::Box2d envelope;
+  boost::geometry::envelope(footprint, envelope);
+  const autoware_utils::Box2d search_box(
+    Point2d(envelope.min_corner().x() - min_distance, envelope.min_corner().y() - min_distance),
+    Point2d(envelope.max_corner().x() + min_distance, envelope.max_corner().y() + min_distance));
+  for (const auto & o : obstacles) {
+    if (boost::geometry::disjoint(o, search_box)) continue;
     if (boost::geometry::distance(o, footprint) <= min_distance) return true;
+  }
   return false;
 }
 
 MultiPoint2d checkHardConstraints(Path & path, const Constraints & constraints)
 {
   const auto footprint = buildFootprintPoints(path, constraints);
-  if (!footprint.empty()) {
-    if (constraints.hard.limit_footprint_inside_drivable_area)
-      path.constraint_results.inside_drivable_area =
-        boost::geometry::within(footprint, constraints.drivable_polygons);
-    path.constraint_results.collision_free = !has_collision(
-      footprint, constraints.obstacle_polygons, constraints.hard.min_dist_from_obstacles);
-  }
+  // the constraints are checked from the cheapest one and the remaining ones are skipped once the
+  // path is invalid
   if (!satisfyMinMax(
         path.curvatures, constraints.hard.min_curvature, constraints.hard.max_curvature)) {
     path.constraint_results.valid_curvature = false;
+    return footprint;
+  }
+  if (footprint.empty()) return footprint;
+  if (constraints.hard.limit_footprint_inside_drivable_area) {
+    path.constraint_results.inside_drivable_area =
+      constraints.drivable_area_grid
+        ? constraints.drivable_area_grid->within(footprint)
+        : boost::geometry::within(footprint, constraints.drivable_polygons);
+    if (!path.constraint_results.inside_drivable_area) return footprint;
   }
+  path.constraint_results.collision_free = !has_collision(
+    footprint, constraints.obstacle_polygons, constraints.hard.min_dist_from_obstacles);
   return footprint;
 }
 }  // namespace autoware::sampler_common::constraints
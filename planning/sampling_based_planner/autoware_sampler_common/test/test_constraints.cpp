@@ -0,0 +1,121 @@
+// Copyright 2026 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware_sampler_common/constraints/drivable_area_grid.hpp>
+#include <autoware_sampler_common/constraints/hard_constraint.hpp>
+#include <autoware_sampler_common/structures.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+namespace
+{
+using autoware::sampler_common::MultiPoint2d;
+using autoware::sampler_common::MultiPolygon2d;
+using autoware::sampler_common::Polygon2d;
+
+// curved road with an obstacle hole
+MultiPolygon2d createDrivableArea()
+{
+  Polygon2d polygon;
+  for (double x = 0.0; x <= 50.0; x += 1.7) {
+    polygon.outer().emplace_back(x, 5.0 * std::sin(x / 10.0) - 2.0);
+  }
+  for (double x = 50.0; x >= 0.0; x -= 1.3) {
+    polygon.outer().emplace_back(x, 5.0 * std::sin(x / 10.0) + 2.0 + 0.05 * x);
+  }
+  polygon.inners().emplace_back();
+  polygon.inners().back().emplace_back(20.0, 4.0);
+  polygon.inners().back().emplace_back(22.0, 4.0);
+  polygon.inners().back().emplace_back(22.0, 5.0);
+  polygon.inners().back().emplace_back(20.0, 5.0);
+  boost::geometry::correct(polygon);
+  return {polygon};
+}
+}  // namespace
+
+TEST(DrivableAreaGrid, sameResultAsPolygons)
+{
+  using autoware::sampler_common::constraints::DrivableAreaGrid;
+  const auto drivable_area = createDrivableArea();
+  const DrivableAreaGrid grid(drivable_area, 0.5);
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> x_distribution(-5.0, 55.0);
+  std::uniform_real_distribution<double> y_distribution(-10.0, 10.0);
+  std::uniform_real_distribution<double> offset_distribution(-1.0, 1.0);
+  size_t within_count = 0;
+  for (size_t i = 0; i < 10000; ++i) {
+    MultiPoint2d footprint;
+    const double x = x_distribution(engine);
+    const double y = y_distribution(engine) * 0.3 + 5.0 * std::sin(x / 10.0);
+    for (size_t j = 0; j < 4; ++j) {
+      footprint.emplace_back(x + offset_distribution(engine), y + offset_distribution(engine));
+    }
+    const bool expected = boost::geometry::within(footprint, drivable_area);
+    EXPECT_EQ(grid.within(footprint), expected);
+    within_count += static_cast<size_t>(expected);
+  }
+  // both results are checked
+  EXPECT_GT(within_count, 100UL);
+  EXPECT_LT(within_count, 9900UL);
+
+  EXPECT_FALSE(grid.within(MultiPoint2d{}));
+  EXPECT_FALSE(DrivableAreaGrid(MultiPolygon2d{}, 0.5).within(MultiPoint2d{{1.0, 0.0}}));
+}
+
+TEST(HardConstraints, skipConstraintsAfterViolation)
+{
+  using autoware::sampler_common::constraints::checkHardConstraints;
+  using autoware::sampler_common::constraints::DrivableAreaGrid;
+  autoware::sampler_common::Constraints constraints;
+  constraints.hard.min_curvature = -0.1;
+  constraints.hard.max_curvature = 0.1;
+  constraints.hard.min_dist_from_obstacles = 0.0;
+  constraints.hard.limit_footprint_inside_drivable_area = true;
+  constraints.ego_footprint = {{1.0, 0.5}, {1.0, -0.5}, {-1.0, -0.5}, {-1.0, 0.5}};
+  constraints.drivable_polygons = createDrivableArea();
+  constraints.drivable_area_grid =
+    std::make_shared<DrivableAreaGrid>(constraints.drivable_polygons, 0.5);
+  Polygon2d obstacle;
+  obstacle.outer() = {{10.5, 5.5}, {11.5, 5.5}, {11.5, 3.0}, {10.5, 3.0}, {10.5, 5.5}};
+  constraints.obstacle_polygons = {obstacle};
+
+  autoware::sampler_common::Path path;
+  for (double x = 5.0; x <= 15.0; x += 1.0) {
+    path.points.emplace_back(x, 5.0 * std::sin(x / 10.0));
+    path.yaws.push_back(std::atan(0.5 * std::cos(x / 10.0)));
+    path.curvatures.push_back(0.0);
+  }
+
+  checkHardConstraints(path, constraints);
+  EXPECT_TRUE(path.constraint_results.valid_curvature);
+  EXPECT_TRUE(path.constraint_results.inside_drivable_area);
+  EXPECT_FALSE(path.constraint_results.collision_free);
+
+  // the drivable area and the collision are not checked with an invalid curvature
+  path.constraint_results.clear();
+  path.curvatures.back() = 1.0;
+  const auto footprint = checkHardConstraints(path, constraints);
+  EXPECT_EQ(footprint.size(), path.points.size() * 4);
+  EXPECT_FALSE(path.constraint_results.valid_curvature);
+  EXPECT_TRUE(path.constraint_results.collision_free);
+  EXPECT_FALSE(path.constraint_results.isValid());
+}
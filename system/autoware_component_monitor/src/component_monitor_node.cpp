@@ -14,60 +14,63 @@
 
 #include "component_monitor_node.hpp"
 
-#include "unit_conversions.hpp"
-
 #include <rclcpp/rclcpp.hpp>
 
+#include <autoware_internal_debug_msgs/msg/string_stamped.hpp>
 #include <autoware_internal_msgs/msg/resource_usage_report.hpp>
 
-#include <boost/process.hpp>
+#include <unistd.h>
 
-#include <cctype>
-#include <cstdint>
+#include <algorithm>
+#include <cstdio>
 #include <exception>
 #include <functional>
-#include <sstream>
+#include <memory>
 #include <string>
-#include <unordered_map>
-#include <utility>
-#include <vector>
 
 namespace autoware::component_monitor
 {
 ComponentMonitor::ComponentMonitor(const rclcpp::NodeOptions & node_options)
-: Node("component_monitor", node_options), publish_rate_(declare_parameter<double>("publish_rate"))
+: Node("component_monitor", node_options),
+  publish_rate_(declare_parameter<double>("publish_rate")),
+  thread_hot_spots_nb_(
+    static_cast<std::size_t>(std::max(declare_parameter<int>("thread_hot_spots_nb"), 0)))
 {
   usage_pub_ =
     create_publisher<ResourceUsageReport>("~/component_system_usage", rclcpp::SensorDataQoS());
+  thread_hot_spots_pub_ = create_publisher<StringStamped>("~/debug/thread_hot_spots", 1);
 
-  // Make sure top ins installed and is in path
-  const auto path_top = boost::process::search_path("top");
-  if (path_top.empty()) {
-    RCLCPP_ERROR_STREAM(get_logger(), "Couldn't find 'top' in path.");
-    rclcpp::shutdown();
-  }
+  // The usage is read from procfs in this process, the first sample is taken here
+  sampler_ = std::make_unique<ProcfsSampler>();
+  thread_hot_spots_.reserve(thread_hot_spots_nb_);
 
   // Get the PID of the current process
   int pid = getpid();
 
-  environment_ = boost::this_process::environment();
-  environment_["LC_NUMERIC"] = "en_US.UTF-8";
-
   on_timer_tick_wrapped_ = std::bind(&ComponentMonitor::on_timer_tick, this, pid);
 
   timer_ = rclcpp::create_timer(
     this, get_clock(), rclcpp::Rate(publish_rate_).period(), on_timer_tick_wrapped_);
 }
 
-void ComponentMonitor::on_timer_tick(const int pid) const
+void ComponentMonitor::on_timer_tick(const int pid)
 {
-  if (usage_pub_->get_subscription_count() == 0) return;
+  const bool is_usage_subscribed = usage_pub_->get_subscription_count() > 0;
+  const bool is_hot_spots_subscribed =
+    thread_hot_spots_nb_ > 0 && thread_hot_spots_pub_->get_subscription_count() > 0;
 
   try {
-    auto usage_msg = pid_to_report(pid);
-    usage_msg.header.stamp = this->now();
-    usage_msg.pid = pid;
-    usage_pub_->publish(usage_msg);
+    // sample at every tick, so that the CPU usage is the average over the last period
+    sampler_->sample();
+    if (is_usage_subscribed) {
+      auto usage_msg = usage_to_report(sampler_->process_usage());
+      usage_msg.header.stamp = this->now();
+      usage_msg.pid = pid;
+      usage_pub_->publish(usage_msg);
+    }
+    if (is_hot_spots_subscribed) {
+      publish_thread_hot_spots();
+    }
   } catch (std::exception & e) {
     RCLCPP_ERROR(get_logger(), "%s", e.what());
   } catch (...) {
@@ -75,101 +78,33 @@ void ComponentMonitor::on_timer_tick(const int pid) const
   }
 }
 
-ComponentMonitor::ResourceUsageReport ComponentMonitor::pid_to_report(const pid_t & pid) const
+ComponentMonitor::ResourceUsageReport ComponentMonitor::usage_to_report(
+  const ProcessUsage & usage) const
 {
-  const auto std_out = run_system_command("top -b -n 1 -E k -p " + std::to_string(pid));
-
-  const auto fields = parse_lines_into_words(std_out);
-
   ResourceUsageReport report;
-  report.cpu_cores_utilized = std::stof(fields.back().at(8)) / 100.0f;
-  report.total_memory_bytes = unit_conversions::kib_to_bytes(std::stoul(fields.at(3).at(3)));
-  report.free_memory_bytes = unit_conversions::kib_to_bytes(std::stoul(fields.at(3).at(5)));
-  report.process_memory_bytes = parse_memory_res(fields.back().at(5));
+  report.cpu_cores_utilized = usage.cpu_cores_utilized;
+  report.total_memory_bytes = usage.total_memory_bytes;
+  report.free_memory_bytes = usage.free_memory_bytes;
+  report.process_memory_bytes = usage.process_memory_bytes;
 
   return report;
 }
 
-std::stringstream ComponentMonitor::run_system_command(const std::string & cmd) const
-{
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    RCLCPP_ERROR_STREAM(get_logger(), "Error setting flags on out_fd");
-  }
-  boost::process::pipe out_pipe{out_fd[0], out_fd[1]};
-  boost::process::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    RCLCPP_ERROR_STREAM(get_logger(), "Error setting flags on err_fd");
-  }
-  boost::process::pipe err_pipe{err_fd[0], err_fd[1]};
-  boost::process::ipstream is_err{std::move(err_pipe)};
-
-  boost::process::child c(
-    cmd, environment_, boost::process::std_out > is_out, boost::process::std_err > is_err);
-  c.wait();
-
-  if (c.exit_code() != 0) {
-    std::ostringstream os;
-    is_err >> os.rdbuf();
-    RCLCPP_ERROR_STREAM(get_logger(), "Error running command: " << os.str());
-  }
-
-  std::stringstream sstream;
-  sstream << is_out.rdbuf();
-  return sstream;
-}
-
-ComponentMonitor::VecVecStr ComponentMonitor::parse_lines_into_words(
-  const std::stringstream & std_out)
+void ComponentMonitor::publish_thread_hot_spots()
 {
-  VecVecStr fields;
-  std::string line;
-  std::istringstream input{std_out.str()};
-
-  while (std::getline(input, line)) {
-    std::istringstream iss_line{line};
-    std::string word;
-    std::vector<std::string> words;
-
-    while (iss_line >> word) {
-      words.push_back(word);
-    }
-
-    fields.push_back(words);
+  sampler_->get_thread_hot_spots(thread_hot_spots_nb_, thread_hot_spots_);
+
+  // example line: 12345 worker_thread 0.52
+  StringStamped msg;
+  msg.stamp = this->now();
+  char line[64];
+  for (const auto & thread : thread_hot_spots_) {
+    std::snprintf(
+      line, sizeof(line), "%d %s %.2f\n", thread.tid, thread.name.data(),
+      thread.cpu_cores_utilized);
+    msg.data += line;
   }
-
-  return fields;
-}
-
-std::uint64_t ComponentMonitor::parse_memory_res(const std::string & mem_res)
-{
-  // example 1: 12.3g
-  // example 2: 123 (without suffix, just bytes)
-  // NOLINTNEXTLINE(readability/casting)
-  static const std::unordered_map<char, std::function<std::uint64_t(double)>> unit_map{
-    {'k', unit_conversions::kib_to_bytes<double>}, {'m', unit_conversions::mib_to_bytes<double>},
-    {'g', unit_conversions::gib_to_bytes<double>}, {'t', unit_conversions::tib_to_bytes<double>},
-    {'p', unit_conversions::pib_to_bytes<double>}, {'e', unit_conversions::eib_to_bytes<double>}};
-
-  if (std::isdigit(mem_res.back())) {
-    return std::stoull(mem_res);  // Handle plain bytes without any suffix
-  }
-
-  // Extract the numeric part and the unit suffix
-  double value = std::stod(mem_res.substr(0, mem_res.size() - 1));
-  char suffix = mem_res.back();
-
-  // Find the appropriate function from the map
-  auto it = unit_map.find(suffix);
-  if (it != unit_map.end()) {
-    const auto & conversion_function = it->second;
-    return conversion_function(value);
-  }
-
-  // Throw an exception or handle the error as needed if the suffix is not recognized
-  throw std::runtime_error("Unsupported unit suffix: " + std::string(1, suffix));
+  thread_hot_spots_pub_->publish(msg);
 }
 
 }  // namespace autoware::component_monitor
@@ -0,0 +1,265 @@
+// Copyright 2026 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "procfs_sampler.hpp"
+
+#include "unit_conversions.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <ctime>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace autoware::component_monitor
+{
+namespace
+{
+double get_monotonic_seconds()
+{
+  timespec ts{};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1e-9;
+}
+
+float to_cpu_cores(
+  const std::uint64_t ticks, const std::uint64_t last_ticks, const double ticks_per_second,
+  const double elapsed_time)
+{
+  if (elapsed_time <= 0.0 || ticks < last_ticks) {
+    return 0.0f;
+  }
+  const double cpu_time = static_cast<double>(ticks - last_ticks) / ticks_per_second;
+  return static_cast<float>(cpu_time / elapsed_time);
+}
+}  // namespace
+
+namespace procfs
+{
+bool parse_stat(std::string_view stat, std::array<char, 16> & name, std::uint64_t & cpu_ticks)
+{
+  // example: 1234 (name with spaces) S 1 1234 1234 0 -1 4194560 ... utime stime ...
+  // the name may contain parentheses, so it ends at the last one
+  const auto name_begin = stat.find('(');
+  const auto name_end = stat.rfind(')');
+  if (name_begin == std::string_view::npos || name_end == std::string_view::npos) {
+    return false;
+  }
+  if (name_end < name_begin) {
+    return false;
+  }
+  const auto name_size = std::min(name_end - name_begin - 1, name.size() - 1);
+  std::copy_n(stat.data() + name_begin + 1, name_size, name.begin());
+  name[name_size] = '\0';
+
+  // the fields after the name start from the 3rd field, utime and stime are the 14th and 15th
+  constexpr std::size_t utime_index = 14 - 3;
+  std::uint64_t values[2]{};
+  std::size_t pos = name_end + 1;
+  for (std::size_t index = 0; index <= utime_index + 1; ++index) {
+    pos = stat.find_first_not_of(' ', pos);
+    if (pos == std::string_view::npos) {
+      return false;
+    }
+    const auto end = std::min(stat.find(' ', pos), stat.size());
+    if (index >= utime_index) {
+      const auto result =
+        std::from_chars(stat.data() + pos, stat.data() + end, values[index - utime_index]);
+      if (result.ec != std::errc()) {
+        return false;
+      }
+    }
+    pos = end;
+  }
+  cpu_ticks = values[0] + values[1];
+  return true;
+}
+
+bool parse_kib_field(std::string_view content, std::string_view key, std::uint64_t & kib)
+{
+  // example: VmRSS:	    1234 kB
+  std::size_t pos = 0;
+  while ((pos = content.find(key, pos)) != std::string_view::npos) {
+    const auto value_pos = pos + key.size();
+    const bool is_line_start = pos == 0 || content[pos - 1] == '\n';
+    if (!is_line_start || value_pos >= content.size() || content[value_pos] != ':') {
+      pos = value_pos;
+      continue;
+    }
+    const auto number_pos = content.find_first_not_of(" \t", value_pos + 1);
+    if (number_pos == std::string_view::npos) {
+      return false;
+    }
+    const auto result =
+      std::from_chars(content.data() + number_pos, content.data() + content.size(), kib);
+    return result.ec == std::errc();
+  }
+  return false;
+}
+}  // namespace procfs
+
+ProcfsSampler::ProcfsSampler(const std::size_t max_threads_nb) : max_threads_nb_(max_threads_nb)
+{
+  const auto ticks_per_second = sysconf(_SC_CLK_TCK);
+  if (ticks_per_second > 0) {
+    ticks_per_second_ = static_cast<double>(ticks_per_second);
+  }
+  thread_usages_.reserve(max_threads_nb_);
+  last_thread_usages_.reserve(max_threads_nb_);
+
+  // the thread directory is kept open and rewound for each sample
+  task_dir_fd_ = open("/proc/self/task", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+  // the first sample is the reference of the CPU usage
+  sample();
+}
+
+ProcfsSampler::~ProcfsSampler()
+{
+  if (task_dir_fd_ >= 0) {
+    close(task_dir_fd_);
+  }
+}
+
+std::string_view ProcfsSampler::read_file(const char * path)
+{
+  const int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return {};
+  }
+  std::size_t size = 0;
+  while (size < buffer_.size()) {
+    const auto read_size = read(fd, buffer_.data() + size, buffer_.size() - size);
+    if (read_size <= 0) {
+      break;
+    }
+    size += static_cast<std::size_t>(read_size);
+  }
+  close(fd);
+  return {buffer_.data(), size};
+}
+
+void ProcfsSampler::sample()
+{
+  const double sample_time = get_monotonic_seconds();
+  const double elapsed_time = last_sample_time_ > 0.0 ? sample_time - last_sample_time_ : 0.0;
+
+  std::array<char, 16> name{};
+  std::uint64_t process_ticks = 0;
+  if (!procfs::parse_stat(read_file("/proc/self/stat"), name, process_ticks)) {
+    throw std::runtime_error("Couldn't read the CPU time from /proc/self/stat.");
+  }
+  process_usage_.cpu_cores_utilized =
+    to_cpu_cores(process_ticks, last_process_ticks_, ticks_per_second_, elapsed_time);
+
+  std::uint64_t kib = 0;
+  if (!procfs::parse_kib_field(read_file("/proc/self/status"), "VmRSS", kib)) {
+    throw std::runtime_error("Couldn't read the resident memory from /proc/self/status.");
+  }
+  process_usage_.process_memory_bytes = unit_conversions::kib_to_bytes(kib);
+
+  const auto meminfo = read_file("/proc/meminfo");
+  std::uint64_t total_kib = 0;
+  std::uint64_t free_kib = 0;
+  if (
+    !procfs::parse_kib_field(meminfo, "MemTotal", total_kib) ||
+    !procfs::parse_kib_field(meminfo, "MemFree", free_kib)) {
+    throw std::runtime_error("Couldn't read the system memory from /proc/meminfo.");
+  }
+  process_usage_.total_memory_bytes = unit_conversions::kib_to_bytes(total_kib);
+  process_usage_.free_memory_bytes = unit_conversions::kib_to_bytes(free_kib);
+
+  sample_threads(elapsed_time);
+
+  last_sample_time_ = sample_time;
+  last_process_ticks_ = process_ticks;
+}
+
+void ProcfsSampler::sample_threads(const double elapsed_time)
+{
+  std::swap(thread_usages_, last_thread_usages_);
+  thread_usages_.clear();
+  if (task_dir_fd_ < 0 || lseek(task_dir_fd_, 0, SEEK_SET) != 0) {
+    return;
+  }
+
+  char path[sizeof("/proc/self/task//stat") + sizeof(dirent64::d_name)];
+  bool is_full = false;
+  while (!is_full) {
+    const auto read_size =
+      syscall(SYS_getdents64, task_dir_fd_, dirent_buffer_.data(), dirent_buffer_.size());
+    if (read_size <= 0) {
+      break;
+    }
+    for (long offset = 0; offset < read_size;) {
+      const auto * entry = reinterpret_cast<const dirent64 *>(dirent_buffer_.data() + offset);
+      offset += entry->d_reclen;
+      if (entry->d_name[0] == '.') {
+        continue;
+      }
+      if (thread_usages_.size() >= max_threads_nb_) {
+        is_full = true;
+        break;
+      }
+
+      ThreadUsage usage;
+      const std::string_view tid(entry->d_name);
+      if (std::from_chars(tid.data(), tid.data() + tid.size(), usage.tid).ec != std::errc()) {
+        continue;
+      }
+      std::snprintf(path, sizeof(path), "/proc/self/task/%s/stat", entry->d_name);
+      // the thread may have exited since the directory was read
+      if (procfs::parse_stat(read_file(path), usage.name, usage.cpu_ticks)) {
+        thread_usages_.push_back(usage);
+      }
+    }
+  }
+
+  const auto compare_tid = [](const ThreadUsage & a, const ThreadUsage & b) {
+    return a.tid < b.tid;
+  };
+  std::sort(thread_usages_.begin(), thread_usages_.end(), compare_tid);
+
+  // the usage of a thread is the difference with its CPU time in the last sample, a thread which
+  // is not in the last sample was created after it and all its CPU time is in the difference
+  for (auto & usage : thread_usages_) {
+    const auto last_usage = std::lower_bound(
+      last_thread_usages_.begin(), last_thread_usages_.end(), usage, compare_tid);
+    const bool is_new_thread =
+      last_usage == last_thread_usages_.end() || last_usage->tid != usage.tid;
+    const std::uint64_t last_ticks = is_new_thread ? 0 : last_usage->cpu_ticks;
+    usage.cpu_cores_utilized =
+      to_cpu_cores(usage.cpu_ticks, last_ticks, ticks_per_second_, elapsed_time);
+  }
+}
+
+void ProcfsSampler::get_thread_hot_spots(
+  const std::size_t hot_spots_nb, std::vector<ThreadUsage> & hot_spots) const
+{
+  hot_spots.resize(std::min(hot_spots_nb, thread_usages_.size()));
+  std::partial_sort_copy(
+    thread_usages_.begin(), thread_usages_.end(), hot_spots.begin(), hot_spots.end(),
+    [](const ThreadUsage & a, const ThreadUsage & b) {
+      return a.cpu_cores_utilized > b.cpu_cores_utilized;
+    });
+}
+
+}  // namespace autoware::component_monitor
@@ -0,0 +1,130 @@
+// Copyright 2026 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PROCFS_SAMPLER_HPP_
+#define PROCFS_SAMPLER_HPP_
+
+#include <sys/types.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace autoware::component_monitor
+{
+struct ProcessUsage
+{
+  float cpu_cores_utilized{0.0f};
+  std::uint64_t process_memory_bytes{0};
+  std::uint64_t total_memory_bytes{0};
+  std::uint64_t free_memory_bytes{0};
+};
+
+struct ThreadUsage
+{
+  pid_t tid{0};
+  std::array<char, 16> name{};  // the kernel truncates thread names to 15 characters
+  std::uint64_t cpu_ticks{0};
+  float cpu_cores_utilized{0.0f};
+};
+
+/**
+ * @brief Samples the CPU and memory usage of the current process and of its threads from procfs.
+ *
+ * @details The usage is read from `/proc/self/stat`, `/proc/self/status`, `/proc/meminfo` and
+ * `/proc/self/task/<tid>/stat` into fixed buffers. The CPU usage is the difference of the CPU
+ * time between two samples divided by the elapsed time, so the first usage is computed against
+ * the sample taken in the constructor. The buffers are allocated in the constructor only, the
+ * threads beyond `max_threads_nb` are not sampled.
+ */
+class ProcfsSampler
+{
+public:
+  explicit ProcfsSampler(std::size_t max_threads_nb = 1024);
+  ~ProcfsSampler();
+
+  ProcfsSampler(const ProcfsSampler &) = delete;
+  ProcfsSampler & operator=(const ProcfsSampler &) = delete;
+
+  /**
+   * @brief Read the usage of the process and its threads.
+   *
+   * @exception std::runtime_error Thrown if the usage of the process can't be read.
+   */
+  void sample();
+
+  const ProcessUsage & process_usage() const { return process_usage_; }
+
+  /**
+   * @brief The usage of the threads in the last sample, sorted by thread id.
+   */
+  const std::vector<ThreadUsage> & thread_usages() const { return thread_usages_; }
+
+  /**
+   * @brief Copy the threads with the highest CPU usage in the last sample.
+   *
+   * @param hot_spots_nb The maximum number of threads to copy
+   * @param hot_spots Output threads, sorted by decreasing CPU usage
+   */
+  void get_thread_hot_spots(std::size_t hot_spots_nb, std::vector<ThreadUsage> & hot_spots) const;
+
+private:
+  static constexpr std::size_t buffer_size = 4096;
+
+  std::array<char, buffer_size> buffer_{};
+  alignas(8) std::array<char, buffer_size> dirent_buffer_{};
+  int task_dir_fd_{-1};
+  double ticks_per_second_{100.0};
+
+  double last_sample_time_{0.0};
+  std::uint64_t last_process_ticks_{0};
+  ProcessUsage process_usage_;
+
+  std::size_t max_threads_nb_;
+  std::vector<ThreadUsage> thread_usages_;
+  std::vector<ThreadUsage> last_thread_usages_;
+
+  std::string_view read_file(const char * path);
+  void sample_threads(double elapsed_time);
+};
+
+namespace procfs
+{
+/**
+ * @brief Parses the content of a `/proc/<pid>/stat` file.
+ *
+ * @param stat Content of the file
+ * @param name Output name of the process or thread, truncated to fit in the array
+ * @param cpu_ticks Output sum of the user and system CPU time in clock ticks
+ * @return false if the content is malformed
+ */
+bool parse_stat(std::string_view stat, std::array<char, 16> & name, std::uint64_t & cpu_ticks);
+
+/**
+ * @brief Finds the value of a field like `VmRSS:     1234 kB` in `/proc/<pid>/status` or
+ * `/proc/meminfo`.
+ *
+ * @param content Content of the file
+ * @param key Field name, without the colon
+ * @param kib Output value of the field in KiB
+ * @return false if the field is not found
+ */
+bool parse_kib_field(std::string_view content, std::string_view key, std::uint64_t & kib);
+}  // namespace procfs
+
+}  // namespace autoware::component_monitor
+
+#endif  // PROCFS_SAMPLER_HPP_
@@ -0,0 +1,90 @@
+// Copyright 2026 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "procfs_sampler.hpp"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace autoware::component_monitor
+{
+TEST(ProcfsSampler, parse_stat)
+{
+  std::array<char, 16> name{};
+  std::uint64_t cpu_ticks = 0;
+
+  // the name contains spaces and parentheses
+  EXPECT_TRUE(procfs::parse_stat(
+    "1234 (a (b) c) S 1 1234 1234 0 -1 4194560 100 0 0 0 25 7 0 0 20 0 1 0 5 100 200", name,
+    cpu_ticks));
+  EXPECT_STREQ(name.data(), "a (b) c");
+  EXPECT_EQ(cpu_ticks, 32U);
+
+  // the name is truncated to the array size
+  EXPECT_TRUE(procfs::parse_stat(
+    "1 (a_very_long_thread_name) R 1 1 1 0 -1 0 0 0 0 0 3 4", name, cpu_ticks));
+  EXPECT_EQ(std::strlen(name.data()), 15U);
+  EXPECT_EQ(cpu_ticks, 7U);
+
+  EXPECT_FALSE(procfs::parse_stat("1 (a) R 1 1", name, cpu_ticks));
+  EXPECT_FALSE(procfs::parse_stat("", name, cpu_ticks));
+}
+
+TEST(ProcfsSampler, parse_kib_field)
+{
+  std::uint64_t kib = 0;
+  EXPECT_TRUE(procfs::parse_kib_field("VmHWM:\t   10 kB\nVmRSS:\t    1234 kB\n", "VmRSS", kib));
+  EXPECT_EQ(kib, 1234U);
+  EXPECT_TRUE(procfs::parse_kib_field("MemTotal:  5 kB\nMemFree:   3 kB\n", "MemFree", kib));
+  EXPECT_EQ(kib, 3U);
+
+  // the key must start a line and end with a colon
+  EXPECT_FALSE(procfs::parse_kib_field("RssVmRSS:\t1 kB\n", "VmRSS", kib));
+  EXPECT_FALSE(procfs::parse_kib_field("VmRSSx:\t1 kB\n", "VmRSS", kib));
+}
+
+TEST(ProcfsSampler, sample_busy_thread)
+{
+  ProcfsSampler sampler;
+
+  std::atomic<bool> is_running{true};
+  std::thread busy_thread([&is_running]() {
+    pthread_setname_np(pthread_self(), "busy_thread");
+    while (is_running) {
+    }
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  sampler.sample();
+  is_running = false;
+  busy_thread.join();
+
+  const auto & usage = sampler.process_usage();
+  EXPECT_GT(usage.cpu_cores_utilized, 0.5f);
+  EXPECT_GT(usage.process_memory_bytes, 0U);
+  EXPECT_GT(usage.total_memory_bytes, usage.free_memory_bytes);
+  EXPECT_GE(sampler.thread_usages().size(), 2U);
+
+  std::vector<ThreadUsage> hot_spots;
+  sampler.get_thread_hot_spots(1, hot_spots);
+  ASSERT_EQ(hot_spots.size(), 1U);
+  EXPECT_STREQ(hot_spots.front().name.data(), "busy_thread");
+  EXPECT_GT(hot_spots.front().cpu_cores_utilized, 0.5f);
+}
+}  // namespace autoware::component_monitor
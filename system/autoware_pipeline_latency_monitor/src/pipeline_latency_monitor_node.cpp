@@ -65,6 +65,7 @@ PipelineLatencyMonitorNode::PipelineLatencyMonitorNode(const rclcpp::NodeOptions
   update_rate_ = declare_parameter<double>("update_rate");
   latency_threshold_ms_ = declare_parameter<double>("latency_threshold_ms");
   window_size_ = declare_parameter<int>("window_size");
+  statistics_window_ = declare_parameter<double>("statistics_window");
 
   const auto processing_steps =
     declare_parameter<std::vector<std::string>>("processing_steps.sequence");
@@ -84,6 +85,7 @@ PipelineLatencyMonitorNode::PipelineLatencyMonitorNode(const rclcpp::NodeOptions
     input.timestamp_meaning =
       timestamp_meaning == "start" ? TimestampMeaning::start : TimestampMeaning::end;
     input.latency_multiplier = latency_multiplier;
+    input.latency_histogram = std::make_unique<autoware::universe_utils::StreamingHistogram>();
 
     // generic callback
     const auto callback = [this,
@@ -94,7 +96,7 @@ PipelineLatencyMonitorNode::PipelineLatencyMonitorNode(const rclcpp::NodeOptions
           serialization;
         autoware_internal_debug_msgs::msg::Float64Stamped msg;
         serialization.deserialize_message(serialized_msg.get(), &msg);
-        this->update_history(input.latency_history, msg.stamp, msg.data * input.latency_multiplier);
+        this->update_history(input, msg.stamp, msg.data * input.latency_multiplier);
         RCLCPP_DEBUG(
           get_logger(), "Received %s: %.2f", input.name.c_str(),
           msg.data * input.latency_multiplier);
@@ -104,8 +106,7 @@ PipelineLatencyMonitorNode::PipelineLatencyMonitorNode(const rclcpp::NodeOptions
           serialization;
         autoware_planning_validator::msg::PlanningValidatorStatus msg;
         serialization.deserialize_message(serialized_msg.get(), &msg);
-        this->update_history(
-          input.latency_history, msg.stamp, msg.latency * input.latency_multiplier);
+        this->update_history(input, msg.stamp, msg.latency * input.latency_multiplier);
         RCLCPP_DEBUG(
           get_logger(), "Received %s: %.2f", input.name.c_str(),
           msg.latency * input.latency_multiplier);
@@ -131,6 +132,7 @@ PipelineLatencyMonitorNode::PipelineLatencyMonitorNode(const rclcpp::NodeOptions
   diagnostic_updater_.add("Total Latency", this, &PipelineLatencyMonitorNode::check_total_latency);
 
   // Create timer
+  statistics_window_start_time_ = now();
   timer_ = rclcpp::create_timer(
     this, this->get_clock(), std::chrono::milliseconds(static_cast<int>(1000.0 / update_rate_)),
     std::bind(&PipelineLatencyMonitorNode::on_timer, this));
@@ -142,6 +144,8 @@ void PipelineLatencyMonitorNode::on_timer()
 {
   calculate_total_latency();
 
+  update_statistics();
+
   publish_total_latency();
 
   // Update diagnostics
@@ -225,6 +229,21 @@ void PipelineLatencyMonitorNode::calculate_total_latency()
   }
 }
 
+void PipelineLatencyMonitorNode::update_statistics()
+{
+  total_latency_histogram_.add(total_latency_ms_);
+
+  const auto current_time = now();
+  if ((current_time - statistics_window_start_time_).seconds() < statistics_window_) {
+    return;
+  }
+  statistics_window_start_time_ = current_time;
+  for (auto & input : input_sequence_) {
+    input.latency_summary = input.latency_histogram->take_window_summary();
+  }
+  total_latency_summary_ = total_latency_histogram_.take_window_summary();
+}
+
 void PipelineLatencyMonitorNode::publish_total_latency()
 {
   // Publish total latency
@@ -242,6 +261,27 @@ void PipelineLatencyMonitorNode::publish_total_latency()
   debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
     "debug/pipeline_total_latency_ms", total_latency_ms_);
 
+  // Publish the statistics of the last statistics window
+  const auto publish_summary = [this](
+                                 const std::string & name,
+                                 const autoware::universe_utils::StreamingSummary & summary) {
+    if (summary.count == 0) {
+      return;
+    }
+    debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+      name + "/p50", summary.p50);
+    debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+      name + "/p95", summary.p95);
+    debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+      name + "/p99", summary.p99);
+    debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+      name + "/max", summary.max);
+  };
+  for (const auto & input : input_sequence_) {
+    publish_summary("debug/" + input.name + "_latency_ms", input.latency_summary);
+  }
+  publish_summary("debug/pipeline_total_latency_ms", total_latency_summary_);
+
   RCLCPP_DEBUG_THROTTLE(
     get_logger(), *get_clock(), 1000, "Total latency: %.2f ms (threshold: %.2f ms)",
     total_latency_ms_, latency_threshold_ms_);
@@ -252,6 +292,10 @@ void PipelineLatencyMonitorNode::check_total_latency(
 {
   stat.add("Total Latency (ms)", total_latency_ms_);
   stat.add("Threshold (ms)", latency_threshold_ms_);
+  if (total_latency_summary_.count > 0) {
+    stat.add("Total Latency p99 (ms)", total_latency_summary_.p99);
+    stat.add("Total Latency max (ms)", total_latency_summary_.max);
+  }
 
   std::string uninitialized_inputs;
   for (const auto & input : input_sequence_) {
@@ -279,7 +323,7 @@ void PipelineLatencyMonitorNode::check_total_latency(
 }
 
 void PipelineLatencyMonitorNode::update_history(
-  std::deque<ProcessData> & history, const rclcpp::Time & timestamp, double value)
+  ProcessInput & input, const rclcpp::Time & timestamp, double value)
 {
   if (value < 0.0) {
     RCLCPP_DEBUG_THROTTLE(
@@ -288,7 +332,10 @@ void PipelineLatencyMonitorNode::update_history(
     value = 0.0;
   }
 
+  input.latency_histogram->add(value);
+
   // Add new value to history
+  auto & history = input.latency_history;
   history.emplace_back(timestamp, value);
 
   // Remove old data if window size is exceeded
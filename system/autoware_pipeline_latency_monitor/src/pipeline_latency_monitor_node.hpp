@@ -15,6 +15,7 @@
 #ifndef PIPELINE_LATENCY_MONITOR_NODE_HPP_
 #define PIPELINE_LATENCY_MONITOR_NODE_HPP_
 
+#include <autoware/universe_utils/math/streaming_histogram.hpp>
 #include <autoware/universe_utils/ros/debug_publisher.hpp>
 #include <diagnostic_updater/diagnostic_updater.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -51,6 +52,10 @@ struct ProcessInput
   TimestampMeaning timestamp_meaning;
   double latency_multiplier;  // used when the received value is not in millisecond
   std::deque<ProcessData> latency_history;
+  // distribution of the received latencies
+  std::unique_ptr<autoware::universe_utils::StreamingHistogram> latency_histogram;
+  // statistics of the received latencies in the last statistics window
+  autoware::universe_utils::StreamingSummary latency_summary;
 };
 
 class PipelineLatencyMonitorNode : public rclcpp::Node
@@ -63,6 +68,7 @@ private:
   double update_rate_{};
   double latency_threshold_ms_{};
   size_t window_size_{};
+  double statistics_window_{};
 
   // Sequence of latency inputs
   std::vector<ProcessInput> input_sequence_;
@@ -70,6 +76,10 @@ private:
   std::vector<double> latency_offsets_;
   // Current total latency
   double total_latency_ms_{};
+  // Distribution of the total latency and its statistics in the last statistics window
+  autoware::universe_utils::StreamingHistogram total_latency_histogram_;
+  autoware::universe_utils::StreamingSummary total_latency_summary_;
+  rclcpp::Time statistics_window_start_time_;
 
   // Subscribers to the input topics
   std::vector<rclcpp::GenericSubscription::SharedPtr> generic_subscribers_;
@@ -90,12 +100,12 @@ private:
   // Callback functions
   void on_timer();
   void calculate_total_latency();
+  void update_statistics();
   void publish_total_latency();
   void check_total_latency(diagnostic_updater::DiagnosticStatusWrapper & stat);
 
   // Helper functions
-  void update_history(
-    std::deque<ProcessData> & history, const rclcpp::Time & timestamp, double value);
+  void update_history(ProcessInput & input, const rclcpp::Time & timestamp, double value);
   bool is_timestamp_older(const rclcpp::Time & timestamp1, const rclcpp::Time & timestamp2) const;
 };
 
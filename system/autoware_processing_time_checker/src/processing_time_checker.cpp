@@ -21,6 +21,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -44,6 +45,7 @@ ProcessingTimeChecker::ProcessingTimeChecker(const rclcpp::NodeOptions & node_op
 : Node("processing_time_checker", node_options)
 {
   output_metrics_ = declare_parameter<bool>("output_metrics");
+  statistics_window_ = declare_parameter<double>("statistics_window");
   const double update_rate = declare_parameter<double>("update_rate");
   const auto processing_time_topic_name_list =
     declare_parameter<std::vector<std::string>>("processing_time_topic_name_list");
@@ -70,8 +72,8 @@ ProcessingTimeChecker::ProcessingTimeChecker(const rclcpp::NodeOptions & node_op
     // register module name
     if (module_name) {
       module_name_map_.insert_or_assign(processing_time_topic_name, *module_name);
-      processing_time_accumulator_map_.insert_or_assign(*module_name, Accumulator<double>());
-      processing_time_tdigest_map_.insert_or_assign(*module_name, tdigest<double>(100));
+      processing_time_histogram_map_.try_emplace(*module_name);
+      processing_time_window_summary_map_.try_emplace(*module_name);
     } else {
       throw std::invalid_argument("The format of the processing time topic name is not correct.");
     }
@@ -87,13 +89,13 @@ ProcessingTimeChecker::ProcessingTimeChecker(const rclcpp::NodeOptions & node_op
         processing_time_topic_name, 1,
         [this, &module_name]([[maybe_unused]] const Float64Stamped & msg) {
           processing_time_map_.insert_or_assign(module_name, msg.data);
-          processing_time_accumulator_map_.at(module_name).add(msg.data);
-          processing_time_tdigest_map_.at(module_name).insert(msg.data);
+          processing_time_histogram_map_.at(module_name).add(msg.data);
         }));
     // clang-format on
   }
 
   metrics_pub_ = create_publisher<MetricArrayMsg>("~/metrics", 1);
+  window_start_time_ = now();
 
   const auto period_ns = rclcpp::Rate(update_rate).period();
   timer_ = rclcpp::create_timer(
@@ -109,17 +111,19 @@ ProcessingTimeChecker::~ProcessingTimeChecker()
   try {
     // generate json data
     nlohmann::json j;
-    for (const auto & accumulator_iterator : processing_time_accumulator_map_) {
-      const auto module_name = accumulator_iterator.first;
-      const auto processing_time_accumulator = accumulator_iterator.second;
-      auto processing_time_tdigest = processing_time_tdigest_map_.at(module_name);
-      processing_time_tdigest.merge();
-      j[module_name + "/min"] = processing_time_accumulator.min();
-      j[module_name + "/max"] = processing_time_accumulator.max();
-      j[module_name + "/mean"] = processing_time_accumulator.mean();
-      j[module_name + "/percentile_95"] = processing_time_tdigest.quantile(95.0);
-      j[module_name + "/percentile_99"] = processing_time_tdigest.quantile(99.0);
-      j[module_name + "/count"] = processing_time_accumulator.count();
+    for (const auto & [module_name, processing_time_histogram] : processing_time_histogram_map_) {
+      const auto summary = processing_time_histogram.summary();
+      if (summary.count == 0) {
+        j[module_name + "/min"] = std::numeric_limits<double>::max();
+        j[module_name + "/max"] = std::numeric_limits<double>::lowest();
+      } else {
+        j[module_name + "/min"] = summary.min;
+        j[module_name + "/max"] = summary.max;
+      }
+      j[module_name + "/mean"] = summary.mean;
+      j[module_name + "/percentile_95"] = summary.p95;
+      j[module_name + "/percentile_99"] = summary.p99;
+      j[module_name + "/count"] = summary.count;
       j[module_name + "/description"] = "processing time of " + module_name + "[ms]";
     }
 
@@ -160,18 +164,44 @@ ProcessingTimeChecker::~ProcessingTimeChecker()
 
 void ProcessingTimeChecker::on_timer()
 {
+  // update the statistics of the processing times at the end of each window
+  const auto current_time = now();
+  const double elapsed_time = (current_time - window_start_time_).seconds();
+  if (elapsed_time >= statistics_window_) {
+    for (auto & [module_name, processing_time_histogram] : processing_time_histogram_map_) {
+      processing_time_window_summary_map_.at(module_name) =
+        processing_time_histogram.take_window_summary();
+    }
+    window_start_time_ = current_time;
+    window_duration_ = elapsed_time;
+  }
+
   // create MetricArrayMsg
   MetricArrayMsg metrics_msg;
+  const auto add_metric = [&metrics_msg](
+                            const std::string & name, const double value,
+                            const std::string & unit) {
+    MetricMsg metric;
+    metric.name = name;
+    metric.value = std::to_string(value);
+    metric.unit = unit;
+    metrics_msg.metric_array.push_back(metric);
+  };
   for (const auto & processing_time_iterator : processing_time_map_) {
     const auto processing_time_topic_name = processing_time_iterator.first;
     const double processing_time = processing_time_iterator.second;
+    add_metric("processing_time/" + processing_time_topic_name, processing_time, "millisecond");
 
-    // generate MetricMsg
-    MetricMsg metric;
-    metric.name = "processing_time/" + processing_time_topic_name;
-    metric.value = std::to_string(processing_time);
-    metric.unit = "millisecond";
-    metrics_msg.metric_array.push_back(metric);
+    const auto & summary = processing_time_window_summary_map_.at(processing_time_topic_name);
+    if (summary.count == 0) {
+      continue;
+    }
+    const auto prefix = "processing_time/" + processing_time_topic_name;
+    add_metric(prefix + "/p50", summary.p50, "millisecond");
+    add_metric(prefix + "/p95", summary.p95, "millisecond");
+    add_metric(prefix + "/p99", summary.p99, "millisecond");
+    add_metric(prefix + "/max", summary.max, "millisecond");
+    add_metric(prefix + "/rate", static_cast<double>(summary.count) / window_duration_, "hertz");
   }
 
   // publish
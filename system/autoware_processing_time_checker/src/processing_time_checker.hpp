@@ -15,9 +15,7 @@
 #ifndef PROCESSING_TIME_CHECKER_HPP_
 #define PROCESSING_TIME_CHECKER_HPP_
 
-#include "autoware_utils/math/accumulator.hpp"
-#include "digestible.hpp"
-
+#include <autoware/universe_utils/math/streaming_histogram.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_internal_debug_msgs/msg/float64_stamped.hpp>
@@ -30,8 +28,8 @@
 
 namespace autoware::processing_time_checker
 {
-using autoware_utils::Accumulator;
-using digestible::tdigest;
+using autoware::universe_utils::StreamingHistogram;
+using autoware::universe_utils::StreamingSummary;
 using MetricMsg = tier4_metric_msgs::msg::Metric;
 using MetricArrayMsg = tier4_metric_msgs::msg::MetricArray;
 using autoware_internal_debug_msgs::msg::Float64Stamped;
@@ -52,14 +50,18 @@ private:
 
   // parameters
   bool output_metrics_;
+  double statistics_window_;
 
   // topic name - module name
   std::unordered_map<std::string, std::string> module_name_map_{};
   // module name - processing time
   std::unordered_map<std::string, double> processing_time_map_{};
-  // module name - accumulator
-  std::unordered_map<std::string, Accumulator<double>> processing_time_accumulator_map_{};
-  std::unordered_map<std::string, tdigest<double>> processing_time_tdigest_map_{};
+  // module name - histogram of the processing times
+  std::unordered_map<std::string, StreamingHistogram> processing_time_histogram_map_{};
+  // module name - statistics of the processing times in the last window
+  std::unordered_map<std::string, StreamingSummary> processing_time_window_summary_map_{};
+  rclcpp::Time window_start_time_;
+  double window_duration_{0.0};
 };
 }  // namespace autoware::processing_time_checker
 